@@ -0,0 +1,672 @@
+/**
+ * MÓDULO DE ÓPTIMOS ALTERNATIVOS
+ * Enumeración de los vértices de la cara óptima de un modelo lineal por
+ * búsqueda inversa, para que el planificador elija entre planes con la
+ * misma ganancia según otros criterios
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <cmath>
+#include <unordered_set>
+
+using namespace std;
+
+static const double TOL_CARA = 1e-9;
+
+// Fila de una desigualdad g·x <= h sobre las variables originales
+struct DesigualdadCara
+{
+    vector<double> coeficientes;
+    double lado;
+};
+
+/**
+ * Construye la cara óptima {x factible : c·x = c·x*} en las coordenadas y de
+ * x = x* + Z·y, donde Z genera el núcleo de las igualdades del modelo y del
+ * objetivo, y prepara el diccionario inicial en el vértice y = 0.
+ * @param modelo Modelo lineal ya resuelto
+ * @param optimo Vértice óptimo del modelo (por ejemplo, el del símplex)
+ * @param limiteVertices Máximo de vértices que entregará siguiente()
+ */
+EnumeradorOptimos::EnumeradorOptimos(const ModeloLineal &modelo, const vector<double> &optimo, size_t limiteVertices)
+    : n(modelo.getNumVariables()), d(0), m(0), profundidad(0), candidato(0), iniciado(false), terminado(false),
+      noAcotada(false), limite(limiteVertices), entregados(0)
+{
+    if (static_cast<int>(optimo.size()) != n)
+    {
+        throw invalid_argument("El punto óptimo no tiene una coordenada por variable.");
+    }
+    if (!modelo.costosPorTramos.empty())
+    {
+        throw invalid_argument("La cara óptima solo se enumera en modelos sin costos por tramos.");
+    }
+    origen = optimo;
+
+    // Igualdades (incluida la del objetivo) y desigualdades sobre x
+    vector<vector<double>> igualdades;
+    vector<double> ladoIgualdades;
+    vector<DesigualdadCara> desigualdades;
+    auto agregar = [&](const vector<double> &fila, double inferior, double superior)
+    {
+        if (inferior == superior)
+        {
+            igualdades.push_back(fila);
+            ladoIgualdades.push_back(superior);
+            return;
+        }
+        if (isfinite(superior))
+            desigualdades.push_back({fila, superior});
+        if (isfinite(inferior))
+        {
+            vector<double> opuesta(fila);
+            for (double &valor : opuesta)
+                valor = -valor;
+            desigualdades.push_back({opuesta, -inferior});
+        }
+    };
+
+    double valorOptimo = 0.0;
+    for (int j = 0; j < n; j++)
+        valorOptimo += modelo.objetivo[j] * optimo[j];
+    agregar(modelo.objetivo, valorOptimo, valorOptimo);
+
+    for (int j = 0; j < n; j++)
+    {
+        vector<double> fila(n, 0.0);
+        fila[j] = 1.0;
+        agregar(fila, modelo.cotaInferior[j], modelo.cotaSuperior[j]);
+    }
+    for (int i = 0; i < modelo.getNumFilas(); i++)
+    {
+        vector<double> fila(n, 0.0);
+        for (const auto &coeficiente : modelo.filas[i])
+            fila[coeficiente.first] += coeficiente.second;
+        agregar(fila, modelo.filaInferior[i], modelo.filaSuperior[i]);
+    }
+
+    // Núcleo de las igualdades: forma escalonada reducida con pivoteo parcial
+    int filasIgualdad = static_cast<int>(igualdades.size());
+    vector<int> columnaPivote;
+    vector<bool> esPivote(n, false);
+    int rango = 0;
+    for (int col = 0; col < n && rango < filasIgualdad; col++)
+    {
+        int mejor = rango;
+        for (int i = rango + 1; i < filasIgualdad; i++)
+        {
+            if (abs(igualdades[i][col]) > abs(igualdades[mejor][col]))
+                mejor = i;
+        }
+        if (abs(igualdades[mejor][col]) < TOL_CARA)
+            continue;
+        swap(igualdades[mejor], igualdades[rango]);
+        double pivote = igualdades[rango][col];
+        for (double &valor : igualdades[rango])
+            valor /= pivote;
+        for (int i = 0; i < filasIgualdad; i++)
+        {
+            double factor = igualdades[i][col];
+            if (i == rango || factor == 0.0)
+                continue;
+            for (int j = 0; j < n; j++)
+                igualdades[i][j] -= factor * igualdades[rango][j];
+        }
+        columnaPivote.push_back(col);
+        esPivote[col] = true;
+        rango++;
+    }
+
+    d = n - rango;
+    direcciones.assign(static_cast<size_t>(n) * d, 0.0);
+    int libre = 0;
+    for (int col = 0; col < n; col++)
+    {
+        if (esPivote[col])
+            continue;
+        direcciones[static_cast<size_t>(col) * d + libre] = 1.0;
+        for (int i = 0; i < rango; i++)
+            direcciones[static_cast<size_t>(columnaPivote[i]) * d + libre] = -igualdades[i][col];
+        libre++;
+    }
+
+    // Desigualdades en y: (g·Z)·y <= h - g·x*, normalizadas; las filas nulas se descartan
+    vector<vector<double>> filasG;
+    vector<double> ladosH;
+    for (const auto &desigualdad : desigualdades)
+    {
+        vector<double> fila(d, 0.0);
+        double holgura = desigualdad.lado;
+        for (int j = 0; j < n; j++)
+        {
+            double g = desigualdad.coeficientes[j];
+            if (g == 0.0)
+                continue;
+            holgura -= g * origen[j];
+            for (int k = 0; k < d; k++)
+                fila[k] += g * direcciones[static_cast<size_t>(j) * d + k];
+        }
+
+        double escala = 0.0;
+        for (double valor : fila)
+            escala = max(escala, abs(valor));
+        if (escala < TOL_CARA)
+        {
+            if (holgura < -1e-6 * (1.0 + abs(desigualdad.lado)))
+                throw invalid_argument("El punto indicado no es factible.");
+            continue;
+        }
+        for (double &valor : fila)
+            valor /= escala;
+        holgura /= escala;
+        if (holgura < -1e-6)
+            throw invalid_argument("El punto indicado no es factible.");
+        filasG.push_back(fila);
+        ladosH.push_back(abs(holgura) <= 1e-7 ? 0.0 : holgura);
+    }
+
+    m = static_cast<int>(filasG.size());
+    if (d == 0)
+    {
+        m = 0;
+        return; // El óptimo es único: solo se entrega x*
+    }
+
+    // Cobase inicial: d desigualdades activas en y = 0 linealmente independientes
+    vector<int> activas;
+    vector<vector<double>> reducidas;
+    for (int i = 0; i < m && static_cast<int>(activas.size()) < d; i++)
+    {
+        if (ladosH[i] != 0.0)
+            continue;
+        vector<double> fila = filasG[i];
+        for (size_t r = 0; r < reducidas.size(); r++)
+        {
+            int col = 0;
+            while (abs(reducidas[r][col]) < 0.5)
+                col++;
+            double factor = fila[col] / reducidas[r][col];
+            for (int k = 0; k < d; k++)
+                fila[k] -= factor * reducidas[r][k];
+        }
+        int mayor = 0;
+        for (int k = 1; k < d; k++)
+        {
+            if (abs(fila[k]) > abs(fila[mayor]))
+                mayor = k;
+        }
+        if (abs(fila[mayor]) < 1e-7)
+            continue;
+        double pivote = fila[mayor];
+        for (double &valor : fila)
+            valor /= pivote;
+        reducidas.push_back(fila);
+        activas.push_back(i);
+    }
+    if (static_cast<int>(activas.size()) < d)
+    {
+        throw invalid_argument("El punto indicado no es un vértice de la cara óptima.");
+    }
+
+    // Las holguras de la cobase inicial reciben los índices más altos: así el
+    // diccionario inicial es lexicográficamente positivo
+    vector<bool> enCobase(m, false);
+    for (int i : activas)
+        enCobase[i] = true;
+    vector<int> orden;
+    for (int i = 0; i < m; i++)
+    {
+        if (!enCobase[i])
+            orden.push_back(i);
+    }
+    orden.insert(orden.end(), activas.begin(), activas.end());
+
+    // Inversa de G_N (d × d) por Gauss-Jordan
+    vector<double> gN(static_cast<size_t>(d) * d);
+    vector<double> inversa(static_cast<size_t>(d) * d, 0.0);
+    for (int r = 0; r < d; r++)
+    {
+        for (int k = 0; k < d; k++)
+            gN[static_cast<size_t>(r) * d + k] = filasG[activas[r]][k];
+        inversa[static_cast<size_t>(r) * d + r] = 1.0;
+    }
+    for (int col = 0; col < d; col++)
+    {
+        int mejor = col;
+        for (int r = col + 1; r < d; r++)
+        {
+            if (abs(gN[static_cast<size_t>(r) * d + col]) > abs(gN[static_cast<size_t>(mejor) * d + col]))
+                mejor = r;
+        }
+        for (int k = 0; k < d; k++)
+        {
+            swap(gN[static_cast<size_t>(mejor) * d + k], gN[static_cast<size_t>(col) * d + k]);
+            swap(inversa[static_cast<size_t>(mejor) * d + k], inversa[static_cast<size_t>(col) * d + k]);
+        }
+        double pivote = gN[static_cast<size_t>(col) * d + col];
+        for (int k = 0; k < d; k++)
+        {
+            gN[static_cast<size_t>(col) * d + k] /= pivote;
+            inversa[static_cast<size_t>(col) * d + k] /= pivote;
+        }
+        for (int r = 0; r < d; r++)
+        {
+            double factor = gN[static_cast<size_t>(r) * d + col];
+            if (r == col || factor == 0.0)
+                continue;
+            for (int k = 0; k < d; k++)
+            {
+                gN[static_cast<size_t>(r) * d + k] -= factor * gN[static_cast<size_t>(col) * d + k];
+                inversa[static_cast<size_t>(r) * d + k] -= factor * inversa[static_cast<size_t>(col) * d + k];
+            }
+        }
+    }
+
+    // Diccionario: variable básica = lado - Σ matriz·(holgura no básica).
+    // Filas 0..m-d-1: holguras básicas; filas m-d..m-1: coordenadas y.
+    // y = G_N⁻¹·(h_N - s_N) con h_N = 0; s_B = h_B - G_B·y = h_B + G_B·G_N⁻¹·s_N
+    matriz.assign(static_cast<size_t>(m) * d, 0.0);
+    lado.assign(m, 0.0);
+    basicas.assign(m, -1);
+    for (int r = 0; r < m - d; r++)
+    {
+        const vector<double> &g = filasG[orden[r]];
+        basicas[r] = r;
+        lado[r] = ladosH[orden[r]];
+        for (int k = 0; k < d; k++)
+        {
+            double total = 0.0;
+            for (int t = 0; t < d; t++)
+                total += g[t] * inversa[static_cast<size_t>(t) * d + k];
+            matriz[static_cast<size_t>(r) * d + k] = -total;
+        }
+    }
+    for (int t = 0; t < d; t++)
+    {
+        for (int k = 0; k < d; k++)
+            matriz[static_cast<size_t>(m - d + t) * d + k] = inversa[static_cast<size_t>(t) * d + k];
+    }
+
+    cobase.resize(d);
+    posicionCobase.assign(m, -1);
+    for (int k = 0; k < d; k++)
+    {
+        cobase[k] = m - d + k;
+        posicionCobase[m - d + k] = k;
+    }
+
+    // Objetivo auxiliar: maximizar -Σ holguras de la cobase inicial (la raíz es su único óptimo)
+    costos.assign(d, -1.0);
+}
+
+// Coeficiente de ε_holgura en el lado perturbado de la fila
+double EnumeradorOptimos::coeficienteLexico(int fila, int holgura) const
+{
+    if (basicas[fila] == holgura)
+        return 1.0;
+    int columna = posicionCobase[holgura];
+    return columna >= 0 ? elemento(fila, columna) : 0.0;
+}
+
+// Prueba de razón lexicográfica: la fila que se anula primero al subir la holgura
+// de la columna; con la perturbación nunca hay empates
+int EnumeradorOptimos::filaSaliente(int columna) const
+{
+    int mejor = -1;
+    for (int r = 0; r < m - d; r++)
+    {
+        double a = elemento(r, columna);
+        if (a <= TOL_CARA)
+            continue;
+        if (mejor < 0)
+        {
+            mejor = r;
+            continue;
+        }
+
+        double b = elemento(mejor, columna);
+        double razon = lado[r] / a;
+        double razonMejor = lado[mejor] / b;
+        if (razon < razonMejor - TOL_CARA * (1.0 + abs(razonMejor)))
+        {
+            mejor = r;
+            continue;
+        }
+        if (razon > razonMejor + TOL_CARA * (1.0 + abs(razonMejor)))
+            continue;
+
+        for (int k = 0; k < m; k++)
+        {
+            double cr = coeficienteLexico(r, k) / a;
+            double cm = coeficienteLexico(mejor, k) / b;
+            if (abs(cr - cm) <= TOL_CARA)
+                continue;
+            if (cr < cm)
+                mejor = r;
+            break;
+        }
+    }
+    return mejor;
+}
+
+// Una columna sin elementos positivos en las filas de holgura es una arista sin fin
+bool EnumeradorOptimos::tienePositivo(int columna) const
+{
+    for (int r = 0; r < m - d; r++)
+    {
+        if (elemento(r, columna) > TOL_CARA)
+            return true;
+    }
+    return false;
+}
+
+// El pivoteo (fila, columna) lleva a un hijo si la regla de Bland, aplicada en
+// el diccionario resultante, devuelve exactamente al diccionario actual
+bool EnumeradorOptimos::esHijo(int columna, int fila) const
+{
+    int saliente = basicas[fila];
+    double a = elemento(fila, columna);
+    for (int j = 0; j < d; j++)
+    {
+        if (j == columna || cobase[j] >= saliente)
+            continue;
+        double reducido = costos[j] - costos[columna] * elemento(fila, j) / a;
+        if (reducido > TOL_CARA)
+            return false;
+    }
+    return true;
+}
+
+void EnumeradorOptimos::pivotear(int fila, int columna)
+{
+    double a = elemento(fila, columna);
+    double *filaPivote = &matriz[static_cast<size_t>(fila) * d];
+    for (int j = 0; j < d; j++)
+        filaPivote[j] = j == columna ? 1.0 / a : filaPivote[j] / a;
+    lado[fila] /= a;
+
+    for (int r = 0; r < m; r++)
+    {
+        if (r == fila)
+            continue;
+        double *filaR = &matriz[static_cast<size_t>(r) * d];
+        double f = filaR[columna];
+        if (f == 0.0)
+            continue;
+        for (int j = 0; j < d; j++)
+            filaR[j] = j == columna ? -f / a : filaR[j] - f * filaPivote[j];
+        lado[r] -= f * lado[fila];
+    }
+
+    double c = costos[columna];
+    for (int j = 0; j < d; j++)
+        costos[j] = j == columna ? -c / a : costos[j] - c * filaPivote[j];
+
+    int saliente = basicas[fila];
+    int entrante = cobase[columna];
+    basicas[fila] = entrante;
+    posicionCobase[entrante] = -1;
+    cobase[columna] = saliente;
+    posicionCobase[saliente] = columna;
+}
+
+// Un vértice degenerado tiene varias bases: solo se entrega desde la de base
+// lexicográficamente mínima (ningún pivoteo degenerado la achica)
+bool EnumeradorOptimos::esLexicoMinimo() const
+{
+    for (int r = 0; r < m - d; r++)
+    {
+        if (abs(lado[r]) > TOL_CARA)
+            continue;
+        for (int j = 0; j < d; j++)
+        {
+            if (cobase[j] < basicas[r] && abs(elemento(r, j)) > TOL_CARA)
+                return false;
+        }
+    }
+    return true;
+}
+
+// Un paso del recorrido en profundidad del árbol de búsqueda inversa
+bool EnumeradorOptimos::avanzar()
+{
+    while (true)
+    {
+        while (candidato < m)
+        {
+            int columna = posicionCobase[candidato];
+            if (columna >= 0 && costos[columna] < -TOL_CARA)
+            {
+                // Solo las columnas de costo negativo pueden llevar a un hijo
+                int fila = filaSaliente(columna);
+                if (fila < 0)
+                {
+                    noAcotada = true;
+                }
+                else if (esHijo(columna, fila))
+                {
+                    pivotear(fila, columna);
+                    profundidad++;
+                    candidato = 0;
+                    return true;
+                }
+            }
+            else if (columna >= 0 && !noAcotada && !tienePositivo(columna))
+            {
+                noAcotada = true;
+            }
+            candidato++;
+        }
+
+        if (profundidad == 0)
+            return false;
+
+        // Volver al padre: regla de Bland (menor índice con costo reducido positivo)
+        int columna = -1;
+        for (int holgura = 0; holgura < m && columna < 0; holgura++)
+        {
+            int j = posicionCobase[holgura];
+            if (j >= 0 && costos[j] > TOL_CARA)
+                columna = j;
+        }
+        int fila = columna >= 0 ? filaSaliente(columna) : -1;
+        if (fila < 0)
+        {
+            throw runtime_error("La búsqueda inversa perdió el camino a la raíz por errores numéricos.");
+        }
+        int anterior = basicas[fila];
+        pivotear(fila, columna);
+        profundidad--;
+        candidato = anterior + 1;
+    }
+}
+
+bool EnumeradorOptimos::buscar(vector<double> &x)
+{
+    if (terminado)
+        return false;
+    if (!iniciado)
+    {
+        iniciado = true;
+        if (d == 0 || esLexicoMinimo())
+        {
+            verticeActual(x);
+            terminado = d == 0;
+            return true;
+        }
+    }
+    while (avanzar())
+    {
+        if (esLexicoMinimo())
+        {
+            verticeActual(x);
+            return true;
+        }
+    }
+    terminado = true;
+    return false;
+}
+
+void EnumeradorOptimos::verticeActual(vector<double> &x) const
+{
+    x = origen;
+    for (int k = 0; k < d; k++)
+    {
+        double y = lado[m - d + k];
+        if (y == 0.0)
+            continue;
+        for (int j = 0; j < n; j++)
+            x[j] += direcciones[static_cast<size_t>(j) * d + k] * y;
+    }
+}
+
+bool EnumeradorOptimos::siguiente(vector<double> &x)
+{
+    if (entregados >= limite)
+        return false;
+    if (!adelantados.empty())
+    {
+        x = adelantados.front();
+        adelantados.erase(adelantados.begin());
+        entregados++;
+        return true;
+    }
+    if (!buscar(x))
+        return false;
+    entregados++;
+    return true;
+}
+
+bool EnumeradorOptimos::hayOptimosAlternativos()
+{
+    vector<double> x;
+    while (entregados + adelantados.size() < 2 && buscar(x))
+        adelantados.push_back(x);
+    return entregados + adelantados.size() >= 2 || noAcotada;
+}
+
+/**
+ * Muestra los planes de producción con la misma ganancia que la solución
+ * @param modelo Modelo de dos variables
+ * @param solucion Solución óptima (un vértice de la región factible)
+ * @param limite Máximo de planes a mostrar
+ */
+void mostrarPlanesAlternativos(const ModeloProduccion &modelo, const SolucionOptima &solucion, size_t limite)
+{
+    if (!solucion.solucionEncontrada)
+        return;
+
+    try
+    {
+        EnumeradorOptimos enumerador(construirModeloLineal(modelo), {solucion.x1, solucion.x2}, limite);
+        if (!enumerador.hayOptimosAlternativos())
+            return;
+
+        cout << "\nPlanes con la misma ganancia (la ganancia es paralela a una restricción activa):" << endl;
+        vector<double> x;
+        while (enumerador.siguiente(x))
+        {
+            cout << "  • " << x[0] << " mesas y " << x[1] << " sillas" << endl;
+        }
+        if (enumerador.esNoAcotada())
+            cout << "El lado óptimo no tiene fin: la ganancia se mantiene al alejarse del último plan." << endl;
+        else
+            cout << "Cualquier combinación sobre el lado que une estos planes también es óptima." << endl;
+    }
+    catch (const exception &e)
+    {
+        mostrarMensajeError("No se pudieron buscar planes alternativos: " + string(e.what()));
+    }
+}
+
+/**
+ * Enumera caras óptimas de distinto tamaño y verifica que cada vértice
+ * aparezca una vez, con la ganancia óptima
+ */
+void ejecutarBenchmarkAlternativos()
+{
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: ENUMERACIÓN DE ÓPTIMOS ALTERNATIVOS" << endl;
+    cout << string(60, '=') << endl;
+
+    // Flair con precios proporcionales a las horas de carpintería: el lado
+    // entre (30, 40) y (15, 60) es óptimo
+    ModeloProduccion flair;
+    flair.precioMesa = 80.0;
+    flair.precioSilla = 60.0;
+    flair.restricciones.push_back(4 * X1 + 3 * X2 <= 240);
+    flair.restricciones.push_back(2 * X1 + X2 <= 100);
+    flair.restricciones.push_back(X2 <= 60);
+    ArenaMonotona arena;
+    SolucionOptima solucion = resolverPuntosExtremos(flair.restricciones, flair.precioMesa, flair.precioSilla, &arena);
+    cout << "Flair con mesas a $80 y sillas a $60 (ganancia $" << solucion.gananciaMaxima << "):";
+    mostrarPlanesAlternativos(flair, solucion);
+
+    // Mezcla de n productos con la misma ganancia unitaria y capacidad para k:
+    // la cara óptima tiene C(n, k) vértices
+    auto construirMezcla = [](int productos, int capacidad, ModeloLineal &modelo, vector<double> &optimo)
+    {
+        modelo = ModeloLineal();
+        vector<pair<int, double>> fila;
+        for (int j = 0; j < productos; j++)
+        {
+            modelo.agregarVariable(1.0, 0.0, 1.0);
+            fila.push_back(make_pair(j, 1.0));
+        }
+        modelo.agregarFila(fila, "<=", capacidad);
+        ResolvedorSimplex simplex;
+        simplex.cargar(modelo);
+        simplex.resolver();
+        optimo = simplex.getValores();
+    };
+
+    ModeloLineal mezcla;
+    vector<double> optimo;
+    construirMezcla(16, 8, mezcla, optimo);
+    EnumeradorOptimos completo(mezcla, optimo, 1000000);
+    unordered_set<string> distintos;
+    size_t conOtraGanancia = 0;
+    vector<double> x;
+    auto inicio = chrono::steady_clock::now();
+    while (completo.siguiente(x))
+    {
+        string clave;
+        double ganancia = 0.0;
+        for (double valor : x)
+        {
+            clave += valor > 0.5 ? '1' : '0';
+            ganancia += valor;
+        }
+        distintos.insert(clave);
+        if (abs(ganancia - 8.0) > 1e-6)
+            conOtraGanancia++;
+    }
+    double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    cout << "\nMezcla de 16 productos con capacidad para 8 (cara de dimensión " << completo.getDimension() << "):" << endl;
+    cout << "  • Vértices: " << completo.getEntregados() << " (esperados 12870), distintos: " << distintos.size()
+         << endl;
+    cout << "  • Tiempo: " << segundos * 1000 << " ms" << endl;
+    if (completo.getEntregados() != 12870 || distintos.size() != 12870 || conOtraGanancia > 0)
+    {
+        mostrarMensajeError("La enumeración no coincide con los vértices de la cara óptima.");
+    }
+
+    // Cara enorme: C(40, 20) ≈ 1.4·10¹¹ vértices; se recorren solo los primeros
+    construirMezcla(40, 20, mezcla, optimo);
+    EnumeradorOptimos parcial(mezcla, optimo, 20000);
+    inicio = chrono::steady_clock::now();
+    while (parcial.siguiente(x))
+    {
+    }
+    segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    cout << "\nMezcla de 40 productos con capacidad para 20 (≈1.4·10¹¹ vértices óptimos):" << endl;
+    cout << "  • Entregados hasta el límite: " << parcial.getEntregados()
+         << (parcial.alcanzoLimite() ? " (límite alcanzado)" : "") << endl;
+    cout << "  • Tiempo: " << segundos * 1000 << " ms ("
+         << static_cast<long long>(parcial.getEntregados() / max(segundos, 1e-9)) << " vértices/s)" << endl;
+    cout << "  • Memoria: un diccionario de " << parcial.getDimension()
+         << " columnas; los vértices entregados no se guardan" << endl;
+}
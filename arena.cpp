@@ -0,0 +1,144 @@
+/**
+ * MÓDULO DE MEMORIA POR CÁLCULO
+ * Arena monótona para los temporales del solucionador y de la geometría,
+ * y una medición de las asignaciones de memoria por cálculo
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
+
+using namespace std;
+
+// Constructor
+ArenaMonotona::ArenaMonotona(size_t tamanoInicial, pmr::memory_resource *superior)
+    : bloqueActual(0), desplazamiento(0), tamanoInicial(max<size_t>(tamanoInicial, 256)), superior(superior)
+{
+}
+
+// Destructor: devuelve todos los bloques al recurso superior
+ArenaMonotona::~ArenaMonotona()
+{
+    for (const auto &bloque : bloques)
+    {
+        superior->deallocate(bloque.datos, bloque.capacidad, alignof(max_align_t));
+    }
+}
+
+void *ArenaMonotona::do_allocate(size_t bytes, size_t alineacion)
+{
+    // Buscar espacio en el bloque actual o en los siguientes ya reservados
+    while (bloqueActual < bloques.size())
+    {
+        Bloque &bloque = bloques[bloqueActual];
+        uintptr_t base = reinterpret_cast<uintptr_t>(bloque.datos);
+        uintptr_t alineada = (base + desplazamiento + alineacion - 1) & ~(static_cast<uintptr_t>(alineacion) - 1);
+        size_t inicio = alineada - base;
+
+        if (inicio + bytes <= bloque.capacidad)
+        {
+            desplazamiento = inicio + bytes;
+            return bloque.datos + inicio;
+        }
+
+        bloqueActual++;
+        desplazamiento = 0;
+    }
+
+    // Reservar un bloque nuevo (el doble del anterior, o lo necesario si es más grande)
+    size_t capacidad = bloques.empty() ? tamanoInicial : bloques.back().capacidad * 2;
+    capacidad = max(capacidad, bytes + alineacion);
+
+    Bloque nuevo;
+    nuevo.datos = static_cast<char *>(superior->allocate(capacidad, alignof(max_align_t)));
+    nuevo.capacidad = capacidad;
+    bloques.push_back(nuevo);
+    bloqueActual = bloques.size() - 1;
+
+    uintptr_t base = reinterpret_cast<uintptr_t>(nuevo.datos);
+    uintptr_t alineada = (base + alineacion - 1) & ~(static_cast<uintptr_t>(alineacion) - 1);
+    size_t inicio = alineada - base;
+    desplazamiento = inicio + bytes;
+    return nuevo.datos + inicio;
+}
+
+size_t ArenaMonotona::getBytesReservados() const
+{
+    size_t total = 0;
+    for (const auto &bloque : bloques)
+    {
+        total += bloque.capacidad;
+    }
+    return total;
+}
+
+/**
+ * Compara las asignaciones al heap por cálculo usando memoria directa
+ * del heap frente a una arena que se reinicia entre cálculos, y lo mismo
+ * para la geometría y las etiquetas de cada cuadro del gráfico
+ * @param numCalculos Cantidad de cálculos a repetir en cada modo
+ */
+void ejecutarBenchmarkArena(size_t numCalculos)
+{
+    // Modelo del caso Flair Furniture con algunas restricciones adicionales
+    vector<Restriccion> restricciones;
+    restricciones.push_back(Restriccion(4.0, 3.0, 240.0));
+    restricciones.push_back(Restriccion(2.0, 1.0, 100.0));
+    restricciones.push_back(Restriccion(0.0, 1.0, 60.0));
+    restricciones.push_back(Restriccion(1.0, 2.0, 150.0));
+    restricciones.push_back(Restriccion(3.0, 1.0, 135.0));
+    restricciones.push_back(Restriccion(1.0, 0.0, 0.0, ">="));
+    restricciones.push_back(Restriccion(0.0, 1.0, 0.0, ">="));
+
+    double control = 0;
+
+    // Sin arena: cada cálculo pide su memoria al heap
+    ContadorAsignaciones contadorHeap;
+    auto inicio = chrono::steady_clock::now();
+    for (size_t i = 0; i < numCalculos; i++)
+    {
+        control += resolverPuntosExtremos(restricciones, 70.0 + (i % 7), 50.0, &contadorHeap).gananciaMaxima;
+    }
+    double segundosHeap = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    // Con arena: los bloques se reservan una vez y se reutilizan
+    ContadorAsignaciones contadorArena;
+    ArenaMonotona arena(16 * 1024, &contadorArena);
+    inicio = chrono::steady_clock::now();
+    for (size_t i = 0; i < numCalculos; i++)
+    {
+        arena.reiniciar();
+        control += resolverPuntosExtremos(restricciones, 70.0 + (i % 7), 50.0, &arena).gananciaMaxima;
+    }
+    double segundosArena = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: ASIGNACIONES DE MEMORIA POR CÁLCULO" << endl;
+    cout << string(60, '=') << endl;
+    cout << "Cálculos por modo: " << numCalculos << " (" << restricciones.size() << " restricciones)" << endl;
+    cout << "\nSin arena:" << endl;
+    cout << "  • Asignaciones por cálculo: " << static_cast<double>(contadorHeap.asignaciones) / numCalculos << endl;
+    cout << "  • Tiempo por cálculo: " << segundosHeap * 1e9 / numCalculos << " ns" << endl;
+    cout << "\nCon arena:" << endl;
+    cout << "  • Asignaciones por cálculo: " << static_cast<double>(contadorArena.asignaciones) / numCalculos << endl;
+    cout << "  • Asignaciones totales: " << contadorArena.asignaciones << endl;
+    cout << "  • Tiempo por cálculo: " << segundosArena * 1e9 / numCalculos << " ns" << endl;
+
+    // Cuadros del gráfico: calcularPuntosRecta, encontrarVerticesAreaFactible y formatearNumero
+    size_t numCuadros = max<size_t>(1, numCalculos / 10);
+    MedicionCuadros cuadrosAntes = medirCuadrosGrafico(numCuadros, false);
+    MedicionCuadros cuadrosArena = medirCuadrosGrafico(numCuadros, true);
+    control += cuadrosAntes.control + cuadrosArena.control;
+
+    cout << "\nCuadros del gráfico: " << numCuadros << " (rectas, área factible y etiquetas)" << endl;
+    cout << "\nVectores del heap y ostringstream (esquema anterior):" << endl;
+    cout << "  • Asignaciones por cuadro: " << static_cast<double>(cuadrosAntes.asignaciones) / numCuadros << endl;
+    cout << "  • Tiempo por cuadro: " << cuadrosAntes.segundos * 1e9 / numCuadros << " ns" << endl;
+    cout << "\nArena por cuadro y snprintf:" << endl;
+    cout << "  • Asignaciones por cuadro: " << static_cast<double>(cuadrosArena.asignaciones) / numCuadros << endl;
+    cout << "  • Tiempo por cuadro: " << cuadrosArena.segundos * 1e9 / numCuadros << " ns" << endl;
+    cout << "\n(Control: " << control << ")" << endl;
+}
@@ -0,0 +1,445 @@
+/**
+ * MÓDULO DE CORTE DE MADERA
+ * Problema de corte de tablones por generación de columnas: el maestro
+ * lineal se resuelve con el símplex revisado y cada patrón nuevo sale de
+ * una mochila acotada sobre los duales de la demanda
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+#include <map>
+
+using namespace std;
+
+static const double TOL_CORTE = 1e-9;
+static const int MAX_RONDAS_CORTE = 10000;
+
+// Los largos se miden en milímetros enteros; cada pieza se redondea hacia arriba
+static long long milimetrosPieza(double largo, double anchoCorte)
+{
+    return static_cast<long long>(ceil(largo + anchoCorte - TOL_CORTE));
+}
+
+/**
+ * Mochila acotada 0/1 sobre grupos binarios de cada pieza
+ * @param valores Valor dual de cada pieza
+ * @param pesos Milímetros que ocupa cada pieza (corte incluido)
+ * @param limites Máximo de piezas de cada tipo en el patrón
+ * @param capacidad Milímetros útiles del tablón (corte incluido)
+ * @param cantidades Piezas de cada tipo del mejor patrón
+ * @return Valor del mejor patrón
+ */
+static double resolverMochila(const vector<double> &valores, const vector<long long> &pesos,
+                              const vector<long long> &limites, long long capacidad, vector<int> &cantidades)
+{
+    // Cada pieza se divide en grupos de 1, 2, 4, ... unidades
+    struct Grupo
+    {
+        int pieza;
+        int unidades;
+    };
+    vector<Grupo> grupos;
+    for (size_t i = 0; i < valores.size(); i++)
+    {
+        if (valores[i] <= TOL_CORTE)
+            continue;
+        long long restante = min(limites[i], capacidad / pesos[i]);
+        for (long long tamano = 1; restante > 0; tamano *= 2)
+        {
+            long long unidades = min(tamano, restante);
+            grupos.push_back(Grupo{static_cast<int>(i), static_cast<int>(unidades)});
+            restante -= unidades;
+        }
+    }
+
+    size_t ancho = static_cast<size_t>(capacidad) + 1;
+    vector<double> mejor(ancho, 0.0);
+    vector<char> tomado(grupos.size() * ancho, 0);
+    for (size_t g = 0; g < grupos.size(); g++)
+    {
+        long long peso = pesos[grupos[g].pieza] * grupos[g].unidades;
+        double valor = valores[grupos[g].pieza] * grupos[g].unidades;
+        char *fila = &tomado[g * ancho];
+        for (long long c = capacidad; c >= peso; c--)
+        {
+            double candidato = mejor[c - peso] + valor;
+            if (candidato > mejor[c])
+            {
+                mejor[c] = candidato;
+                fila[c] = 1;
+            }
+        }
+    }
+
+    cantidades.assign(valores.size(), 0);
+    long long c = capacidad;
+    for (size_t g = grupos.size(); g-- > 0;)
+    {
+        if (tomado[g * ancho + c])
+        {
+            cantidades[grupos[g].pieza] += grupos[g].unidades;
+            c -= pesos[grupos[g].pieza] * grupos[g].unidades;
+        }
+    }
+    return mejor[capacidad];
+}
+
+// Completa la demanda que dejó el redondeo hacia abajo con primer ajuste decreciente
+static vector<vector<int>> cubrirResiduo(const vector<long long> &pesos, const vector<long long> &residuo, long long capacidad)
+{
+    vector<int> orden(pesos.size());
+    for (size_t i = 0; i < orden.size(); i++)
+        orden[i] = static_cast<int>(i);
+    sort(orden.begin(), orden.end(), [&pesos](int a, int b) { return pesos[a] > pesos[b]; });
+
+    vector<vector<int>> tablones;
+    vector<long long> libre;
+    for (int i : orden)
+    {
+        for (long long k = 0; k < residuo[i]; k++)
+        {
+            size_t t = 0;
+            while (t < tablones.size() && libre[t] < pesos[i])
+                t++;
+            if (t == tablones.size())
+            {
+                tablones.push_back(vector<int>(pesos.size(), 0));
+                libre.push_back(capacidad);
+            }
+            tablones[t][i]++;
+            libre[t] -= pesos[i];
+        }
+    }
+    return tablones;
+}
+
+/**
+ * Resuelve el problema de corte: mínimo de tablones que cubren la demanda
+ * @param largoTablon Largo del tablón de stock (mm)
+ * @param anchoCorte Material que se pierde en cada corte (mm)
+ * @param largos Largo de cada tipo de pieza (mm)
+ * @param demandas Piezas necesarias de cada tipo
+ * @param token Cancelación o límite de tiempo (opcional)
+ * @return Patrones con su uso en la relajación y en el plan entero
+ */
+ResultadoCorte resolverCorteMadera(double largoTablon, double anchoCorte, const vector<double> &largos,
+                                   const vector<long long> &demandas, const TokenCancelacion *token)
+{
+    TRAZA_AMBITO("corte.resolver", "calculo");
+
+    if (largos.size() != demandas.size())
+    {
+        throw invalid_argument("Cada pieza debe tener su demanda.");
+    }
+    if (!(largoTablon > 0) || anchoCorte < 0)
+    {
+        throw invalid_argument("El largo del tablón debe ser positivo y el ancho de corte no negativo.");
+    }
+
+    size_t numPiezas = largos.size();
+    long long capacidad = static_cast<long long>(floor(largoTablon + anchoCorte + TOL_CORTE));
+    vector<long long> pesos(numPiezas);
+    for (size_t i = 0; i < numPiezas; i++)
+    {
+        if (!(largos[i] > 0) || demandas[i] < 0)
+        {
+            throw invalid_argument("Los largos deben ser positivos y las demandas no negativas.");
+        }
+        pesos[i] = milimetrosPieza(largos[i], anchoCorte);
+        if (pesos[i] > capacidad)
+        {
+            throw invalid_argument("Hay piezas más largas que el tablón.");
+        }
+    }
+
+    ResultadoCorte resultado;
+    vector<vector<int>> patrones;
+
+    // Maestro: maximizar -Σ tablones con Σ a_ip · y_p >= demanda_i.
+    // Arranca con un patrón homogéneo por pieza.
+    ModeloLineal maestro;
+    vector<vector<pair<int, double>>> filas(numPiezas);
+    for (size_t i = 0; i < numPiezas; i++)
+    {
+        long long porTablon = min(capacidad / pesos[i], demandas[i]);
+        if (porTablon == 0)
+            continue;
+        vector<int> patron(numPiezas, 0);
+        patron[i] = static_cast<int>(porTablon);
+        int j = maestro.agregarVariable(-1.0);
+        filas[i].push_back(make_pair(j, static_cast<double>(porTablon)));
+        patrones.push_back(patron);
+    }
+    for (size_t i = 0; i < numPiezas; i++)
+    {
+        maestro.agregarFila(filas[i], ">=", static_cast<double>(demandas[i]));
+    }
+
+    ResolvedorSimplex resolvedor;
+    resolvedor.cargar(maestro);
+
+    vector<double> valores(numPiezas);
+    vector<int> cantidades;
+    while (true)
+    {
+        resultado.estado = resolvedor.resolver(token);
+        resultado.rondas++;
+        if (resultado.estado != LP_OPTIMO)
+        {
+            return resultado;
+        }
+
+        // El dual de cada fila es <= 0: cubrir una pieza más cuesta tablones
+        for (size_t i = 0; i < numPiezas; i++)
+        {
+            valores[i] = max(0.0, -resolvedor.getDual(static_cast<int>(i)));
+        }
+
+        // Un patrón mejora al maestro si sus piezas valen más que un tablón
+        double valor = resolverMochila(valores, pesos, demandas, capacidad, cantidades);
+        if (valor <= 1.0 + TOL_CORTE || resultado.rondas >= MAX_RONDAS_CORTE)
+        {
+            break;
+        }
+
+        vector<pair<int, double>> columna;
+        for (size_t i = 0; i < numPiezas; i++)
+        {
+            if (cantidades[i] > 0)
+                columna.push_back(make_pair(static_cast<int>(i), static_cast<double>(cantidades[i])));
+        }
+        resolvedor.agregarVariable(-1.0, 0.0, INFINITO_LP, columna);
+        patrones.push_back(cantidades);
+        resultado.columnasGeneradas++;
+
+        if (token)
+        {
+            token->verificar();
+        }
+    }
+
+    resultado.cotaInferior = -resolvedor.getValorObjetivo();
+
+    // Plan entero: parte entera de la relajación y el resto con primer ajuste decreciente
+    vector<double> usoRelajado(patrones.size());
+    vector<long long> usoEntero(patrones.size());
+    vector<long long> residuo(demandas);
+    for (size_t p = 0; p < patrones.size(); p++)
+    {
+        usoRelajado[p] = resolvedor.getValor(static_cast<int>(p));
+        usoEntero[p] = static_cast<long long>(floor(usoRelajado[p] + 1e-6));
+        for (size_t i = 0; i < numPiezas; i++)
+            residuo[i] -= usoEntero[p] * patrones[p][i];
+    }
+    for (auto &r : residuo)
+        r = max(0LL, r);
+
+    // Los tablones iguales del residuo se agrupan en un solo patrón
+    map<vector<int>, long long> extra;
+    for (const auto &tablon : cubrirResiduo(pesos, residuo, capacidad))
+        extra[tablon]++;
+
+    for (size_t p = 0; p < patrones.size(); p++)
+    {
+        auto it = extra.find(patrones[p]);
+        if (it != extra.end())
+        {
+            usoEntero[p] += it->second;
+            extra.erase(it);
+        }
+    }
+    for (const auto &tablon : extra)
+    {
+        patrones.push_back(tablon.first);
+        usoRelajado.push_back(0.0);
+        usoEntero.push_back(tablon.second);
+    }
+
+    // Solo se informan los patrones que se usan
+    for (size_t p = 0; p < patrones.size(); p++)
+    {
+        if (usoEntero[p] == 0 && usoRelajado[p] <= TOL_CORTE)
+            continue;
+
+        PatronCorte patron;
+        patron.cantidades = patrones[p];
+        patron.desperdicio = largoTablon;
+        for (size_t i = 0; i < numPiezas; i++)
+            patron.desperdicio -= patrones[p][i] * largos[i];
+        resultado.patrones.push_back(patron);
+        resultado.usoRelajado.push_back(usoRelajado[p]);
+        resultado.usoEntero.push_back(usoEntero[p]);
+        resultado.tablones += usoEntero[p];
+    }
+    return resultado;
+}
+
+// Tablones por unidad de un mueble (según su plan de corte para un lote)
+static double tablonesPorUnidad(const ModeloMadera &modelo, bool mesa, long long lote)
+{
+    vector<double> largos;
+    vector<long long> demandas;
+    for (const auto &pieza : modelo.piezas)
+    {
+        int porUnidad = mesa ? pieza.porMesa : pieza.porSilla;
+        if (porUnidad < 0)
+        {
+            throw invalid_argument("La pieza '" + pieza.nombre + "' tiene una cantidad negativa.");
+        }
+        if (porUnidad == 0)
+            continue;
+        largos.push_back(pieza.largo);
+        demandas.push_back(porUnidad * lote);
+    }
+    if (largos.empty())
+    {
+        return 0.0;
+    }
+
+    ResultadoCorte resultado = resolverCorteMadera(modelo.largoTablon, modelo.anchoCorte, largos, demandas);
+    if (resultado.estado != LP_OPTIMO)
+    {
+        throw runtime_error("No se pudo calcular el plan de corte.");
+    }
+    return static_cast<double>(resultado.tablones) / lote;
+}
+
+/**
+ * Convierte el consumo de madera en una restricción del modelo de producción
+ * @param modelo Tablones, piezas por mueble y tablones disponibles
+ * @param loteReferencia Muebles de cada tipo con los que se calcula el consumo
+ * @return Restricción de tablones sobre (mesas, sillas)
+ */
+Restriccion construirRestriccionMadera(const ModeloMadera &modelo, long long loteReferencia)
+{
+    if (loteReferencia <= 0)
+    {
+        throw invalid_argument("El lote de referencia debe ser positivo.");
+    }
+    if (modelo.tablonesDisponibles < 0)
+    {
+        throw invalid_argument("Los tablones disponibles no pueden ser negativos.");
+    }
+
+    return Restriccion(tablonesPorUnidad(modelo, true, loteReferencia), tablonesPorUnidad(modelo, false, loteReferencia),
+                       modelo.tablonesDisponibles);
+}
+
+ModeloMadera crearModeloMaderaFlair()
+{
+    ModeloMadera modelo;
+    modelo.piezas.push_back(PiezaMadera("Listón de cubierta", 1200.0, 4, 0));
+    modelo.piezas.push_back(PiezaMadera("Pata de mesa", 720.0, 4, 0));
+    modelo.piezas.push_back(PiezaMadera("Faldón largo", 1050.0, 2, 0));
+    modelo.piezas.push_back(PiezaMadera("Faldón corto", 650.0, 2, 0));
+    modelo.piezas.push_back(PiezaMadera("Pata trasera", 900.0, 0, 2));
+    modelo.piezas.push_back(PiezaMadera("Pata delantera", 450.0, 0, 2));
+    modelo.piezas.push_back(PiezaMadera("Listón de asiento", 420.0, 0, 3));
+    modelo.piezas.push_back(PiezaMadera("Travesaño", 380.0, 0, 4));
+    modelo.piezas.push_back(PiezaMadera("Respaldo", 400.0, 0, 2));
+    return modelo;
+}
+
+/**
+ * Plan de corte para la producción óptima de Flair, restricción de madera
+ * en el modelo de producción y una instancia grande para medir tiempos
+ */
+void ejecutarBenchmarkCorte()
+{
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: CORTE DE MADERA (GENERACIÓN DE COLUMNAS)" << endl;
+    cout << string(60, '=') << endl;
+
+    // Las restricciones del caso Flair que carga el menú
+    vector<Restriccion> restricciones;
+    restricciones.push_back(4 * X1 + 3 * X2 <= 240);
+    restricciones.push_back(2 * X1 + X2 <= 100);
+    restricciones.push_back(X2 <= 60);
+    restricciones.push_back(X1 >= 0);
+    restricciones.push_back(X2 >= 0);
+    ArenaMonotona arena;
+    SolucionOptima produccion = resolverPuntosExtremos(restricciones, 70.0, 50.0, &arena);
+
+    ModeloMadera madera = crearModeloMaderaFlair();
+    vector<double> largos;
+    vector<long long> demandas;
+    long long homogeneo = 0;
+    long long capacidad = static_cast<long long>(floor(madera.largoTablon + madera.anchoCorte + TOL_CORTE));
+    for (const auto &pieza : madera.piezas)
+    {
+        long long demanda = static_cast<long long>(llround(pieza.porMesa * produccion.x1 + pieza.porSilla * produccion.x2));
+        largos.push_back(pieza.largo);
+        demandas.push_back(demanda);
+        long long porTablon = capacidad / milimetrosPieza(pieza.largo, madera.anchoCorte);
+        homogeneo += (demanda + porTablon - 1) / porTablon;
+    }
+
+    auto inicio = chrono::steady_clock::now();
+    ResultadoCorte plan = resolverCorteMadera(madera.largoTablon, madera.anchoCorte, largos, demandas);
+    double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    cout << "Producción de Flair: " << produccion.x1 << " mesas y " << produccion.x2 << " sillas" << endl;
+    cout << "  • Un largo por tablón: " << homogeneo << " tablones" << endl;
+    cout << "  • Generación de columnas: " << plan.tablones << " tablones (cota lineal " << plan.cotaInferior << ")" << endl;
+    cout << "  • Patrones usados: " << plan.patrones.size() << ", columnas generadas: " << plan.columnasGeneradas
+         << ", rondas: " << plan.rondas << ", tiempo: " << segundos * 1000 << " ms" << endl;
+    for (size_t p = 0; p < plan.patrones.size(); p++)
+    {
+        cout << "    " << plan.usoEntero[p] << " × [";
+        bool primero = true;
+        for (size_t i = 0; i < largos.size(); i++)
+        {
+            if (plan.patrones[p].cantidades[i] == 0)
+                continue;
+            cout << (primero ? "" : ", ") << plan.patrones[p].cantidades[i] << " " << madera.piezas[i].nombre;
+            primero = false;
+        }
+        cout << "], desperdicio " << plan.patrones[p].desperdicio << " mm" << endl;
+    }
+
+    // Con menos tablones que los del plan, la madera pasa a limitar la producción
+    madera.tablonesDisponibles = floor(plan.tablones * 0.8);
+    Restriccion restriccionMadera = construirRestriccionMadera(madera);
+    restricciones.push_back(restriccionMadera);
+    arena.reiniciar();
+    SolucionOptima conMadera = resolverPuntosExtremos(restricciones, 70.0, 50.0, &arena);
+
+    cout << "\nRestricción de madera: " << restriccionMadera.coeficienteX1 << "x₁ + " << restriccionMadera.coeficienteX2
+         << "x₂ <= " << restriccionMadera.valorConstante << " tablones" << endl;
+    if (conMadera.solucionEncontrada)
+    {
+        cout << "  • Antes: Z = $" << produccion.gananciaMaxima << ", con la madera: " << conMadera.x1 << " mesas, "
+             << conMadera.x2 << " sillas, Z = $" << conMadera.gananciaMaxima << endl;
+    }
+    else
+    {
+        mostrarMensajeError("El modelo con la restricción de madera no tiene solución.");
+    }
+
+    // Instancia grande: 60 largos distintos con demandas de cientos de piezas
+    unsigned long long semilla = 2024;
+    auto siguiente = [&semilla]()
+    {
+        semilla = semilla * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<double>(semilla >> 11) / 9007199254740992.0;
+    };
+    largos.clear();
+    demandas.clear();
+    for (int i = 0; i < 60; i++)
+    {
+        largos.push_back(floor(150.0 + 1000.0 * siguiente()));
+        demandas.push_back(static_cast<long long>(50 + 950 * siguiente()));
+    }
+
+    inicio = chrono::steady_clock::now();
+    ResultadoCorte grande = resolverCorteMadera(madera.largoTablon, madera.anchoCorte, largos, demandas);
+    segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    cout << "\nInstancia de 60 largos:" << endl;
+    cout << "  • " << grande.tablones << " tablones (cota lineal " << grande.cotaInferior << "), "
+         << grande.columnasGeneradas << " columnas generadas en " << grande.rondas << " rondas" << endl;
+    cout << "  • Tiempo: " << segundos * 1000 << " ms" << endl;
+}
@@ -0,0 +1,765 @@
+/**
+ * MÓDULO DE PLANOS DE CORTE
+ * Separación de cortes de Gomory entero-mixto, de redondeo entero-mixto (MIR)
+ * y de cubiertas de mochila para el modo entero, y pool de cortes compartido
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <cmath>
+#include <random>
+
+using namespace std;
+
+static const double TOL_CORTE = 1e-6;      // Violación mínima de un corte
+static const double EFICACIA_MINIMA = 1e-4; // Violación mínima dividida por la norma del corte
+static const double FRACCION_MINIMA = 0.01; // Parte fraccionaria mínima del lado para redondear
+static const double RANGO_MAXIMO = 1e6;     // Cociente máximo entre coeficientes de un corte
+
+// Suma FNV-1a de 64 bits de un valor
+template <typename T>
+static uint64_t sumarFnv(uint64_t suma, const T &valor)
+{
+    const unsigned char *datos = reinterpret_cast<const unsigned char *>(&valor);
+    for (size_t i = 0; i < sizeof(T); i++)
+    {
+        suma ^= datos[i];
+        suma *= 1099511628211ULL;
+    }
+    return suma;
+}
+
+uint64_t calcularFirmaFactible(const ModeloLineal &modelo, const vector<int> &variablesEnteras)
+{
+    uint64_t suma = 1469598103934665603ULL;
+    for (int j = 0; j < modelo.getNumVariables(); j++)
+    {
+        suma = sumarFnv(suma, modelo.cotaInferior[j]);
+        suma = sumarFnv(suma, modelo.cotaSuperior[j]);
+    }
+    for (int i = 0; i < modelo.getNumFilas(); i++)
+    {
+        for (const auto &coeficiente : modelo.filas[i])
+        {
+            suma = sumarFnv(suma, coeficiente.first);
+            suma = sumarFnv(suma, coeficiente.second);
+        }
+        suma = sumarFnv(suma, modelo.filaInferior[i]);
+        suma = sumarFnv(suma, modelo.filaSuperior[i]);
+    }
+    for (int j : variablesEnteras)
+        suma = sumarFnv(suma, j);
+    for (const auto &costo : modelo.costosPorTramos)
+    {
+        suma = sumarFnv(suma, costo.variable);
+        suma = sumarFnv(suma, costo.funcion.puntos.front());
+        suma = sumarFnv(suma, costo.funcion.puntos.back());
+    }
+    return suma;
+}
+
+// ===== POOL DE CORTES =====
+
+PoolCortes::PoolCortes(size_t capacidad, int edadMaxima)
+    : firmaModelo(0), capacidad(capacidad), edadMaxima(edadMaxima), agregados(0), repetidos(0), descartados(0)
+{
+    if (capacidad == 0)
+    {
+        throw invalid_argument("El pool de cortes necesita capacidad para al menos un corte.");
+    }
+}
+
+void PoolCortes::vincularModelo(uint64_t firma)
+{
+    lock_guard<mutex> lock(mtx);
+    if (firmaModelo != 0 && firmaModelo != firma && !cortes.empty())
+    {
+        throw invalid_argument("El pool tiene cortes de un modelo con otras filas o cotas.");
+    }
+    firmaModelo = firma;
+}
+
+bool PoolCortes::agregar(Corte corte)
+{
+    lock_guard<mutex> lock(mtx);
+    auto existente = indice.find(corte.firma);
+    if (existente != indice.end() && cortes[existente->second].coeficientes == corte.coeficientes)
+    {
+        Corte &guardado = cortes[existente->second];
+        guardado.lado = min(guardado.lado, corte.lado);
+        guardado.edad = 0;
+        repetidos++;
+        return false;
+    }
+
+    if (cortes.size() >= capacidad)
+    {
+        // Sin lugar: sale el corte que lleva más tiempo sin usarse
+        size_t masViejo = 0;
+        for (size_t k = 1; k < cortes.size(); k++)
+        {
+            if (cortes[k].edad > cortes[masViejo].edad)
+                masViejo = k;
+        }
+        if (indice.count(cortes[masViejo].firma) && indice[cortes[masViejo].firma] == masViejo)
+            indice.erase(cortes[masViejo].firma);
+        if (masViejo != cortes.size() - 1)
+        {
+            cortes[masViejo] = move(cortes.back());
+            auto movido = indice.find(cortes[masViejo].firma);
+            if (movido != indice.end() && movido->second == cortes.size() - 1)
+                movido->second = masViejo;
+        }
+        cortes.pop_back();
+        descartados++;
+    }
+
+    corte.edad = 0;
+    if (!indice.count(corte.firma))
+        indice[corte.firma] = cortes.size();
+    cortes.push_back(move(corte));
+    agregados++;
+    return true;
+}
+
+vector<Corte> PoolCortes::separar(const vector<double> &x, double tolerancia, size_t maximo)
+{
+    lock_guard<mutex> lock(mtx);
+    vector<pair<double, size_t>> violados;
+    for (size_t k = 0; k < cortes.size(); k++)
+    {
+        double actividad = 0.0;
+        for (const auto &coeficiente : cortes[k].coeficientes)
+        {
+            if (coeficiente.first < static_cast<int>(x.size()))
+                actividad += coeficiente.second * x[coeficiente.first];
+        }
+        double violacion = actividad - cortes[k].lado;
+        if (violacion > tolerancia)
+            violados.push_back(make_pair(-violacion, k));
+    }
+    sort(violados.begin(), violados.end());
+    if (violados.size() > maximo)
+        violados.resize(maximo);
+
+    vector<Corte> entregados;
+    for (const auto &violado : violados)
+    {
+        cortes[violado.second].edad = -1; // Queda en 0 después de envejecer
+        entregados.push_back(cortes[violado.second]);
+    }
+
+    // Envejecer y descartar los que llevan demasiado sin usarse
+    size_t escritos = 0;
+    for (size_t k = 0; k < cortes.size(); k++)
+    {
+        cortes[k].edad++;
+        if (cortes[k].edad > edadMaxima)
+        {
+            descartados++;
+            continue;
+        }
+        if (escritos != k)
+            cortes[escritos] = move(cortes[k]);
+        escritos++;
+    }
+    if (escritos != cortes.size())
+    {
+        cortes.resize(escritos);
+        indice.clear();
+        for (size_t k = 0; k < cortes.size(); k++)
+            indice.emplace(cortes[k].firma, k);
+    }
+    for (auto &entregado : entregados)
+        entregado.edad = 0;
+    return entregados;
+}
+
+size_t PoolCortes::getTamano() const
+{
+    lock_guard<mutex> lock(mtx);
+    return cortes.size();
+}
+
+long PoolCortes::getAgregados() const
+{
+    lock_guard<mutex> lock(mtx);
+    return agregados;
+}
+
+long PoolCortes::getRepetidos() const
+{
+    lock_guard<mutex> lock(mtx);
+    return repetidos;
+}
+
+long PoolCortes::getDescartados() const
+{
+    lock_guard<mutex> lock(mtx);
+    return descartados;
+}
+
+vector<Corte> PoolCortes::getCortes() const
+{
+    lock_guard<mutex> lock(mtx);
+    return cortes;
+}
+
+// ===== SEPARACIÓN =====
+
+// Datos de la relajación que comparten los separadores
+struct ContextoSeparacion
+{
+    const ResolvedorSimplex &lp;
+    const ModeloLineal &modelo;
+    const vector<bool> &esEntera;
+    vector<double> x; // Valores de las n + m variables (estructurales y lógicas)
+    int n;
+    int m;
+
+    double inferior(int k) const { return k < n ? modelo.cotaInferior[k] : modelo.filaInferior[k - n]; }
+    double superior(int k) const { return k < n ? modelo.cotaSuperior[k] : modelo.filaSuperior[k - n]; }
+    bool entera(int k) const { return k < n && esEntera[k]; }
+};
+
+// Variable de una fila reescrita sobre t = x - l (en la cota inferior) o t = u - x
+struct TerminoDesplazado
+{
+    int variable;
+    double coeficiente; // Coeficiente de t
+    bool enSuperior;
+};
+
+// Cambia cada variable por su distancia a la cota finita más cercana a su valor.
+// Devuelve false si alguna variable no tiene cotas finitas.
+static bool desplazarACotas(const ContextoSeparacion &contexto, const vector<pair<int, double>> &fila, double &lado,
+                            vector<TerminoDesplazado> &terminos)
+{
+    terminos.clear();
+    for (const auto &coeficiente : fila)
+    {
+        int k = coeficiente.first;
+        double a = coeficiente.second;
+        double l = contexto.inferior(k);
+        double u = contexto.superior(k);
+        bool usarSuperior;
+        if (isfinite(l) && isfinite(u))
+            usarSuperior = u - contexto.x[k] < contexto.x[k] - l;
+        else if (isfinite(l))
+            usarSuperior = false;
+        else if (isfinite(u))
+            usarSuperior = true;
+        else
+            return false;
+
+        if (usarSuperior)
+        {
+            lado -= a * u;
+            terminos.push_back({k, -a, true});
+        }
+        else
+        {
+            lado -= a * l;
+            terminos.push_back({k, a, false});
+        }
+    }
+    return true;
+}
+
+/**
+ * Pasa un corte Σ g_k·t_k >= 1 sobre las variables desplazadas a las variables
+ * estructurales (las lógicas se reemplazan por su fila), en la forma
+ * coeficientes·x <= lado, normalizado y con su firma
+ * @return false si el corte no es numéricamente confiable o no está violado
+ */
+static bool armarCorte(const ContextoSeparacion &contexto, const vector<TerminoDesplazado> &terminos,
+                       const vector<double> &g, double ladoT, TipoCorte tipo, Corte &corte)
+{
+    // Σ g·t >= ladoT  =>  -Σ g·t <= -ladoT, con t = x - l o t = u - x
+    vector<double> densa(contexto.n, 0.0);
+    double lado = -ladoT;
+    for (size_t t = 0; t < terminos.size(); t++)
+    {
+        double coeficiente = -g[t];
+        if (coeficiente == 0.0)
+            continue;
+        int k = terminos[t].variable;
+        if (terminos[t].enSuperior)
+        {
+            lado -= coeficiente * contexto.superior(k);
+            coeficiente = -coeficiente;
+        }
+        else
+        {
+            lado += coeficiente * contexto.inferior(k);
+        }
+
+        if (k < contexto.n)
+        {
+            densa[k] += coeficiente;
+        }
+        else
+        {
+            for (const auto &a : contexto.modelo.filas[k - contexto.n])
+                densa[a.first] += coeficiente * a.second;
+        }
+    }
+
+    // Los coeficientes despreciables se quitan corrigiendo el lado con la cota
+    double mayor = 0.0;
+    for (double valor : densa)
+        mayor = max(mayor, abs(valor));
+    if (mayor < 1e-9)
+        return false;
+
+    corte.coeficientes.clear();
+    double menor = INFINITO_LP;
+    for (int j = 0; j < contexto.n; j++)
+    {
+        double c = densa[j];
+        if (c == 0.0)
+            continue;
+        if (abs(c) < 1e-9 * mayor)
+        {
+            double cota = c > 0.0 ? contexto.modelo.cotaInferior[j] : contexto.modelo.cotaSuperior[j];
+            if (isfinite(cota))
+            {
+                lado -= c * cota;
+                continue;
+            }
+        }
+        corte.coeficientes.push_back(make_pair(j, c / mayor));
+        menor = min(menor, abs(c));
+    }
+    if (corte.coeficientes.empty() || mayor / menor > RANGO_MAXIMO)
+        return false;
+    corte.lado = lado / mayor;
+    corte.tipo = tipo;
+    corte.edad = 0;
+
+    double actividad = 0.0;
+    double norma = 0.0;
+    uint64_t firma = 1469598103934665603ULL;
+    for (const auto &coeficiente : corte.coeficientes)
+    {
+        actividad += coeficiente.second * contexto.x[coeficiente.first];
+        norma += coeficiente.second * coeficiente.second;
+        firma = sumarFnv(firma, coeficiente.first);
+        firma = sumarFnv(firma, llround(coeficiente.second * 1e9));
+    }
+    corte.firma = firma;
+    double violacion = actividad - corte.lado;
+    return violacion > TOL_CORTE && violacion / sqrt(norma) > EFICACIA_MINIMA;
+}
+
+// Gomory entero-mixto sobre la fila del tableau de una variable entera básica fraccionaria
+static bool separarGomory(const ContextoSeparacion &contexto, int posicion, Corte &corte)
+{
+    vector<double> filaTableau;
+    contexto.lp.filaTransformada(posicion, filaTableau);
+    int basica = contexto.lp.getBasica(posicion);
+
+    // x_básica + Σ α_k·x_k = 0 sobre las no básicas
+    vector<pair<int, double>> fila;
+    for (int k = 0; k < contexto.n + contexto.m; k++)
+    {
+        if (k != basica && abs(filaTableau[k]) > 1e-11)
+            fila.push_back(make_pair(k, filaTableau[k]));
+    }
+    double lado = 0.0;
+    vector<TerminoDesplazado> terminos;
+    if (!desplazarACotas(contexto, fila, lado, terminos))
+        return false;
+
+    // x_básica + Σ ā·t = lado con x_básica entera
+    double f0 = lado - floor(lado);
+    if (f0 < FRACCION_MINIMA || f0 > 1.0 - FRACCION_MINIMA)
+        return false;
+
+    vector<double> g(terminos.size());
+    for (size_t t = 0; t < terminos.size(); t++)
+    {
+        double a = terminos[t].coeficiente;
+        if (contexto.entera(terminos[t].variable))
+        {
+            double f = a - floor(a);
+            g[t] = f <= f0 ? f / f0 : (1.0 - f) / (1.0 - f0);
+        }
+        else
+        {
+            g[t] = a >= 0.0 ? a / f0 : -a / (1.0 - f0);
+        }
+    }
+    return armarCorte(contexto, terminos, g, 1.0, CORTE_GOMORY, corte);
+}
+
+// Redondeo entero-mixto de Σ a·x <= b probando varios divisores de la fila
+static bool separarMIR(const ContextoSeparacion &contexto, const vector<pair<int, double>> &fila, double b,
+                       Corte &corte)
+{
+    double lado = b;
+    vector<TerminoDesplazado> terminos;
+    if (!desplazarACotas(contexto, fila, lado, terminos))
+        return false;
+
+    // Divisores: coeficientes de las enteras que no están en su cota
+    vector<double> divisores;
+    bool hayEntera = false;
+    for (const auto &termino : terminos)
+    {
+        if (!contexto.entera(termino.variable))
+            continue;
+        hayEntera = true;
+        double distancia = termino.enSuperior ? contexto.superior(termino.variable) - contexto.x[termino.variable]
+                                              : contexto.x[termino.variable] - contexto.inferior(termino.variable);
+        double delta = abs(termino.coeficiente);
+        if (distancia > TOL_CORTE && delta > 1e-6 &&
+            find(divisores.begin(), divisores.end(), delta) == divisores.end() && divisores.size() < 8)
+            divisores.push_back(delta);
+    }
+    if (!hayEntera)
+        return false;
+    divisores.push_back(1.0);
+
+    bool encontrado = false;
+    double mejorViolacion = 0.0;
+    Corte candidato;
+    vector<double> g(terminos.size());
+    for (double delta : divisores)
+    {
+        double beta = lado / delta;
+        double f0 = beta - floor(beta);
+        if (f0 < FRACCION_MINIMA || f0 > 1.0 - FRACCION_MINIMA)
+            continue;
+
+        // Σ (⌊ā⌋ + (f - f0)⁺/(1 - f0))·t + Σ ā⁻/(1 - f0)·s <= ⌊β⌋, que pasa a la forma >=
+        for (size_t t = 0; t < terminos.size(); t++)
+        {
+            double a = terminos[t].coeficiente / delta;
+            if (contexto.entera(terminos[t].variable))
+            {
+                double f = a - floor(a);
+                g[t] = floor(a) + max(0.0, f - f0) / (1.0 - f0);
+            }
+            else
+            {
+                g[t] = a < 0.0 ? a / (1.0 - f0) : 0.0;
+            }
+            g[t] = -g[t];
+        }
+        if (!armarCorte(contexto, terminos, g, -floor(beta), CORTE_MIR, candidato))
+            continue;
+
+        double actividad = 0.0;
+        for (const auto &coeficiente : candidato.coeficientes)
+            actividad += coeficiente.second * contexto.x[coeficiente.first];
+        if (!encontrado || actividad - candidato.lado > mejorViolacion)
+        {
+            mejorViolacion = actividad - candidato.lado;
+            corte = candidato;
+            encontrado = true;
+        }
+    }
+    return encontrado;
+}
+
+// Cubierta de mochila (extendida) sobre Σ a·x <= b con todas las variables binarias
+static bool separarCubierta(const ContextoSeparacion &contexto, const vector<pair<int, double>> &fila, double b,
+                            Corte &corte)
+{
+    // Las variables con coeficiente negativo se complementan: x = 1 - y
+    struct Elemento
+    {
+        int variable;
+        double peso;
+        double valor; // y* (o x* si no está complementada)
+        bool complementada;
+    };
+    vector<Elemento> elementos;
+    double capacidad = b;
+    double total = 0.0;
+    for (const auto &coeficiente : fila)
+    {
+        int j = coeficiente.first;
+        if (!contexto.entera(j) || contexto.inferior(j) != 0.0 || contexto.superior(j) != 1.0)
+            return false;
+        if (coeficiente.second == 0.0)
+            continue;
+        bool complementada = coeficiente.second < 0.0;
+        double peso = abs(coeficiente.second);
+        if (complementada)
+            capacidad += peso;
+        elementos.push_back({j, peso, complementada ? 1.0 - contexto.x[j] : contexto.x[j], complementada});
+        total += peso;
+    }
+    if (capacidad < 0.0 || total <= capacidad + TOL_CORTE)
+        return false;
+
+    // Primero los que la relajación ya tiene casi en 1, por unidad de peso
+    sort(elementos.begin(), elementos.end(), [](const Elemento &a, const Elemento &b)
+         { return (1.0 - a.valor) / a.peso < (1.0 - b.valor) / b.peso; });
+    size_t tamano = 0;
+    double acumulado = 0.0;
+    double pesoMaximo = 0.0;
+    double suma = 0.0;
+    while (tamano < elementos.size() && acumulado <= capacidad + TOL_CORTE)
+    {
+        acumulado += elementos[tamano].peso;
+        pesoMaximo = max(pesoMaximo, elementos[tamano].peso);
+        suma += elementos[tamano].valor;
+        tamano++;
+    }
+    if (suma <= tamano - 1.0 + TOL_CORTE)
+        return false;
+
+    // Σ_C y + Σ_{peso >= pesoMaximo} y <= |C| - 1, como Σ g·t >= ... sobre t = x o t = 1 - x
+    vector<TerminoDesplazado> terminos;
+    vector<double> g;
+    for (size_t k = 0; k < elementos.size(); k++)
+    {
+        if (k >= tamano && elementos[k].peso < pesoMaximo)
+            continue;
+        // y = x (t = x - 0) o y = 1 - x (t = 1 - x, cota superior)
+        terminos.push_back({elementos[k].variable, 1.0, elementos[k].complementada});
+        g.push_back(-1.0);
+    }
+    return armarCorte(contexto, terminos, g, -(tamano - 1.0), CORTE_CUBIERTA, corte);
+}
+
+/**
+ * Separa cortes en la solución actual del símplex
+ * @param lp Símplex resuelto al óptimo de la relajación
+ * @param modelo Filas y cotas globales del LP cargado, incluidos los cortes ya agregados
+ * @param esEntera Integralidad de cada variable estructural
+ * @param parametros Separadores activos y máximo de cortes
+ * @return Cortes violados, los más violados primero
+ */
+vector<Corte> separarCortes(const ResolvedorSimplex &lp, const ModeloLineal &modelo, const vector<bool> &esEntera,
+                            const ParametrosCortes &parametros)
+{
+    if (lp.getNumFilas() != modelo.getNumFilas() || lp.getNumVariables() != modelo.getNumVariables())
+    {
+        throw invalid_argument("El modelo no corresponde al símplex cargado.");
+    }
+
+    ContextoSeparacion contexto{lp, modelo, esEntera, {}, lp.getNumVariables(), lp.getNumFilas()};
+    contexto.x.resize(contexto.n + contexto.m);
+    for (int k = 0; k < contexto.n + contexto.m; k++)
+        contexto.x[k] = lp.getValor(k);
+
+    vector<pair<double, Corte>> encontrados;
+    auto guardar = [&](const Corte &corte)
+    {
+        double actividad = 0.0;
+        for (const auto &coeficiente : corte.coeficientes)
+            actividad += coeficiente.second * contexto.x[coeficiente.first];
+        encontrados.push_back(make_pair(actividad - corte.lado, corte));
+    };
+    Corte corte;
+
+    if (parametros.gomory)
+    {
+        // Las filas más fraccionarias primero
+        vector<pair<double, int>> filas;
+        for (int posicion = 0; posicion < contexto.m; posicion++)
+        {
+            int j = lp.getBasica(posicion);
+            if (!contexto.entera(j))
+                continue;
+            double f = contexto.x[j] - floor(contexto.x[j]);
+            if (f > FRACCION_MINIMA && f < 1.0 - FRACCION_MINIMA)
+                filas.push_back(make_pair(-min(f, 1.0 - f), posicion));
+        }
+        sort(filas.begin(), filas.end());
+        size_t maximoFilas = static_cast<size_t>(2 * max(1, parametros.cortesPorRonda));
+        for (size_t k = 0; k < filas.size() && k < maximoFilas; k++)
+        {
+            if (separarGomory(contexto, filas[k].second, corte))
+                guardar(corte);
+        }
+    }
+
+    if (parametros.mir || parametros.cubiertas)
+    {
+        for (int i = 0; i < modelo.getNumFilas(); i++)
+        {
+            const vector<pair<int, double>> &fila = modelo.filas[i];
+            // Cada lado finito como desigualdad <=
+            for (int lado = 0; lado < 2; lado++)
+            {
+                double b = lado == 0 ? modelo.filaSuperior[i] : -modelo.filaInferior[i];
+                if (!isfinite(b))
+                    continue;
+                vector<pair<int, double>> menorIgual = fila;
+                if (lado == 1)
+                {
+                    for (auto &coeficiente : menorIgual)
+                        coeficiente.second = -coeficiente.second;
+                }
+                if (parametros.cubiertas && separarCubierta(contexto, menorIgual, b, corte))
+                    guardar(corte);
+                else if (parametros.mir && separarMIR(contexto, menorIgual, b, corte))
+                    guardar(corte);
+            }
+        }
+    }
+
+    sort(encontrados.begin(), encontrados.end(), [](const pair<double, Corte> &a, const pair<double, Corte> &b)
+         { return a.first > b.first; });
+    vector<Corte> cortes;
+    for (auto &encontrado : encontrados)
+        cortes.push_back(move(encontrado.second));
+    return cortes;
+}
+
+// Planta con lotes enteros, una preparación binaria por producto (sin ella no
+// hay lotes) y horas de varias máquinas. Los precios se multiplican por el
+// factor de cada producto; las filas y cotas solo dependen de la semilla.
+ModeloEntero construirPlantaLotes(int productos, int maquinas, unsigned semilla, const vector<double> &factoresPrecio)
+{
+    mt19937 generador(semilla);
+    uniform_real_distribution<double> uniforme(0.0, 1.0);
+    const double loteMaximo = 20.0;
+    ModeloEntero planta;
+    vector<int> lotes;
+    for (int j = 0; j < productos; j++)
+    {
+        double precio = round(30.0 + 40.0 * uniforme(generador));
+        if (!factoresPrecio.empty())
+            precio = round(precio * factoresPrecio[j]);
+        lotes.push_back(planta.lineal.agregarVariable(precio, 0.0, loteMaximo));
+        int preparada = planta.lineal.agregarVariable(-round(80.0 + 100.0 * uniforme(generador)), 0.0, 1.0);
+        planta.variablesEnteras.push_back(lotes.back());
+        planta.variablesEnteras.push_back(preparada);
+        planta.lineal.agregarFila({{lotes.back(), 1.0}, {preparada, -loteMaximo}}, "<=", 0.0);
+    }
+    for (int r = 0; r < maquinas; r++)
+    {
+        vector<pair<int, double>> horas;
+        for (int j = 0; j < productos; j++)
+        {
+            if (uniforme(generador) < 0.7)
+                horas.push_back(make_pair(lotes[j], round(2.0 + 7.0 * uniforme(generador))));
+        }
+        planta.lineal.agregarFila(horas, "<=", round(loteMaximo * productos * (0.6 + 0.3 * uniforme(generador))));
+    }
+    return planta;
+}
+
+/**
+ * Mide los cortes en el modo entero: nodos y tiempo con y sin cortes, según
+ * las rondas de la raíz, y escenarios de precios resueltos en paralelo con un
+ * pool compartido
+ */
+void ejecutarBenchmarkCortes()
+{
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: PLANOS DE CORTE EN EL MODO ENTERO" << endl;
+    cout << string(60, '=') << endl;
+
+    const int productos = 15;
+    const int maquinas = 4;
+    ParametrosCortes sinCortes;
+    sinCortes.rondasRaiz = 0;
+    sinCortes.poolEnNodos = false;
+
+    auto medir = [](const ModeloEntero &modelo, const ParametrosCortes &parametros, double &segundos)
+    {
+        auto inicio = chrono::steady_clock::now();
+        ResultadoEntero resultado = resolverModeloEntero(modelo, nullptr, 1000000, parametros);
+        segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+        return resultado;
+    };
+
+    cout << "Plantas de " << productos << " productos (lotes enteros y preparación binaria) y " << maquinas
+         << " máquinas:" << endl;
+    for (unsigned semilla = 1; semilla <= 3; semilla++)
+    {
+        ModeloEntero planta = construirPlantaLotes(productos, maquinas, semilla);
+        double segundosSin = 0.0;
+        double segundosCon = 0.0;
+        ResultadoEntero sin = medir(planta, sinCortes, segundosSin);
+        ResultadoEntero con = medir(planta, ParametrosCortes(), segundosCon);
+
+        cout << "  Planta " << semilla << " (utilidad $" << con.valorObjetivo << "):" << endl;
+        cout << "    • Sin cortes: cota de la raíz " << sin.cotaRaizInicial << ", " << sin.nodos << " nodos, "
+             << segundosSin * 1000 << " ms" << endl;
+        cout << "    • Con cortes: cota de la raíz " << con.cotaRaiz << ", " << con.cortes << " cortes, " << con.nodos
+             << " nodos, " << segundosCon * 1000 << " ms" << endl;
+        if (sin.estado != LP_OPTIMO || con.estado != LP_OPTIMO ||
+            abs(sin.valorObjetivo - con.valorObjetivo) > 1e-6 * (1.0 + abs(sin.valorObjetivo)))
+        {
+            mostrarMensajeError("Con cortes no se llega al mismo óptimo.");
+        }
+    }
+
+    // Rondas de la raíz en la planta 2
+    ModeloEntero planta = construirPlantaLotes(productos, maquinas, 2);
+    cout << "\nRondas de cortes en la raíz (planta 2, solo cortes de la raíz):" << endl;
+    for (int rondas : {1, 5, 20})
+    {
+        ParametrosCortes parametros;
+        parametros.rondasRaiz = rondas;
+        parametros.poolEnNodos = false;
+        double segundos = 0.0;
+        ResultadoEntero resultado = medir(planta, parametros, segundos);
+        cout << "  • " << rondas << (rondas == 1 ? " ronda" : " rondas") << ": cota " << resultado.cotaRaizInicial << " -> " << resultado.cotaRaiz
+             << ", " << resultado.nodos << " nodos, " << segundos * 1000 << " ms" << endl;
+    }
+
+    // Escenarios de precios de la planta 2: las filas y cotas no cambian, así
+    // que los cortes que encuentra un hilo valen para todos
+    const size_t escenarios = 8;
+    mt19937 generador(41);
+    uniform_real_distribution<double> variacion(0.9, 1.1);
+    vector<ModeloEntero> modelos;
+    for (size_t k = 0; k < escenarios; k++)
+    {
+        vector<double> factores;
+        for (int j = 0; j < productos; j++)
+            factores.push_back(variacion(generador));
+        modelos.push_back(construirPlantaLotes(productos, maquinas, 2, factores));
+    }
+
+    PlanificadorRobo planificador;
+    auto resolverEscenarios = [&](PoolCortes *compartido, long &nodos, vector<double> &valores)
+    {
+        vector<long> nodosPorEscenario(escenarios, 0);
+        valores.assign(escenarios, 0.0);
+        auto inicio = chrono::steady_clock::now();
+        planificador.ejecutar(escenarios, [&](size_t k, unsigned)
+                              {
+                                  ResultadoEntero resultado = resolverModeloEntero(modelos[k], nullptr, 1000000,
+                                                                                   ParametrosCortes(), compartido);
+                                  nodosPorEscenario[k] = resultado.nodos;
+                                  valores[k] = resultado.valorObjetivo;
+                              });
+        nodos = 0;
+        for (long n : nodosPorEscenario)
+            nodos += n;
+        return chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+    };
+
+    long nodosPropios = 0;
+    long nodosCompartidos = 0;
+    vector<double> valoresPropios;
+    vector<double> valoresCompartidos;
+    double segundosPropios = resolverEscenarios(nullptr, nodosPropios, valoresPropios);
+    PoolCortes pool;
+    double segundosCompartidos = resolverEscenarios(&pool, nodosCompartidos, valoresCompartidos);
+
+    cout << "\n" << escenarios << " escenarios de precios (±10 %) en " << planificador.getNumHilos() << " hilos:" << endl;
+    cout << "  • Un pool por escenario: " << nodosPropios << " nodos, " << segundosPropios * 1000 << " ms" << endl;
+    cout << "  • Pool compartido: " << nodosCompartidos << " nodos, " << segundosCompartidos * 1000 << " ms ("
+         << pool.getTamano() << " cortes en el pool, " << pool.getRepetidos() << " repetidos, "
+         << pool.getDescartados() << " descartados por edad)" << endl;
+    for (size_t k = 0; k < escenarios; k++)
+    {
+        if (abs(valoresPropios[k] - valoresCompartidos[k]) > 1e-6 * (1.0 + abs(valoresPropios[k])))
+        {
+            mostrarMensajeError("El escenario " + to_string(k + 1) + " no llega al mismo óptimo con el pool compartido.");
+            break;
+        }
+    }
+}
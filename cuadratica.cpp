@@ -0,0 +1,1002 @@
+/**
+ * MÓDULO DE PROGRAMACIÓN CUADRÁTICA
+ * Ingresos cóncavos por elasticidad del precio: conjunto activo primal
+ * para modelos pequeños y punto interior de Mehrotra para los grandes,
+ * ambos arrancando desde la solución del modelo lineal
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+
+static const double TOL_QP = 1e-9;
+static const int MAX_ITERACIONES_PUNTO_INTERIOR = 200;
+
+// Cota provisional de las variables en el modelo lineal de arranque
+static const double COTA_ARRANQUE = 1e7;
+
+int ModeloCuadratico::agregarFila(const vector<double> &a, OperadorLineal operador, double b)
+{
+    if (static_cast<int>(a.size()) != numVariables)
+    {
+        throw invalid_argument("La fila debe tener un coeficiente por variable.");
+    }
+    coeficientes.insert(coeficientes.end(), a.begin(), a.end());
+    ladoDerecho.push_back(b);
+    operadores.push_back(operador);
+    return getNumFilas() - 1;
+}
+
+// Valor del objetivo c·x - ½·xᵀQx
+double ModeloCuadratico::evaluar(const vector<double> &x) const
+{
+    double valor = 0.0;
+    for (int j = 0; j < numVariables; j++)
+    {
+        double qx = 0.0;
+        for (int k = 0; k < numVariables; k++)
+            qx += cuadratica[j * numVariables + k] * x[k];
+        valor += lineal[j] * x[j] - 0.5 * x[j] * qx;
+    }
+    return valor;
+}
+
+// Filas en la forma G·x <= h y E·x = d (las ">=" se cambian de signo)
+struct FormaEstandarQP
+{
+    int n;
+    vector<double> G, h, E, d;
+
+    int numDesigualdades() const { return static_cast<int>(h.size()); }
+    int numIgualdades() const { return static_cast<int>(d.size()); }
+};
+
+static FormaEstandarQP normalizarModelo(const ModeloCuadratico &modelo)
+{
+    FormaEstandarQP forma;
+    int n = modelo.numVariables;
+    forma.n = n;
+    for (int i = 0; i < modelo.getNumFilas(); i++)
+    {
+        const double *a = &modelo.coeficientes[static_cast<size_t>(i) * n];
+        double b = modelo.ladoDerecho[i];
+        switch (modelo.operadores[i])
+        {
+        case OperadorLineal::MenorIgual:
+            forma.G.insert(forma.G.end(), a, a + n);
+            forma.h.push_back(b);
+            break;
+        case OperadorLineal::MayorIgual:
+            for (int j = 0; j < n; j++)
+                forma.G.push_back(-a[j]);
+            forma.h.push_back(-b);
+            break;
+        case OperadorLineal::Igual:
+            forma.E.insert(forma.E.end(), a, a + n);
+            forma.d.push_back(b);
+            break;
+        }
+    }
+    return forma;
+}
+
+static void validarModeloCuadratico(const ModeloCuadratico &modelo)
+{
+    int n = modelo.numVariables;
+    if (n <= 0 || static_cast<int>(modelo.lineal.size()) != n || modelo.cuadratica.size() != static_cast<size_t>(n) * n)
+    {
+        throw invalid_argument("Las dimensiones del modelo cuadrático no son consistentes.");
+    }
+    for (int j = 0; j < n; j++)
+    {
+        if (modelo.cuadratica[j * n + j] < 0)
+            throw invalid_argument("La matriz cuadrática debe ser semidefinida positiva.");
+        for (int k = 0; k < j; k++)
+        {
+            if (abs(modelo.cuadratica[j * n + k] - modelo.cuadratica[k * n + j]) > 1e-12 * (1.0 + abs(modelo.cuadratica[j * n + k])))
+                throw invalid_argument("La matriz cuadrática debe ser simétrica.");
+        }
+    }
+}
+
+// Eliminación gaussiana con pivoteo parcial; false si la matriz es singular
+static bool resolverSistemaDenso(vector<double> &A, vector<double> &b, int n)
+{
+    double escala = 0.0;
+    for (double v : A)
+        escala = max(escala, abs(v));
+    if (escala == 0.0)
+        return n == 0;
+
+    for (int col = 0; col < n; col++)
+    {
+        int pivote = col;
+        for (int fila = col + 1; fila < n; fila++)
+        {
+            if (abs(A[fila * n + col]) > abs(A[pivote * n + col]))
+                pivote = fila;
+        }
+        if (abs(A[pivote * n + col]) <= 1e-12 * escala)
+            return false;
+
+        if (pivote != col)
+        {
+            for (int k = 0; k < n; k++)
+                swap(A[pivote * n + k], A[col * n + k]);
+            swap(b[pivote], b[col]);
+        }
+        for (int fila = col + 1; fila < n; fila++)
+        {
+            double factor = A[fila * n + col] / A[col * n + col];
+            if (factor == 0.0)
+                continue;
+            for (int k = col; k < n; k++)
+                A[fila * n + k] -= factor * A[col * n + k];
+            b[fila] -= factor * b[col];
+        }
+    }
+    for (int fila = n - 1; fila >= 0; fila--)
+    {
+        double suma = b[fila];
+        for (int k = fila + 1; k < n; k++)
+            suma -= A[fila * n + k] * b[k];
+        b[fila] = suma / A[fila * n + fila];
+    }
+    return true;
+}
+
+static double productoPunto(const double *a, const double *b, int n)
+{
+    double suma = 0.0;
+    for (int j = 0; j < n; j++)
+        suma += a[j] * b[j];
+    return suma;
+}
+
+/**
+ * Conjunto activo primal: en cada paso minimiza el objetivo sobre las filas
+ * activas como igualdades, avanza hasta la primera fila que bloquea y suelta
+ * la fila activa con el multiplicador más negativo
+ * @param modelo Modelo cuadrático
+ * @param inicio Punto factible (normalmente la solución del modelo lineal)
+ * @param token Cancelación o límite de tiempo (opcional)
+ * @return Solución, estado e iteraciones
+ */
+ResultadoCuadratico resolverConjuntoActivo(const ModeloCuadratico &modelo, const vector<double> &inicio,
+                                           const TokenCancelacion *token)
+{
+    TRAZA_AMBITO("cuadratica.conjuntoActivo", "calculo");
+
+    validarModeloCuadratico(modelo);
+    int n = modelo.numVariables;
+    if (static_cast<int>(inicio.size()) != n)
+    {
+        throw invalid_argument("El punto inicial debe tener un valor por variable.");
+    }
+
+    FormaEstandarQP forma = normalizarModelo(modelo);
+    int mi = forma.numDesigualdades();
+    int me = forma.numIgualdades();
+    auto fila = [&forma, mi, n](int i) { return i < mi ? &forma.G[static_cast<size_t>(i) * n] : &forma.E[static_cast<size_t>(i - mi) * n]; };
+    auto lado = [&forma, mi](int i) { return i < mi ? forma.h[i] : forma.d[i - mi]; };
+
+    ResultadoCuadratico resultado;
+    resultado.metodo = QP_CONJUNTO_ACTIVO;
+    vector<double> x(inicio);
+
+    for (int i = 0; i < mi + me; i++)
+    {
+        double holgura = lado(i) - productoPunto(fila(i), x.data(), n);
+        if (holgura < -1e-6 * (1.0 + abs(lado(i))) || (i >= mi && holgura > 1e-6 * (1.0 + abs(lado(i)))))
+        {
+            throw invalid_argument("El punto inicial del conjunto activo no es factible.");
+        }
+    }
+
+    // Conjunto de trabajo con filas linealmente independientes (base ortonormal de sus filas)
+    vector<int> trabajo;
+    vector<char> enTrabajo(mi + me, 0);
+    vector<vector<double>> baseOrtonormal;
+    auto intentarAgregar = [&](int i)
+    {
+        const double *a = fila(i);
+        vector<double> v(a, a + n);
+        double normaOriginal = sqrt(productoPunto(a, a, n));
+        for (const auto &q : baseOrtonormal)
+        {
+            double proyeccion = productoPunto(v.data(), q.data(), n);
+            for (int j = 0; j < n; j++)
+                v[j] -= proyeccion * q[j];
+        }
+        double norma = sqrt(productoPunto(v.data(), v.data(), n));
+        if (norma <= 1e-9 * normaOriginal || normaOriginal == 0.0)
+            return false;
+        for (double &valor : v)
+            valor /= norma;
+        baseOrtonormal.push_back(v);
+        trabajo.push_back(i);
+        enTrabajo[i] = 1;
+        return true;
+    };
+    auto reconstruirBase = [&]()
+    {
+        vector<int> anterior;
+        anterior.swap(trabajo);
+        baseOrtonormal.clear();
+        for (int i : anterior)
+        {
+            enTrabajo[i] = 0;
+            intentarAgregar(i);
+        }
+    };
+
+    for (int i = mi; i < mi + me; i++)
+        intentarAgregar(i);
+    for (int i = 0; i < mi && static_cast<int>(trabajo.size()) < n; i++)
+    {
+        double holgura = lado(i) - productoPunto(fila(i), x.data(), n);
+        if (holgura <= 1e-9 * (1.0 + abs(lado(i))))
+            intentarAgregar(i);
+    }
+
+    double escalaCosto = 1.0;
+    for (double c : modelo.lineal)
+        escalaCosto = max(escalaCosto, abs(c));
+
+    vector<double> g(n), p(n), mu;
+    int maxIteraciones = 10 * (mi + me + n) + 100;
+    for (resultado.iteraciones = 0; resultado.iteraciones < maxIteraciones; resultado.iteraciones++)
+    {
+        if (token)
+        {
+            token->verificar();
+        }
+
+        // Gradiente del problema de minimización ½xᵀQx - c·x
+        for (int j = 0; j < n; j++)
+            g[j] = productoPunto(&modelo.cuadratica[static_cast<size_t>(j) * n], x.data(), n) - modelo.lineal[j];
+
+        // Sistema KKT del subproblema con igualdades: [Q Aᵀ; A 0] [p; μ] = [-g; 0]
+        int k = static_cast<int>(trabajo.size());
+        int tamano = n + k;
+        vector<double> kkt(static_cast<size_t>(tamano) * tamano, 0.0);
+        vector<double> rhs(tamano, 0.0);
+        for (int a = 0; a < n; a++)
+        {
+            for (int b = 0; b < n; b++)
+                kkt[a * tamano + b] = modelo.cuadratica[a * n + b];
+            rhs[a] = -g[a];
+        }
+        for (int w = 0; w < k; w++)
+        {
+            const double *a = fila(trabajo[w]);
+            for (int j = 0; j < n; j++)
+            {
+                kkt[(n + w) * tamano + j] = a[j];
+                kkt[j * tamano + n + w] = a[j];
+            }
+        }
+
+        bool sinCurvatura = false;
+        mu.assign(k, 0.0);
+        if (resolverSistemaDenso(kkt, rhs, tamano))
+        {
+            for (int j = 0; j < n; j++)
+                p[j] = rhs[j];
+            for (int w = 0; w < k; w++)
+                mu[w] = rhs[n + w];
+        }
+        else
+        {
+            // Q no es definida sobre el subespacio: gradiente proyectado
+            for (int j = 0; j < n; j++)
+                p[j] = -g[j];
+            for (const auto &q : baseOrtonormal)
+            {
+                double proyeccion = productoPunto(p.data(), q.data(), n);
+                for (int j = 0; j < n; j++)
+                    p[j] -= proyeccion * q[j];
+            }
+
+            // Multiplicadores por mínimos cuadrados: (A·Aᵀ) μ = -A·g
+            vector<double> normal(static_cast<size_t>(k) * k);
+            for (int a = 0; a < k; a++)
+            {
+                for (int b = 0; b < k; b++)
+                    normal[a * k + b] = productoPunto(fila(trabajo[a]), fila(trabajo[b]), n);
+                mu[a] = -productoPunto(fila(trabajo[a]), g.data(), n);
+            }
+            resolverSistemaDenso(normal, mu, k);
+
+            double norma2 = productoPunto(p.data(), p.data(), n);
+            if (norma2 > 0)
+            {
+                double curvatura = 0.0;
+                for (int j = 0; j < n; j++)
+                    curvatura += p[j] * productoPunto(&modelo.cuadratica[static_cast<size_t>(j) * n], p.data(), n);
+                if (curvatura > TOL_QP * norma2)
+                {
+                    double paso = -productoPunto(g.data(), p.data(), n) / curvatura;
+                    for (double &valor : p)
+                        valor *= paso;
+                }
+                else
+                {
+                    sinCurvatura = true;
+                }
+            }
+        }
+
+        double normaX = 1.0, normaP = 0.0;
+        for (int j = 0; j < n; j++)
+        {
+            normaX = max(normaX, abs(x[j]));
+            normaP = max(normaP, abs(p[j]));
+        }
+
+        if (normaP <= 1e-10 * normaX)
+        {
+            // Punto estacionario en el subespacio: soltar la desigualdad con μ más negativo
+            int saliente = -1;
+            double peor = -1e-9 * escalaCosto;
+            for (int w = 0; w < k; w++)
+            {
+                if (trabajo[w] < mi && mu[w] < peor)
+                {
+                    peor = mu[w];
+                    saliente = w;
+                }
+            }
+            if (saliente < 0)
+            {
+                resultado.estado = LP_OPTIMO;
+                break;
+            }
+            enTrabajo[trabajo[saliente]] = 0;
+            trabajo.erase(trabajo.begin() + saliente);
+            reconstruirBase();
+            continue;
+        }
+
+        // Prueba de razón sobre las desigualdades fuera del conjunto de trabajo
+        double alfa = sinCurvatura ? INFINITO_LP : 1.0;
+        int bloqueo = -1;
+        for (int i = 0; i < mi; i++)
+        {
+            if (enTrabajo[i])
+                continue;
+            const double *a = fila(i);
+            double ap = productoPunto(a, p.data(), n);
+            if (ap <= 1e-12 * normaP)
+                continue;
+            double razon = max(0.0, (forma.h[i] - productoPunto(a, x.data(), n)) / ap);
+            if (razon < alfa)
+            {
+                alfa = razon;
+                bloqueo = i;
+            }
+        }
+        if (alfa == INFINITO_LP)
+        {
+            resultado.estado = LP_NO_ACOTADO;
+            return resultado;
+        }
+
+        for (int j = 0; j < n; j++)
+            x[j] += alfa * p[j];
+        if (bloqueo >= 0)
+            intentarAgregar(bloqueo);
+    }
+
+    if (resultado.estado != LP_OPTIMO)
+    {
+        resultado.estado = LP_LIMITE_ITERACIONES;
+    }
+    resultado.x = x;
+    resultado.valorObjetivo = modelo.evaluar(x);
+    return resultado;
+}
+
+/**
+ * Punto interior primal-dual con predictor-corrector de Mehrotra. Las
+ * ecuaciones normales son de numVariables × numVariables, de modo que cada
+ * iteración cuesta O(filas · numVariables²)
+ * @param modelo Modelo cuadrático
+ * @param inicio Punto cercano al óptimo (se mueve al interior); vacío = origen
+ * @param token Cancelación o límite de tiempo (opcional)
+ * @return Solución, estado e iteraciones
+ */
+ResultadoCuadratico resolverPuntoInterior(const ModeloCuadratico &modelo, const vector<double> &inicio,
+                                          const TokenCancelacion *token)
+{
+    TRAZA_AMBITO("cuadratica.puntoInterior", "calculo");
+
+    validarModeloCuadratico(modelo);
+    int n = modelo.numVariables;
+    FormaEstandarQP forma = normalizarModelo(modelo);
+    int mi = forma.numDesigualdades();
+    int me = forma.numIgualdades();
+
+    ResultadoCuadratico resultado;
+    resultado.metodo = QP_PUNTO_INTERIOR;
+
+    vector<double> x = inicio.empty() ? vector<double>(n, 0.0) : inicio;
+    if (static_cast<int>(x.size()) != n)
+    {
+        throw invalid_argument("El punto inicial debe tener un valor por variable.");
+    }
+
+    double escalaH = 1.0, escalaC = 1.0;
+    for (double v : forma.h)
+        escalaH = max(escalaH, abs(v));
+    for (double v : forma.d)
+        escalaH = max(escalaH, abs(v));
+    for (double v : modelo.lineal)
+        escalaC = max(escalaC, abs(v));
+
+    // Holguras alejadas de cero y duales del mismo orden que los costos
+    vector<double> s(mi), z(mi), y(me, 0.0);
+    double minimaHolgura = 1e-2 * escalaH;
+    for (int i = 0; i < mi; i++)
+    {
+        s[i] = max(forma.h[i] - productoPunto(&forma.G[static_cast<size_t>(i) * n], x.data(), n), minimaHolgura);
+        z[i] = escalaC * minimaHolgura / s[i];
+    }
+
+    vector<double> rd(n), re(me), ri(mi), qx(n);
+    vector<double> dx(n), dy(me), dz(mi), ds(mi), dxAfin, dzAfin(mi), dsAfin(mi);
+    vector<double> sistema, rhs, peso(mi);
+
+    // Resuelve el sistema de Newton para un lado derecho de complementariedad rc
+    auto resolverNewton = [&](const vector<double> &rc)
+    {
+        int tamano = n + me;
+        rhs.assign(tamano, 0.0);
+        for (int j = 0; j < n; j++)
+            rhs[j] = -rd[j];
+        for (int i = 0; i < mi; i++)
+        {
+            double factor = (rc[i] + z[i] * ri[i]) / s[i];
+            const double *g = &forma.G[static_cast<size_t>(i) * n];
+            for (int j = 0; j < n; j++)
+                rhs[j] -= g[j] * factor;
+        }
+        for (int e = 0; e < me; e++)
+            rhs[n + e] = -re[e];
+
+        vector<double> copia(sistema);
+        if (!resolverSistemaDenso(copia, rhs, tamano))
+        {
+            // Regularización mínima cuando Q y las filas activas no determinan x
+            copia = sistema;
+            double escala = 1.0;
+            for (int j = 0; j < n; j++)
+                escala = max(escala, abs(sistema[j * tamano + j]));
+            for (int j = 0; j < n; j++)
+                copia[j * tamano + j] += 1e-10 * escala;
+            if (!resolverSistemaDenso(copia, rhs, tamano))
+                throw runtime_error("El sistema de Newton del punto interior es singular.");
+        }
+
+        for (int j = 0; j < n; j++)
+            dx[j] = rhs[j];
+        for (int e = 0; e < me; e++)
+            dy[e] = rhs[n + e];
+        for (int i = 0; i < mi; i++)
+        {
+            ds[i] = -ri[i] - productoPunto(&forma.G[static_cast<size_t>(i) * n], dx.data(), n);
+            dz[i] = (rc[i] - z[i] * ds[i]) / s[i];
+        }
+    };
+
+    // Máximo paso que mantiene s y z positivos
+    auto pasoMaximo = [&]()
+    {
+        double alfa = 1.0;
+        for (int i = 0; i < mi; i++)
+        {
+            if (ds[i] < 0)
+                alfa = min(alfa, -s[i] / ds[i]);
+            if (dz[i] < 0)
+                alfa = min(alfa, -z[i] / dz[i]);
+        }
+        return alfa;
+    };
+
+    vector<double> rc(mi);
+    vector<double> mejorX(x);
+    double mejorMerito = INFINITO_LP;
+    double normaInicial = 1.0;
+    for (double v : x)
+        normaInicial = max(normaInicial, abs(v));
+
+    resultado.estado = LP_LIMITE_ITERACIONES;
+    for (resultado.iteraciones = 0; resultado.iteraciones < MAX_ITERACIONES_PUNTO_INTERIOR; resultado.iteraciones++)
+    {
+        if (token)
+        {
+            token->verificar();
+        }
+
+        // Residuos: dual (estacionariedad), de igualdades y de desigualdades
+        double normaX = 0.0;
+        for (int j = 0; j < n; j++)
+        {
+            qx[j] = productoPunto(&modelo.cuadratica[static_cast<size_t>(j) * n], x.data(), n);
+            rd[j] = qx[j] - modelo.lineal[j];
+            normaX = max(normaX, abs(x[j]));
+        }
+        for (int e = 0; e < me; e++)
+        {
+            const double *a = &forma.E[static_cast<size_t>(e) * n];
+            re[e] = productoPunto(a, x.data(), n) - forma.d[e];
+            for (int j = 0; j < n; j++)
+                rd[j] += a[j] * y[e];
+        }
+        double brecha = 0.0;
+        for (int i = 0; i < mi; i++)
+        {
+            const double *g = &forma.G[static_cast<size_t>(i) * n];
+            ri[i] = productoPunto(g, x.data(), n) + s[i] - forma.h[i];
+            for (int j = 0; j < n; j++)
+                rd[j] += g[j] * z[i];
+            brecha += s[i] * z[i];
+        }
+
+        double residuoDual = 0.0, residuoPrimal = 0.0;
+        for (double v : rd)
+            residuoDual = max(residuoDual, abs(v));
+        for (double v : re)
+            residuoPrimal = max(residuoPrimal, abs(v));
+        for (double v : ri)
+            residuoPrimal = max(residuoPrimal, abs(v));
+
+        // Criterio relativo: residuos y brecha escalados por el tamaño del problema
+        double objetivo = modelo.evaluar(x);
+        double merito = max(max(residuoDual / (escalaC + normaX), residuoPrimal / (escalaH + normaX)),
+                            brecha / (1.0 + abs(objetivo)));
+        if (merito < mejorMerito)
+        {
+            mejorMerito = merito;
+            mejorX = x;
+        }
+        if (merito <= 1e-9)
+        {
+            resultado.estado = LP_OPTIMO;
+            break;
+        }
+        // Cerca del óptimo el sistema de Newton se vuelve mal condicionado: si las
+        // iteraciones empeoran mucho, se vuelve al mejor punto visto
+        if (merito > 1e3 * mejorMerito)
+        {
+            break;
+        }
+        if (normaX > 1e10 * normaInicial)
+        {
+            resultado.estado = LP_NO_ACOTADO;
+            break;
+        }
+
+        // Matriz [Q + Gᵀ·diag(z/s)·G, Eᵀ; E, 0]
+        int tamano = n + me;
+        sistema.assign(static_cast<size_t>(tamano) * tamano, 0.0);
+        for (int a = 0; a < n; a++)
+            for (int b = 0; b < n; b++)
+                sistema[a * tamano + b] = modelo.cuadratica[a * n + b];
+        for (int i = 0; i < mi; i++)
+        {
+            const double *g = &forma.G[static_cast<size_t>(i) * n];
+            double w = z[i] / s[i];
+            for (int a = 0; a < n; a++)
+            {
+                double wa = w * g[a];
+                if (wa == 0.0)
+                    continue;
+                for (int b = 0; b < n; b++)
+                    sistema[a * tamano + b] += wa * g[b];
+            }
+        }
+        for (int e = 0; e < me; e++)
+        {
+            for (int j = 0; j < n; j++)
+            {
+                sistema[(n + e) * tamano + j] = forma.E[static_cast<size_t>(e) * n + j];
+                sistema[j * tamano + n + e] = forma.E[static_cast<size_t>(e) * n + j];
+            }
+        }
+
+        double mu = mi > 0 ? brecha / mi : 0.0;
+
+        // Predictor (afín)
+        for (int i = 0; i < mi; i++)
+            rc[i] = -s[i] * z[i];
+        resolverNewton(rc);
+        double alfaAfin = pasoMaximo();
+        double brechaAfin = 0.0;
+        for (int i = 0; i < mi; i++)
+        {
+            brechaAfin += (s[i] + alfaAfin * ds[i]) * (z[i] + alfaAfin * dz[i]);
+            dsAfin[i] = ds[i];
+            dzAfin[i] = dz[i];
+        }
+        double sigma = mi > 0 && mu > 0 ? pow(brechaAfin / mi / mu, 3.0) : 0.0;
+
+        // Corrector con centrado
+        for (int i = 0; i < mi; i++)
+            rc[i] = -s[i] * z[i] - dsAfin[i] * dzAfin[i] + sigma * mu;
+        resolverNewton(rc);
+        double alfa = min(1.0, 0.99 * pasoMaximo());
+
+        for (int j = 0; j < n; j++)
+            x[j] += alfa * dx[j];
+        for (int e = 0; e < me; e++)
+            y[e] += alfa * dy[e];
+        for (int i = 0; i < mi; i++)
+        {
+            s[i] += alfa * ds[i];
+            z[i] += alfa * dz[i];
+        }
+    }
+
+    if (resultado.estado != LP_OPTIMO && resultado.estado != LP_NO_ACOTADO)
+    {
+        x = mejorX;
+        resultado.estado = mejorMerito <= 1e-7 ? LP_OPTIMO : LP_LIMITE_ITERACIONES;
+    }
+    resultado.x = x;
+    resultado.valorObjetivo = modelo.evaluar(x);
+    return resultado;
+}
+
+/**
+ * Modelo lineal con las mismas filas (sin el término cuadrático). Las filas
+ * se agregan solo cuando el punto actual las viola, como en el modo de
+ * restricciones perezosas, para que el arranque no dependa de su número
+ * @return Estado del modelo lineal; en 'punto' queda un punto factible
+ */
+static EstadoLP resolverArranqueLineal(const ModeloCuadratico &modelo, vector<double> &punto, const TokenCancelacion *token)
+{
+    TRAZA_AMBITO("cuadratica.arranque", "calculo");
+
+    int n = modelo.numVariables;
+    int m = modelo.getNumFilas();
+    vector<char> agregada(m, 0);
+
+    // Las filas de una sola variable (x >= 0, límites de demanda) pasan a ser cotas
+    vector<double> inferior(n, -COTA_ARRANQUE), superior(n, COTA_ARRANQUE);
+    for (int i = 0; i < m; i++)
+    {
+        const double *a = &modelo.coeficientes[static_cast<size_t>(i) * n];
+        int variable = -1, noNulos = 0;
+        for (int j = 0; j < n; j++)
+        {
+            if (a[j] != 0.0)
+            {
+                variable = j;
+                noNulos++;
+            }
+        }
+        if (noNulos != 1)
+            continue;
+
+        double valor = modelo.ladoDerecho[i] / a[variable];
+        OperadorLineal operador = modelo.operadores[i];
+        bool cotaSuperior = operador != OperadorLineal::MayorIgual;
+        bool cotaInferior = operador != OperadorLineal::MenorIgual;
+        if (a[variable] < 0)
+            swap(cotaSuperior, cotaInferior);
+        if (cotaSuperior)
+            superior[variable] = min(superior[variable], valor);
+        if (cotaInferior)
+            inferior[variable] = max(inferior[variable], valor);
+        agregada[i] = 1;
+    }
+
+    ModeloLineal lineal;
+    for (int j = 0; j < n; j++)
+    {
+        if (inferior[j] > superior[j] + 1e-9 * (1.0 + abs(superior[j])))
+            return LP_INFACTIBLE;
+        lineal.agregarVariable(modelo.lineal[j], inferior[j], max(inferior[j], superior[j]));
+    }
+
+    ResolvedorSimplex resolvedor;
+    resolvedor.cargar(lineal);
+
+    auto agregar = [&](int i)
+    {
+        vector<pair<int, double>> coeficientes;
+        const double *a = &modelo.coeficientes[static_cast<size_t>(i) * n];
+        for (int j = 0; j < n; j++)
+        {
+            if (a[j] != 0.0)
+                coeficientes.push_back(make_pair(j, a[j]));
+        }
+        double b = modelo.ladoDerecho[i];
+        double inferior = modelo.operadores[i] == OperadorLineal::MenorIgual ? -INFINITO_LP : b;
+        double superior = modelo.operadores[i] == OperadorLineal::MayorIgual ? INFINITO_LP : b;
+        resolvedor.agregarFila(coeficientes, inferior, superior);
+    };
+
+    for (int i = 0; i < m; i++)
+    {
+        if (!agregada[i] && modelo.operadores[i] == OperadorLineal::Igual)
+        {
+            agregar(i);
+            agregada[i] = 1;
+        }
+    }
+
+    const size_t maximoPorRonda = 8 * static_cast<size_t>(n);
+    vector<pair<double, int>> violadas;
+    EstadoLP estado;
+    punto.assign(n, 0.0);
+    while (true)
+    {
+        estado = resolvedor.resolver(token);
+        if (estado != LP_OPTIMO)
+        {
+            return estado;
+        }
+        for (int j = 0; j < n; j++)
+            punto[j] = resolvedor.getValor(j);
+
+        violadas.clear();
+        for (int i = 0; i < m; i++)
+        {
+            if (agregada[i])
+                continue;
+            double b = modelo.ladoDerecho[i];
+            double exceso = productoPunto(&modelo.coeficientes[static_cast<size_t>(i) * n], punto.data(), n) - b;
+            if (modelo.operadores[i] == OperadorLineal::MayorIgual)
+                exceso = -exceso;
+            if (exceso > 1e-9 * (1.0 + abs(b)))
+                violadas.push_back(make_pair(-exceso, i));
+        }
+        if (violadas.empty())
+        {
+            break;
+        }
+
+        size_t cuantas = min(maximoPorRonda, violadas.size());
+        partial_sort(violadas.begin(), violadas.begin() + cuantas, violadas.end());
+        for (size_t k = 0; k < cuantas; k++)
+        {
+            agregar(violadas[k].second);
+            agregada[violadas[k].second] = 1;
+        }
+    }
+
+    // Si solo lo limita la cota provisional, el lineal no está acotado: basta un punto factible cualquiera
+    for (int j = 0; j < n; j++)
+    {
+        if (abs(punto[j]) >= COTA_ARRANQUE * (1 - 1e-9))
+        {
+            for (int k = 0; k < n; k++)
+                resolvedor.cambiarObjetivo(k, 0.0);
+            resolvedor.resolver(token);
+            for (int k = 0; k < n; k++)
+                punto[k] = resolvedor.getValor(k);
+            return LP_NO_ACOTADO;
+        }
+    }
+    return LP_OPTIMO;
+}
+
+/**
+ * Resuelve el modelo cuadrático arrancando desde el óptimo lineal
+ * @param modelo Modelo cuadrático
+ * @param metodo QP_AUTOMATICO elige según el número de variables
+ * @param token Cancelación o límite de tiempo (opcional)
+ * @return Solución; LP_INFACTIBLE si el modelo lineal ya lo es
+ */
+ResultadoCuadratico resolverCuadratico(const ModeloCuadratico &modelo, MetodoCuadratico metodo, const TokenCancelacion *token)
+{
+    TRAZA_AMBITO("cuadratica.resolver", "calculo");
+
+    validarModeloCuadratico(modelo);
+
+    vector<double> inicio;
+    EstadoLP estadoLineal = resolverArranqueLineal(modelo, inicio, token);
+    if (estadoLineal != LP_OPTIMO && estadoLineal != LP_NO_ACOTADO)
+    {
+        ResultadoCuadratico resultado;
+        resultado.estado = estadoLineal;
+        return resultado;
+    }
+
+    if (metodo == QP_AUTOMATICO)
+    {
+        metodo = modelo.numVariables >= VARIABLES_PUNTO_INTERIOR ? QP_PUNTO_INTERIOR : QP_CONJUNTO_ACTIVO;
+    }
+    return metodo == QP_PUNTO_INTERIOR ? resolverPuntoInterior(modelo, inicio, token)
+                                       : resolverConjuntoActivo(modelo, inicio, token);
+}
+
+/**
+ * Ingreso de cada producto: (precio - pendiente·propias - cruzada·otras)·propias.
+ * Q = 2·[pendienteMesa, cruzada; cruzada, pendienteSilla]
+ */
+ModeloCuadratico construirModeloElasticidad(const ModeloProduccion &modelo, const ElasticidadPrecio &elasticidad)
+{
+    if (elasticidad.pendienteMesa < 0 || elasticidad.pendienteSilla < 0)
+    {
+        throw invalid_argument("Las pendientes de precio no pueden ser negativas.");
+    }
+    if (elasticidad.cruzada * elasticidad.cruzada > elasticidad.pendienteMesa * elasticidad.pendienteSilla * (1 + 1e-12))
+    {
+        throw invalid_argument("La elasticidad cruzada es demasiado grande: el ingreso dejaría de ser cóncavo.");
+    }
+
+    ModeloCuadratico cuadratico(2);
+    cuadratico.lineal[0] = modelo.precioMesa;
+    cuadratico.lineal[1] = modelo.precioSilla;
+    cuadratico.cuadratica = {2 * elasticidad.pendienteMesa, 2 * elasticidad.cruzada,
+                             2 * elasticidad.cruzada, 2 * elasticidad.pendienteSilla};
+
+    for (const auto &r : modelo.restricciones)
+    {
+        OperadorLineal operador = r.operador == "<=" ? OperadorLineal::MenorIgual
+                                  : r.operador == ">=" ? OperadorLineal::MayorIgual
+                                                       : OperadorLineal::Igual;
+        cuadratico.agregarFila({r.coeficienteX1, r.coeficienteX2}, operador, r.valorConstante);
+    }
+    cuadratico.agregarFila({1.0, 0.0}, OperadorLineal::MayorIgual, 0.0);
+    cuadratico.agregarFila({0.0, 1.0}, OperadorLineal::MayorIgual, 0.0);
+    return cuadratico;
+}
+
+/**
+ * Solución del modelo de producción con precios elásticos
+ * @return gananciaMaxima es el ingreso con los precios ya reducidos
+ */
+SolucionOptima resolverProduccionConElasticidad(const ModeloProduccion &modelo, const ElasticidadPrecio &elasticidad,
+                                                MetodoCuadratico metodo)
+{
+    ResultadoCuadratico resultado = resolverCuadratico(construirModeloElasticidad(modelo, elasticidad), metodo);
+
+    SolucionOptima solucion;
+    if (resultado.estado == LP_OPTIMO)
+    {
+        solucion.x1 = resultado.x[0];
+        solucion.x2 = resultado.x[1];
+        solucion.gananciaMaxima = resultado.valorObjetivo;
+        solucion.solucionEncontrada = true;
+    }
+    return solucion;
+}
+
+// Valor pseudoaleatorio reproducible en [0, 1)
+static double aleatorioCuadratica(unsigned long long &estado)
+{
+    estado = estado * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<double>(estado >> 11) / 9007199254740992.0;
+}
+
+// Modelo de producción con muchas filas de capacidad aleatorias
+static ModeloProduccion generarModeloGrande(int filas, unsigned long long semilla)
+{
+    ModeloProduccion modelo;
+    modelo.precioMesa = 70.0;
+    modelo.precioSilla = 50.0;
+    modelo.restricciones.reserve(filas);
+    for (int i = 0; i < filas; i++)
+    {
+        double a = 1.0 + 4.0 * aleatorioCuadratica(semilla);
+        double b = 0.5 + 3.0 * aleatorioCuadratica(semilla);
+        modelo.restricciones.push_back(a * X1 + b * X2 <= 200.0 + 400.0 * aleatorioCuadratica(semilla));
+    }
+    return modelo;
+}
+
+/**
+ * Caso Flair con precios elásticos (ambos métodos y la sobreestimación del
+ * modelo lineal) y un modelo grande para comparar tiempos
+ */
+void ejecutarBenchmarkCuadratica()
+{
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: PROGRAMACIÓN CUADRÁTICA (ELASTICIDAD)" << endl;
+    cout << string(60, '=') << endl;
+
+    ModeloProduccion flair;
+    flair.precioMesa = 70.0;
+    flair.precioSilla = 50.0;
+    flair.restricciones.push_back(4 * X1 + 3 * X2 <= 240);
+    flair.restricciones.push_back(2 * X1 + X2 <= 100);
+    flair.restricciones.push_back(X2 <= 60);
+
+    ElasticidadPrecio elasticidad(1.2, 0.8, 0.2);
+    ModeloCuadratico cuadratico = construirModeloElasticidad(flair, elasticidad);
+
+    ArenaMonotona arena;
+    SolucionOptima lineal = resolverPuntosExtremos(flair.restricciones, flair.precioMesa, flair.precioSilla, &arena);
+    ResultadoCuadratico activo = resolverCuadratico(cuadratico, QP_CONJUNTO_ACTIVO);
+    ResultadoCuadratico interior = resolverCuadratico(cuadratico, QP_PUNTO_INTERIOR);
+
+    cout << "Caso Flair (pendientes 1.2 y 0.8 por unidad, cruzada 0.2):" << endl;
+    cout << "  • Plan lineal: " << lineal.x1 << " mesas, " << lineal.x2 << " sillas; promete $" << lineal.gananciaMaxima
+         << " pero con la elasticidad vale $" << cuadratico.evaluar({lineal.x1, lineal.x2}) << endl;
+    cout << "  • Conjunto activo: " << activo.x[0] << " mesas, " << activo.x[1] << " sillas, $" << activo.valorObjetivo
+         << " (" << activo.iteraciones << " iteraciones)" << endl;
+    cout << "  • Punto interior: " << interior.x[0] << " mesas, " << interior.x[1] << " sillas, $" << interior.valorObjetivo
+         << " (" << interior.iteraciones << " iteraciones)" << endl;
+
+    // Verificación cruzada de ambos métodos en modelos aleatorios de varias variables
+    unsigned long long semilla = 99;
+    double maximaDiferencia = 0.0;
+    int comparados = 0;
+    for (int prueba = 0; prueba < 300; prueba++)
+    {
+        int n = 2 + prueba % 4;
+        ModeloCuadratico aleatorio(n);
+        for (int j = 0; j < n; j++)
+            aleatorio.lineal[j] = 10.0 + 90.0 * aleatorioCuadratica(semilla);
+
+        // Q = LᵀL con algunas filas de L nulas (semidefinida, a veces singular)
+        vector<double> factor(static_cast<size_t>(n) * n);
+        for (int a = 0; a < n; a++)
+            for (int b = 0; b < n; b++)
+                factor[a * n + b] = (a + prueba) % 3 == 0 ? 0.0 : aleatorioCuadratica(semilla) - 0.3;
+        for (int a = 0; a < n; a++)
+            for (int b = 0; b < n; b++)
+                for (int k = 0; k < n; k++)
+                    aleatorio.cuadratica[a * n + b] += factor[k * n + a] * factor[k * n + b];
+
+        int filas = 3 + prueba % 20;
+        for (int i = 0; i < filas; i++)
+        {
+            vector<double> a(n);
+            for (double &valor : a)
+                valor = 0.2 + 3.0 * aleatorioCuadratica(semilla);
+            aleatorio.agregarFila(a, OperadorLineal::MenorIgual, 50.0 + 200.0 * aleatorioCuadratica(semilla));
+        }
+        for (int j = 0; j < n; j++)
+        {
+            vector<double> a(n, 0.0);
+            a[j] = 1.0;
+            aleatorio.agregarFila(a, OperadorLineal::MayorIgual, 0.0);
+        }
+        if (prueba % 5 == 0)
+        {
+            vector<double> a(n, 1.0);
+            aleatorio.agregarFila(a, OperadorLineal::Igual, 20.0);
+        }
+
+        ResultadoCuadratico r1 = resolverCuadratico(aleatorio, QP_CONJUNTO_ACTIVO);
+        ResultadoCuadratico r2 = resolverCuadratico(aleatorio, QP_PUNTO_INTERIOR);
+        if (r1.estado == LP_OPTIMO && r2.estado == LP_OPTIMO)
+        {
+            maximaDiferencia = max(maximaDiferencia, abs(r1.valorObjetivo - r2.valorObjetivo) / (1.0 + abs(r1.valorObjetivo)));
+            comparados++;
+        }
+        else if (r1.estado != r2.estado)
+        {
+            mostrarMensajeError("Los métodos cuadráticos no coinciden en el estado de un modelo aleatorio.");
+        }
+    }
+    cout << "\nModelos aleatorios (2 a 5 variables): " << comparados << " comparados, diferencia relativa máxima "
+         << scientific << maximaDiferencia << fixed << endl;
+
+    // Modelo grande: muchas filas de capacidad
+    const int filasGrandes = 200000;
+    ModeloCuadratico grande = construirModeloElasticidad(generarModeloGrande(filasGrandes, 7), ElasticidadPrecio(0.05, 0.04, 0.01));
+
+    auto inicio = chrono::steady_clock::now();
+    ResultadoCuadratico grandeInterior = resolverCuadratico(grande, QP_PUNTO_INTERIOR);
+    double segundosInterior = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    inicio = chrono::steady_clock::now();
+    ResultadoCuadratico grandeActivo = resolverCuadratico(grande);
+    double segundosActivo = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    cout << "\nModelo de " << filasGrandes << " filas:" << endl;
+    cout << "  • Punto interior: $" << grandeInterior.valorObjetivo << ", " << grandeInterior.iteraciones
+         << " iteraciones, " << segundosInterior * 1000 << " ms" << endl;
+    cout << "  • Automático (conjunto activo, 2 variables): $" << grandeActivo.valorObjetivo << ", " << grandeActivo.iteraciones << " iteraciones, "
+         << segundosActivo * 1000 << " ms" << endl;
+}
@@ -0,0 +1,667 @@
+/**
+ * MÓDULO DE PROGRAMACIÓN ENTERA
+ * Ramificación y acotamiento sobre el símplex revisado, con variables enteras
+ * y conjuntos SOS2 para los costos por tramos no convexos (descuentos por
+ * volumen de los proveedores de madera y pintura)
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <cmath>
+#include <cstdio>
+#include <chrono>
+#include <random>
+
+using namespace std;
+
+static const double TOL_ENTERO = 1e-6; // Distancia a un entero aceptada como entera
+static const double TOL_PODA = 1e-9;   // Mejora relativa mínima para explorar un nodo
+
+ModeloEntero reformularTramosNoConvexos(const ModeloEntero &modelo)
+{
+    ModeloEntero reformulado = modelo;
+    ModeloLineal &lineal = reformulado.lineal;
+    lineal.costosPorTramos.clear();
+
+    for (const auto &costo : modelo.lineal.costosPorTramos)
+    {
+        if (costo.funcion.esConvexa())
+        {
+            lineal.costosPorTramos.push_back(costo);
+            continue;
+        }
+
+        // x = Σ λ_k·x_k, Σ λ_k = 1, costo Σ λ_k·f(x_k), con λ SOS2
+        const FuncionPorTramos &funcion = costo.funcion;
+        ConjuntoSOS2 conjunto;
+        vector<pair<int, double>> enlace = {{costo.variable, 1.0}};
+        vector<pair<int, double>> convexidad;
+        for (size_t k = 0; k < funcion.puntos.size(); k++)
+        {
+            int lambda = lineal.agregarVariable(-funcion.valores[k], 0.0, 1.0);
+            conjunto.variables.push_back(lambda);
+            conjunto.pesos.push_back(funcion.puntos[k]);
+            enlace.push_back(make_pair(lambda, -funcion.puntos[k]));
+            convexidad.push_back(make_pair(lambda, 1.0));
+        }
+        lineal.agregarFila(enlace, "=", 0.0);
+        lineal.agregarFila(convexidad, "=", 1.0);
+        reformulado.conjuntosSOS2.push_back(conjunto);
+    }
+
+    return reformulado;
+}
+
+// Corte agregado al símplex como fila
+struct CorteEnLP
+{
+    uint64_t firma;
+    int edad; // Nodos seguidos con holgura
+};
+
+// Cotas vigentes de una variable en un nodo
+static pair<double, double> cotasEnNodo(const NodoRamificacion &nodo, int variable, const vector<double> &inferiorRaiz,
+                                        const vector<double> &superiorRaiz)
+{
+    for (auto it = nodo.cambios.rbegin(); it != nodo.cambios.rend(); ++it)
+    {
+        if (it->variable == variable)
+            return make_pair(it->inferior, it->superior);
+    }
+    return make_pair(inferiorRaiz[variable], superiorRaiz[variable]);
+}
+
+/**
+ * Ramificación y acotamiento con el mejor nodo primero. Un solo símplex
+ * recorre todo el árbol: al pasar de un nodo a otro solo se cambian cotas,
+ * y la base del nodo anterior sirve de arranque en caliente.
+ * @param modelo Modelo con variables enteras, conjuntos SOS2 y costos por tramos
+ * @param token Token para cancelar la búsqueda
+ * En la raíz se agregan rondas de cortes; en los demás nodos, los cortes del
+ * pool que la relajación viola. Los cortes que pasan varios nodos con holgura
+ * salen del símplex (quedan en el pool).
+ * @param limiteNodos Máximo de relajaciones a resolver
+ * @param parametros Separadores y rondas de cortes
+ * @param pool Pool compartido con otras búsquedas del mismo modelo (puede ser nullptr)
+ * @param almacenamiento Presupuesto de memoria de los nodos abiertos y puntos
+ * de control. Al agotar los nodos o al cancelar se guarda un punto de control;
+ * con reanudar, una búsqueda del mismo modelo sigue desde él (limiteNodos
+ * cuenta solo los nodos de esta llamada). Al terminar el árbol se borra.
+ * @return Mejor solución entera encontrada y la cota del árbol
+ */
+ResultadoEntero resolverModeloEntero(const ModeloEntero &modelo, const TokenCancelacion *token, long limiteNodos,
+                                     const ParametrosCortes &parametros, PoolCortes *pool,
+                                     const OpcionesAlmacenamiento &almacenamiento)
+{
+    TRAZA_AMBITO("entero.resolver", "calculo");
+
+    ModeloEntero reformulado = reformularTramosNoConvexos(modelo);
+    ModeloLineal &lineal = reformulado.lineal;
+    int numOriginales = modelo.lineal.getNumVariables();
+    ResultadoEntero resultado;
+
+    // En la raíz, las cotas de las variables enteras se redondean hacia adentro
+    for (int j : reformulado.variablesEnteras)
+    {
+        if (j < 0 || j >= lineal.getNumVariables())
+        {
+            throw out_of_range("La variable entera indicada no existe en el modelo.");
+        }
+        lineal.cotaInferior[j] = ceil(lineal.cotaInferior[j] - TOL_ENTERO);
+        lineal.cotaSuperior[j] = floor(lineal.cotaSuperior[j] + TOL_ENTERO);
+        if (lineal.cotaInferior[j] > lineal.cotaSuperior[j])
+        {
+            resultado.estado = LP_INFACTIBLE;
+            return resultado;
+        }
+    }
+    const vector<double> inferiorRaiz = lineal.cotaInferior;
+    const vector<double> superiorRaiz = lineal.cotaSuperior;
+
+    // Los nodos se re-optimizan con Dantzig y la prueba de razón clásica: con Devex
+    // los vértices de los nodos cambian, los cortes de la raíz envejecen y vuelven
+    // del pool una y otra vez, y el árbol crece (planta 1: 7641 nodos contra 56599)
+    ResolvedorSimplex lp;
+    OpcionesSimplex opcionesNodos;
+    opcionesNodos.devex = false;
+    opcionesNodos.saltosDeCota = false;
+    lp.setOpciones(opcionesNodos);
+    lp.cargar(lineal);
+
+    // Cortes: el modelo conCortes refleja las filas del símplex con sus cotas globales
+    PoolCortes poolPropio;
+    PoolCortes &cortes = pool ? *pool : poolPropio;
+    cortes.vincularModelo(calcularFirmaFactible(lineal, reformulado.variablesEnteras));
+    ModeloLineal conCortes = lineal;
+    conCortes.costosPorTramos.clear();
+    int filasModelo = lineal.getNumFilas();
+    vector<CorteEnLP> cortesEnLP;
+    vector<bool> esEntera(lineal.getNumVariables(), false);
+    for (int j : reformulado.variablesEnteras)
+        esEntera[j] = true;
+
+    auto hayFraccionaria = [&](const vector<double> &x)
+    {
+        for (int j : reformulado.variablesEnteras)
+        {
+            if (abs(x[j] - round(x[j])) > TOL_ENTERO)
+                return true;
+        }
+        return false;
+    };
+
+    // Agrega al símplex hasta maximo cortes del pool que x viola; devuelve cuántos
+    auto agregarDelPool = [&](const vector<double> &x, int maximo)
+    {
+        int agregados = 0;
+        for (const Corte &corte : cortes.separar(x, TOL_ENTERO, static_cast<size_t>(max(0, maximo))))
+        {
+            bool presente = false;
+            for (const auto &enLP : cortesEnLP)
+                presente = presente || enLP.firma == corte.firma;
+            if (presente)
+                continue;
+            lp.agregarFila(corte.coeficientes, -INFINITO_LP, corte.lado);
+            conCortes.agregarFila(corte.coeficientes, "<=", corte.lado);
+            cortesEnLP.push_back({corte.firma, 0});
+            agregados++;
+        }
+        resultado.cortes += agregados;
+        return agregados;
+    };
+
+    // Envejece los cortes del símplex y quita los que llevan más de edadLimite nodos con holgura
+    auto envejecerCortesLP = [&](int edadLimite)
+    {
+        vector<int> quitar;
+        for (size_t k = 0; k < cortesEnLP.size(); k++)
+        {
+            int fila = filasModelo + static_cast<int>(k);
+            bool conHolgura = lp.esBasica(lp.getNumVariables() + fila) &&
+                              lp.getActividadFila(fila) < conCortes.filaSuperior[fila] - TOL_ENTERO;
+            cortesEnLP[k].edad = conHolgura ? cortesEnLP[k].edad + 1 : 0;
+            if (cortesEnLP[k].edad > edadLimite && conHolgura)
+                quitar.push_back(fila);
+        }
+        if (quitar.empty())
+            return;
+        lp.quitarFilas(quitar);
+        for (auto it = quitar.rbegin(); it != quitar.rend(); ++it)
+        {
+            conCortes.filas.erase(conCortes.filas.begin() + *it);
+            conCortes.filaInferior.erase(conCortes.filaInferior.begin() + *it);
+            conCortes.filaSuperior.erase(conCortes.filaSuperior.begin() + *it);
+            cortesEnLP.erase(cortesEnLP.begin() + (*it - filasModelo));
+        }
+    };
+
+    // Nodos abiertos, con desborde a disco si hay presupuesto de memoria
+    const string &puntoControl = almacenamiento.archivoPuntoControl;
+    string rutaDesborde = almacenamiento.archivoDesborde;
+    if (rutaDesborde.empty() && almacenamiento.presupuestoMemoria > 0)
+        rutaDesborde = (puntoControl.empty() ? string("modo_entero") : puntoControl) + ".nodos";
+    ColaNodos pendientes(almacenamiento.presupuestoMemoria, rutaDesborde);
+    double mejorValor = -INFINITO_LP;
+
+    // Reanudar desde el punto de control si es de este mismo modelo
+    uint64_t firmaModelo = puntoControl.empty() ? 0 : calcularFirmaModeloEntero(modelo);
+    EstadoBusqueda guardado;
+    if (!puntoControl.empty() && almacenamiento.reanudar && cargarPuntoControl(puntoControl, guardado) &&
+        guardado.firmaModelo == firmaModelo)
+    {
+        mejorValor = guardado.mejorValor;
+        if (!guardado.valores.empty())
+        {
+            resultado.valores = guardado.valores;
+            resultado.valorObjetivo = mejorValor;
+        }
+        resultado.nodos = guardado.nodos;
+        resultado.iteracionesSimplex = guardado.iteracionesSimplex;
+        resultado.cortes = guardado.cortes;
+        resultado.cotaRaizInicial = guardado.cotaRaizInicial;
+        resultado.cotaRaiz = guardado.cotaRaiz;
+        resultado.reanudado = true;
+        // Los cortes vuelven al pool; los nodos los toman de ahí si los violan
+        for (auto &corte : guardado.pool)
+            cortes.agregar(move(corte));
+        if (mejorValor > -INFINITO_LP)
+            pendientes.podar(mejorValor + TOL_PODA * (1.0 + abs(mejorValor)));
+        for (auto &nodo : guardado.abiertos)
+            pendientes.agregar(move(nodo));
+    }
+    else
+    {
+        pendientes.agregar(NodoRamificacion{INFINITO_LP, 0, {}});
+    }
+    guardado = EstadoBusqueda();
+
+    auto guardarEstado = [&]()
+    {
+        EstadoBusqueda estado;
+        estado.firmaModelo = firmaModelo;
+        estado.mejorValor = mejorValor;
+        estado.valores = resultado.valores;
+        estado.nodos = resultado.nodos;
+        estado.iteracionesSimplex = resultado.iteracionesSimplex;
+        estado.cortes = resultado.cortes;
+        estado.cotaRaizInicial = resultado.cotaRaizInicial;
+        estado.cotaRaiz = resultado.cotaRaiz;
+        estado.abiertos = pendientes.copiarNodos();
+        estado.pool = cortes.getCortes();
+        guardarPuntoControl(puntoControl, estado);
+    };
+    auto ultimoPunto = chrono::steady_clock::now();
+
+    vector<CambioCota> aplicados; // Cambios del último nodo cargado en el símplex
+    long nodosLlamada = 0;
+    NodoRamificacion nodo;
+    bool enProceso = false; // nodo salió de la cola y aún no tiene hijos
+
+    try
+    {
+        while (!pendientes.vacia())
+        {
+            enProceso = false;
+            if (token)
+                token->verificar();
+            double desdeUltimoPunto = chrono::duration<double>(chrono::steady_clock::now() - ultimoPunto).count();
+            if (!puntoControl.empty() && desdeUltimoPunto >= almacenamiento.segundosEntrePuntos)
+            {
+                guardarEstado();
+                ultimoPunto = chrono::steady_clock::now();
+            }
+
+            if (!pendientes.extraer(nodo))
+                break;
+            if (nodo.cota <= mejorValor + TOL_PODA * (1.0 + abs(mejorValor)))
+                continue;
+            if (nodosLlamada >= limiteNodos)
+            {
+                pendientes.agregar(move(nodo));
+                break;
+            }
+            enProceso = true;
+            resultado.nodos++;
+            nodosLlamada++;
+
+            // Volver a las cotas de la raíz y aplicar las del nodo
+            for (const auto &cambio : aplicados)
+            {
+                lp.cambiarCotasVariable(cambio.variable, inferiorRaiz[cambio.variable], superiorRaiz[cambio.variable]);
+            }
+            for (const auto &cambio : nodo.cambios)
+            {
+                lp.cambiarCotasVariable(cambio.variable, cambio.inferior, cambio.superior);
+            }
+            aplicados = nodo.cambios;
+
+            EstadoLP estado = lp.resolver(token);
+            resultado.iteracionesSimplex += lp.getIteraciones();
+            if (estado == LP_NO_ACOTADO && nodo.profundidad == 0)
+            {
+                resultado.estado = LP_NO_ACOTADO;
+                return resultado;
+            }
+            if (estado != LP_OPTIMO)
+                continue;
+
+            if (nodo.profundidad == 0)
+            {
+                resultado.cotaRaizInicial = lp.getValorObjetivo();
+
+                // Rondas de cortes en la raíz hasta que la cota deja de bajar
+                double cotaAnterior = resultado.cotaRaizInicial;
+                int rondasSinMejora = 0;
+                for (int ronda = 0; ronda < parametros.rondasRaiz && estado == LP_OPTIMO; ronda++)
+                {
+                    vector<double> x = lp.getValores();
+                    if (!hayFraccionaria(x))
+                        break;
+                    for (const Corte &corte : separarCortes(lp, conCortes, esEntera, parametros))
+                        cortes.agregar(corte);
+                    if (agregarDelPool(x, parametros.cortesPorRonda) == 0)
+                        break;
+                    estado = lp.resolver(token);
+                    resultado.iteracionesSimplex += lp.getIteraciones();
+
+                    if (estado == LP_OPTIMO)
+                        envejecerCortesLP(0); // Los cortes de rondas anteriores que ya no tocan salen
+
+                    double cota = lp.getValorObjetivo();
+                    rondasSinMejora = cota < cotaAnterior - 1e-4 * (1.0 + abs(cotaAnterior)) ? 0 : rondasSinMejora + 1;
+                    cotaAnterior = cota;
+                    if (rondasSinMejora >= 3)
+                        break;
+                }
+                if (estado != LP_OPTIMO)
+                    continue;
+                resultado.cotaRaiz = lp.getValorObjetivo();
+            }
+            else if (parametros.poolEnNodos)
+            {
+                vector<double> x = lp.getValores();
+                if (hayFraccionaria(x) && agregarDelPool(x, parametros.cortesPorNodo) > 0)
+                {
+                    estado = lp.resolver(token);
+                    resultado.iteracionesSimplex += lp.getIteraciones();
+                    if (estado != LP_OPTIMO)
+                        continue;
+                }
+            }
+
+            double valor = lp.getValorObjetivo();
+            if (valor <= mejorValor + TOL_PODA * (1.0 + abs(mejorValor)))
+                continue;
+
+            vector<double> x = lp.getValores();
+            if (!cortesEnLP.empty())
+                envejecerCortesLP(parametros.edadEnLP);
+            vector<NodoRamificacion> hijos;
+
+            // Primero la variable entera más fraccionaria
+            int fraccionaria = -1;
+            double mayorDistancia = TOL_ENTERO;
+            for (int j : reformulado.variablesEnteras)
+            {
+                double distancia = abs(x[j] - round(x[j]));
+                if (distancia > mayorDistancia)
+                {
+                    mayorDistancia = distancia;
+                    fraccionaria = j;
+                }
+            }
+
+            if (fraccionaria >= 0)
+            {
+                pair<double, double> cotas = cotasEnNodo(nodo, fraccionaria, inferiorRaiz, superiorRaiz);
+                hijos.push_back(nodo);
+                hijos.back().cambios.push_back({fraccionaria, cotas.first, floor(x[fraccionaria])});
+                hijos.push_back(nodo);
+                hijos.back().cambios.push_back({fraccionaria, ceil(x[fraccionaria]), cotas.second});
+            }
+            else
+            {
+                // Después el primer conjunto SOS2 con pesos no nulos que no son vecinos
+                for (const auto &conjunto : reformulado.conjuntosSOS2)
+                {
+                    int primero = -1;
+                    int ultimo = -1;
+                    double suma = 0.0;
+                    double sumaPonderada = 0.0;
+                    for (size_t k = 0; k < conjunto.variables.size(); k++)
+                    {
+                        double lambda = x[conjunto.variables[k]];
+                        if (lambda > TOL_ENTERO)
+                        {
+                            if (primero < 0)
+                                primero = static_cast<int>(k);
+                            ultimo = static_cast<int>(k);
+                            suma += lambda;
+                            sumaPonderada += lambda * conjunto.pesos[k];
+                        }
+                    }
+                    if (ultimo - primero <= 1)
+                        continue;
+
+                    // Se corta en la posición media ponderada: un hijo deja los pesos
+                    // de 0 a r y el otro los de r en adelante
+                    double media = sumaPonderada / suma;
+                    int r = primero + 1;
+                    while (r < ultimo - 1 && conjunto.pesos[r] < media)
+                        r++;
+
+                    NodoRamificacion izquierdo = nodo;
+                    NodoRamificacion derecho = nodo;
+                    for (size_t k = 0; k < conjunto.variables.size(); k++)
+                    {
+                        int variable = conjunto.variables[k];
+                        NodoRamificacion &hijo = static_cast<int>(k) > r ? izquierdo : derecho;
+                        if (static_cast<int>(k) == r)
+                            continue;
+                        pair<double, double> cotas = cotasEnNodo(nodo, variable, inferiorRaiz, superiorRaiz);
+                        if (cotas.second > 0.0)
+                            hijo.cambios.push_back({variable, cotas.first, 0.0});
+                    }
+                    hijos.push_back(izquierdo);
+                    hijos.push_back(derecho);
+                    break;
+                }
+            }
+
+            if (hijos.empty())
+            {
+                // Solución entera y SOS2 factible: nuevo incumbente
+                mejorValor = valor;
+                resultado.valorObjetivo = valor;
+                resultado.valores.assign(x.begin(), x.begin() + numOriginales);
+                pendientes.podar(mejorValor + TOL_PODA * (1.0 + abs(mejorValor)));
+                continue;
+            }
+
+            enProceso = false;
+            for (auto &hijo : hijos)
+            {
+                hijo.cota = valor;
+                hijo.profundidad = nodo.profundidad + 1;
+                pendientes.agregar(move(hijo));
+            }
+        }
+    }
+    catch (const CalculoInterrumpido &)
+    {
+        // El nodo a medio resolver vuelve a la cola para repetirlo al reanudar
+        if (enProceso)
+        {
+            resultado.nodos--;
+            pendientes.agregar(move(nodo));
+        }
+        if (!puntoControl.empty())
+            guardarEstado();
+        throw;
+    }
+
+    bool completo = pendientes.vacia();
+    resultado.desbordes = pendientes.getDesbordes();
+    resultado.recargas = pendientes.getRecargas();
+    if (!puntoControl.empty())
+    {
+        if (completo)
+            remove(puntoControl.c_str());
+        else
+            guardarEstado();
+    }
+    resultado.cotaSuperior = completo ? mejorValor : max(mejorValor, pendientes.getMejorCota());
+    if (mejorValor == -INFINITO_LP)
+        resultado.estado = completo ? LP_INFACTIBLE : LP_LIMITE_ITERACIONES;
+    else
+        resultado.estado = completo ? LP_OPTIMO : LP_LIMITE_ITERACIONES;
+    return resultado;
+}
+
+// Reformulación manual de un costo por tramos que parte de (0, 0): una variable
+// por tramo y, si no es convexo, una binaria por quiebre que obliga a llenar
+// los tramos en orden. Es lo que el modelo necesitaba antes de los costos nativos.
+static void agregarTramosManuales(ModeloEntero &modelo, int variable, const FuncionPorTramos &funcion)
+{
+    bool convexa = funcion.esConvexa();
+    vector<pair<int, double>> enlace = {{variable, 1.0}};
+    vector<int> tramos;
+    for (int k = 0; k < funcion.getNumTramos(); k++)
+    {
+        double largo = funcion.puntos[k + 1] - funcion.puntos[k];
+        tramos.push_back(modelo.lineal.agregarVariable(-funcion.pendiente(k), 0.0, largo));
+        enlace.push_back(make_pair(tramos.back(), -1.0));
+    }
+    modelo.lineal.agregarFila(enlace, "=", 0.0);
+
+    if (convexa)
+        return;
+
+    for (int k = 0; k + 1 < funcion.getNumTramos(); k++)
+    {
+        double largo = funcion.puntos[k + 1] - funcion.puntos[k];
+        double largoSiguiente = funcion.puntos[k + 2] - funcion.puntos[k + 1];
+        int binaria = modelo.lineal.agregarVariable(0.0, 0.0, 1.0);
+        modelo.variablesEnteras.push_back(binaria);
+        modelo.lineal.agregarFila({{tramos[k], 1.0}, {binaria, -largo}}, ">=", 0.0);
+        modelo.lineal.agregarFila({{tramos[k + 1], 1.0}, {binaria, -largoSiguiente}}, "<=", 0.0);
+    }
+}
+
+// Resuelve el modelo con costos nativos y con la reformulación manual, y muestra ambos
+static void compararFormulaciones(const string &titulo, const ModeloEntero &nativo, bool mostrarValores)
+{
+    ModeloEntero manual = nativo;
+    manual.lineal.costosPorTramos.clear();
+    for (const auto &costo : nativo.lineal.costosPorTramos)
+    {
+        agregarTramosManuales(manual, costo.variable, costo.funcion);
+    }
+
+    ModeloEntero reformulado = reformularTramosNoConvexos(nativo);
+
+    auto inicio = chrono::steady_clock::now();
+    ResultadoEntero conTramos = resolverModeloEntero(nativo);
+    double segundosNativo = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    inicio = chrono::steady_clock::now();
+    ResultadoEntero conBinarias = resolverModeloEntero(manual);
+    double segundosManual = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    cout << "\n" << titulo << endl;
+    cout << "  • Tramos nativos + SOS2: " << reformulado.lineal.getNumVariables() << " columnas, "
+         << reformulado.lineal.getNumFilas() << " filas, " << reformulado.variablesEnteras.size() << " enteras, "
+         << conTramos.nodos << " nodos, " << conTramos.iteracionesSimplex << " iteraciones, "
+         << segundosNativo * 1000 << " ms" << endl;
+    cout << "  • Reformulación manual: " << manual.lineal.getNumVariables() << " columnas, "
+         << manual.lineal.getNumFilas() << " filas, " << manual.variablesEnteras.size() << " enteras, "
+         << conBinarias.nodos << " nodos, " << conBinarias.iteracionesSimplex << " iteraciones, "
+         << segundosManual * 1000 << " ms" << endl;
+
+    if (conTramos.estado != LP_OPTIMO || conBinarias.estado != LP_OPTIMO)
+    {
+        mostrarMensajeError("Alguna de las formulaciones no terminó con el óptimo.");
+        return;
+    }
+    cout << "  • Utilidad: $" << conTramos.valorObjetivo << " (nativo) y $" << conBinarias.valorObjetivo
+         << " (manual)" << endl;
+    if (mostrarValores)
+    {
+        cout << "  • Plan: " << conTramos.valores[0] << " mesas, " << conTramos.valores[1] << " sillas, "
+             << conTramos.valores[2] << " tablas, " << conTramos.valores[3] << " litros de pintura" << endl;
+    }
+    if (abs(conTramos.valorObjetivo - conBinarias.valorObjetivo) > 1e-6 * (1.0 + abs(conBinarias.valorObjetivo)))
+    {
+        mostrarMensajeError("Las dos formulaciones no llegan a la misma utilidad.");
+    }
+}
+
+/**
+ * Compara los costos por tramos nativos con la reformulación manual en el
+ * caso Flair con proveedores y en plantas generadas al azar
+ */
+void ejecutarBenchmarkTramos()
+{
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: COSTOS POR TRAMOS Y DESCUENTOS POR VOLUMEN" << endl;
+    cout << string(60, '=') << endl;
+
+    // Caso Flair: 5 tablas por mesa y 2 por silla con descuento por volumen,
+    // 1.5 litros de pintura por mesa y 0.5 por silla con recargo por urgencia
+    ModeloEntero flair;
+    int mesas = flair.lineal.agregarVariable(70.0);
+    int sillas = flair.lineal.agregarVariable(50.0, 0.0, 60.0);
+    int tablas = flair.lineal.agregarVariable(0.0);
+    int litros = flair.lineal.agregarVariable(0.0);
+    flair.lineal.agregarFila({{mesas, 4.0}, {sillas, 3.0}}, "<=", 240.0);
+    flair.lineal.agregarFila({{mesas, 2.0}, {sillas, 1.0}}, "<=", 100.0);
+    flair.lineal.agregarFila({{tablas, 1.0}, {mesas, -5.0}, {sillas, -2.0}}, "=", 0.0);
+    flair.lineal.agregarFila({{litros, 1.0}, {mesas, -1.5}, {sillas, -0.5}}, "=", 0.0);
+    flair.lineal.agregarCostoPorTramos(tablas, construirCostoEscalonado({100.0, 250.0, 400.0}, {6.0, 4.5, 3.5}));
+    flair.lineal.agregarCostoPorTramos(litros, construirCostoEscalonado({60.0, 90.0}, {4.0, 7.0}));
+    flair.variablesEnteras = {mesas, sillas};
+    compararFormulaciones("Flair con descuento en madera y recargo en pintura (plan entero):", flair, true);
+
+    // Plantas al azar: cada recurso se compra con descuentos por volumen
+    mt19937 generador(39);
+    uniform_real_distribution<double> uniforme(0.0, 1.0);
+    auto construirPlanta = [&](int productos, int recursos, int escalones, bool descuentos)
+    {
+        ModeloEntero planta;
+        for (int j = 0; j < productos; j++)
+        {
+            planta.lineal.agregarVariable(40.0 + 50.0 * uniforme(generador), 0.0, 20.0 + 80.0 * uniforme(generador));
+        }
+        vector<pair<int, double>> horas;
+        for (int j = 0; j < productos; j++)
+        {
+            horas.push_back(make_pair(j, 1.0 + 3.0 * uniforme(generador)));
+        }
+        planta.lineal.agregarFila(horas, "<=", 40.0 * productos);
+
+        for (int r = 0; r < recursos; r++)
+        {
+            int uso = planta.lineal.agregarVariable(0.0);
+            vector<pair<int, double>> fila = {{uso, 1.0}};
+            for (int j = 0; j < productos; j++)
+            {
+                if (uniforme(generador) < min(0.4, 4.0 / recursos))
+                    fila.push_back(make_pair(j, -(0.5 + 4.0 * uniforme(generador))));
+            }
+            planta.lineal.agregarFila(fila, "=", 0.0);
+
+            // Descuentos: el precio baja en cada escalón; recargos: sube
+            vector<double> limites;
+            vector<double> precios;
+            double precio = descuentos ? 9.0 + 4.0 * uniforme(generador) : 1.0 + 2.0 * uniforme(generador);
+            for (int k = 0; k < escalones; k++)
+            {
+                limites.push_back((k + 1) * 60.0 * productos / escalones);
+                precios.push_back(precio);
+                precio *= descuentos ? 0.6 + 0.3 * uniforme(generador) : 1.3 + 0.7 * uniforme(generador);
+            }
+            planta.lineal.agregarCostoPorTramos(uso, construirCostoEscalonado(limites, precios));
+        }
+        return planta;
+    };
+
+    compararFormulaciones("Planta de 30 productos y 12 recursos con 6 escalones de descuento:",
+                          construirPlanta(30, 12, 6, true), false);
+
+    // Costos convexos en un modelo lineal grande: solo el símplex, sin ramificar
+    ModeloEntero convexa = construirPlanta(150, 60, 8, false);
+    ModeloEntero separada = convexa;
+    separada.lineal.costosPorTramos.clear();
+    for (const auto &costo : convexa.lineal.costosPorTramos)
+    {
+        agregarTramosManuales(separada, costo.variable, costo.funcion);
+    }
+
+    ResolvedorSimplex nativo;
+    ResolvedorSimplex manual;
+    auto inicio = chrono::steady_clock::now();
+    nativo.cargar(convexa.lineal);
+    EstadoLP estadoNativo = nativo.resolver();
+    double segundosNativo = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    inicio = chrono::steady_clock::now();
+    manual.cargar(separada.lineal);
+    EstadoLP estadoManual = manual.resolver();
+    double segundosManual = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    cout << "\nPlanta de 150 productos y 60 recursos con 8 escalones de recargo (lineal):" << endl;
+    cout << "  • Tramos en la prueba de razón: " << nativo.getNumVariables() << " columnas, "
+         << nativo.getIteraciones() << " iteraciones, " << segundosNativo * 1000 << " ms" << endl;
+    cout << "  • Una columna por tramo: " << manual.getNumVariables() << " columnas, " << manual.getIteraciones()
+         << " iteraciones, " << segundosManual * 1000 << " ms" << endl;
+    if (estadoNativo != LP_OPTIMO || estadoManual != LP_OPTIMO ||
+        abs(nativo.getValorObjetivo() - manual.getValorObjetivo()) > 1e-6 * (1.0 + abs(manual.getValorObjetivo())))
+    {
+        mostrarMensajeError("Las dos formulaciones lineales no llegan al mismo óptimo.");
+    }
+    else
+    {
+        cout << "  • Utilidad: $" << nativo.getValorObjetivo() << " en ambas" << endl;
+    }
+}
@@ -0,0 +1,438 @@
+/**
+ * MÓDULO DE DEMANDA ESTOCÁSTICA
+ * Plan de producción en dos etapas con escenarios de demanda: primero se
+ * fija cuántas mesas y sillas fabricar y, en cada escenario, cuánto vender.
+ * Se resuelve como equivalente determinista (un único modelo lineal) o por
+ * cobertura progresiva, con los escenarios en paralelo y arranque en
+ * caliente de cada subproblema entre iteraciones
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+static const double TOL_PROBABILIDAD = 1e-6;
+
+static void validarModeloEstocastico(const ModeloEstocastico &modelo)
+{
+    if (modelo.escenarios.empty())
+    {
+        throw invalid_argument("El modelo estocástico necesita al menos un escenario de demanda.");
+    }
+    double total = 0.0;
+    for (size_t s = 0; s < modelo.escenarios.size(); s++)
+    {
+        const EscenarioDemanda &escenario = modelo.escenarios[s];
+        if (!(escenario.probabilidad >= 0.0) || !(escenario.demandaMesas >= 0.0) || !(escenario.demandaSillas >= 0.0))
+        {
+            throw invalid_argument("El escenario " + to_string(s + 1) +
+                                   " tiene una probabilidad o una demanda negativa.");
+        }
+        total += escenario.probabilidad;
+    }
+    if (abs(total - 1.0) > TOL_PROBABILIDAD)
+    {
+        throw invalid_argument("Las probabilidades de los escenarios deben sumar 1.");
+    }
+}
+
+// Ganancia de un escenario: cx·x + cv·v - Σ penalización·demanda
+// (producir cuesta el costo y deja el rescate; vender cambia el rescate por el precio y evita la penalización)
+struct CoeficientesDosEtapas
+{
+    double produccion[2]; // cx
+    double venta[2];      // cv
+
+    explicit CoeficientesDosEtapas(const ModeloEstocastico &modelo)
+    {
+        produccion[0] = modelo.rescateMesa - modelo.costoMesa;
+        produccion[1] = modelo.rescateSilla - modelo.costoSilla;
+        venta[0] = modelo.produccion.precioMesa + modelo.penalizacionMesa - modelo.rescateMesa;
+        venta[1] = modelo.produccion.precioSilla + modelo.penalizacionSilla - modelo.rescateSilla;
+    }
+};
+
+static double constanteEscenario(const ModeloEstocastico &modelo, const EscenarioDemanda &escenario)
+{
+    return -modelo.penalizacionMesa * escenario.demandaMesas - modelo.penalizacionSilla * escenario.demandaSillas;
+}
+
+/**
+ * Calcula la ganancia esperada de una producción fija. Las ventas de cada
+ * escenario no interactúan entre sí: se vende min(producción, demanda) si
+ * vender conviene y nada en caso contrario
+ * @param modelo Modelo estocástico
+ * @param mesas Mesas producidas
+ * @param sillas Sillas producidas
+ * @return Ganancia esperada
+ */
+double evaluarPlanEstocastico(const ModeloEstocastico &modelo, double mesas, double sillas)
+{
+    validarModeloEstocastico(modelo);
+    CoeficientesDosEtapas c(modelo);
+    double esperada = 0.0;
+    for (const auto &escenario : modelo.escenarios)
+    {
+        double ventaMesas = c.venta[0] > 0 ? min(mesas, escenario.demandaMesas) : 0.0;
+        double ventaSillas = c.venta[1] > 0 ? min(sillas, escenario.demandaSillas) : 0.0;
+        esperada += escenario.probabilidad * (c.produccion[0] * mesas + c.produccion[1] * sillas + c.venta[0] * ventaMesas +
+                                              c.venta[1] * ventaSillas + constanteEscenario(modelo, escenario));
+    }
+    return esperada;
+}
+
+// Modelo de producción y ventas de un escenario: variables x₁, x₂, v₁, v₂
+static ModeloLineal construirModeloEscenario(const ModeloEstocastico &modelo, const EscenarioDemanda &escenario)
+{
+    CoeficientesDosEtapas c(modelo);
+    ModeloLineal lineal = construirModeloLineal(modelo.produccion);
+    lineal.objetivo[0] = c.produccion[0];
+    lineal.objetivo[1] = c.produccion[1];
+    int ventaMesas = lineal.agregarVariable(c.venta[0], 0.0, escenario.demandaMesas);
+    int ventaSillas = lineal.agregarVariable(c.venta[1], 0.0, escenario.demandaSillas);
+    lineal.agregarFila({{ventaMesas, 1.0}, {0, -1.0}}, "<=", 0.0);
+    lineal.agregarFila({{ventaSillas, 1.0}, {1, -1.0}}, "<=", 0.0);
+    return lineal;
+}
+
+// Σ p_s · óptimo del escenario s con su demanda conocida. Solo cambian las
+// cotas de las ventas, así que cada escenario parte de la base del anterior
+static double calcularEsperaVer(const ModeloEstocastico &modelo)
+{
+    ResolvedorSimplex simplex;
+    simplex.cargar(construirModeloEscenario(modelo, modelo.escenarios[0]));
+    double esperada = 0.0;
+    for (const auto &escenario : modelo.escenarios)
+    {
+        simplex.cambiarCotasVariable(2, 0.0, escenario.demandaMesas);
+        simplex.cambiarCotasVariable(3, 0.0, escenario.demandaSillas);
+        if (simplex.resolver() != LP_OPTIMO)
+        {
+            throw runtime_error("Un escenario de demanda no tiene un plan óptimo.");
+        }
+        esperada += escenario.probabilidad * (simplex.getValorObjetivo() + constanteEscenario(modelo, escenario));
+    }
+    return esperada;
+}
+
+/**
+ * Equivalente determinista: x₁, x₂ y las ventas de cada escenario en un
+ * único modelo lineal, con la ganancia de cada escenario ponderada por su
+ * probabilidad
+ * @param modelo Modelo estocástico
+ * @return Plan óptimo (solucionEncontrada = false si no es factible)
+ */
+PlanEstocastico resolverEquivalenteDeterminista(const ModeloEstocastico &modelo)
+{
+    TRAZA_AMBITO("estocastico.equivalente", "calculo");
+    validarModeloEstocastico(modelo);
+
+    CoeficientesDosEtapas c(modelo);
+    ModeloLineal lineal = construirModeloLineal(modelo.produccion);
+    lineal.objetivo[0] = c.produccion[0];
+    lineal.objetivo[1] = c.produccion[1];
+    double constante = 0.0;
+    for (const auto &escenario : modelo.escenarios)
+    {
+        int ventaMesas = lineal.agregarVariable(escenario.probabilidad * c.venta[0], 0.0, escenario.demandaMesas);
+        int ventaSillas = lineal.agregarVariable(escenario.probabilidad * c.venta[1], 0.0, escenario.demandaSillas);
+        lineal.agregarFila({{ventaMesas, 1.0}, {0, -1.0}}, "<=", 0.0);
+        lineal.agregarFila({{ventaSillas, 1.0}, {1, -1.0}}, "<=", 0.0);
+        constante += escenario.probabilidad * constanteEscenario(modelo, escenario);
+    }
+
+    PlanEstocastico plan;
+    ResolvedorSimplex simplex;
+    simplex.cargar(lineal);
+    EstadoLP estado = simplex.resolver();
+    if (estado == LP_INFACTIBLE)
+    {
+        return plan;
+    }
+    if (estado != LP_OPTIMO)
+    {
+        throw runtime_error("El equivalente determinista no terminó correctamente (¿producción sin límite?).");
+    }
+
+    plan.produccion.x1 = simplex.getValor(0);
+    plan.produccion.x2 = simplex.getValor(1);
+    plan.produccion.gananciaMaxima = simplex.getValorObjetivo() + constante;
+    plan.produccion.solucionEncontrada = true;
+    plan.cotaEsperaVer = calcularEsperaVer(modelo);
+    plan.iteraciones = static_cast<int>(simplex.getIteraciones());
+    plan.convergio = true;
+    return plan;
+}
+
+// Estado de un escenario entre iteraciones de la cobertura progresiva
+struct SubproblemaEscenario
+{
+    ModeloCuadratico modelo; // Variables x₁, x₂, v₁, v₂; solo cambian c y la diagonal de Q
+    vector<double> x;        // Última solución (punto de arranque de la siguiente)
+    double w[2];             // Precios de no anticipación
+    EstadoLP estado;
+};
+
+static ModeloCuadratico construirSubproblema(const ModeloEstocastico &modelo, const EscenarioDemanda &escenario)
+{
+    CoeficientesDosEtapas c(modelo);
+    ModeloCuadratico cuadratico(4);
+    cuadratico.lineal = {c.produccion[0], c.produccion[1], c.venta[0], c.venta[1]};
+    for (const auto &r : modelo.produccion.restricciones)
+    {
+        OperadorLineal operador = r.operador == "<=" ? OperadorLineal::MenorIgual
+                                  : r.operador == ">=" ? OperadorLineal::MayorIgual
+                                                       : OperadorLineal::Igual;
+        cuadratico.agregarFila({r.coeficienteX1, r.coeficienteX2, 0.0, 0.0}, operador, r.valorConstante);
+    }
+    cuadratico.agregarFila({-1.0, 0.0, 1.0, 0.0}, OperadorLineal::MenorIgual, 0.0);
+    cuadratico.agregarFila({0.0, -1.0, 0.0, 1.0}, OperadorLineal::MenorIgual, 0.0);
+    cuadratico.agregarFila({0.0, 0.0, 1.0, 0.0}, OperadorLineal::MenorIgual, escenario.demandaMesas);
+    cuadratico.agregarFila({0.0, 0.0, 0.0, 1.0}, OperadorLineal::MenorIgual, escenario.demandaSillas);
+    for (int j = 0; j < 4; j++)
+    {
+        vector<double> cota(4, 0.0);
+        cota[j] = 1.0;
+        cuadratico.agregarFila(cota, OperadorLineal::MayorIgual, 0.0);
+    }
+    return cuadratico;
+}
+
+/**
+ * Cobertura progresiva. La iteración 0 resuelve cada escenario sin
+ * penalización (su óptimo con la demanda conocida). Después, con
+ * x̄ = Σ p_s·x_s, cada escenario maximiza
+ *     ganancia_s(x, v) - w_s·x - Σ_j ρ_j/2·(x_j - x̄_j)²
+ * y actualiza w_s += ρ·(x_s - x̄), hasta que todas las producciones
+ * coinciden. x̄ es combinación convexa de puntos factibles, así que siempre
+ * cumple las restricciones de producción
+ * @param modelo Modelo estocástico
+ * @param planificador Hilos para resolver los escenarios
+ * @param opciones ρ, tolerancia y límite de iteraciones
+ * @param token Cancelación o límite de tiempo (opcional)
+ * @return Plan x̄ con su ganancia esperada exacta
+ */
+PlanEstocastico resolverCoberturaProgresiva(const ModeloEstocastico &modelo, PlanificadorRobo &planificador,
+                                            const OpcionesCoberturaProgresiva &opciones, const TokenCancelacion *token)
+{
+    TRAZA_AMBITO("estocastico.coberturaProgresiva", "calculo");
+    validarModeloEstocastico(modelo);
+    if (!(opciones.multiplicadorRho > 0.0) || !(opciones.tolerancia > 0.0) || opciones.maxIteraciones < 1)
+    {
+        throw invalid_argument("Las opciones de la cobertura progresiva deben ser positivas.");
+    }
+
+    const size_t S = modelo.escenarios.size();
+    CoeficientesDosEtapas c(modelo);
+    vector<SubproblemaEscenario> subproblemas(S);
+
+    // Iteración 0: cada escenario por separado (arranque lineal dentro del resolvedor cuadrático)
+    planificador.ejecutar(S, [&](size_t s, unsigned)
+                          {
+        SubproblemaEscenario &sub = subproblemas[s];
+        sub.modelo = construirSubproblema(modelo, modelo.escenarios[s]);
+        sub.w[0] = sub.w[1] = 0.0;
+        ResultadoCuadratico resultado = resolverCuadratico(sub.modelo, QP_CONJUNTO_ACTIVO, token);
+        sub.estado = resultado.estado;
+        sub.x = resultado.x; });
+
+    PlanEstocastico plan;
+    for (size_t s = 0; s < S; s++)
+    {
+        if (subproblemas[s].estado == LP_INFACTIBLE)
+        {
+            return plan;
+        }
+        if (subproblemas[s].estado != LP_OPTIMO)
+        {
+            throw runtime_error("El escenario " + to_string(s + 1) +
+                                " no terminó correctamente (¿producción sin límite?).");
+        }
+        const EscenarioDemanda &escenario = modelo.escenarios[s];
+        plan.cotaEsperaVer += escenario.probabilidad * (subproblemas[s].modelo.evaluar(subproblemas[s].x) +
+                                                         constanteEscenario(modelo, escenario));
+    }
+
+    // ρ por variable: costo marginal de una unidad sobre la dispersión inicial de las producciones
+    double rho[2];
+    for (int j = 0; j < 2; j++)
+    {
+        double menor = INFINITO_LP, mayor = -INFINITO_LP;
+        for (const auto &sub : subproblemas)
+        {
+            menor = min(menor, sub.x[j]);
+            mayor = max(mayor, sub.x[j]);
+        }
+        double marginal = max(abs(c.produccion[j]), abs(c.produccion[j] + c.venta[j]));
+        rho[j] = opciones.multiplicadorRho * max(marginal, 1e-6) / max(1.0, mayor - menor);
+    }
+
+    double promedio[2] = {0.0, 0.0};
+    int iteracion = 0;
+    while (true)
+    {
+        if (token)
+        {
+            token->verificar();
+        }
+
+        promedio[0] = promedio[1] = 0.0;
+        for (size_t s = 0; s < S; s++)
+        {
+            promedio[0] += modelo.escenarios[s].probabilidad * subproblemas[s].x[0];
+            promedio[1] += modelo.escenarios[s].probabilidad * subproblemas[s].x[1];
+        }
+        double separacion = 0.0;
+        for (size_t s = 0; s < S; s++)
+        {
+            separacion += modelo.escenarios[s].probabilidad *
+                          (abs(subproblemas[s].x[0] - promedio[0]) + abs(subproblemas[s].x[1] - promedio[1]));
+        }
+        plan.residuo = separacion / max(1.0, abs(promedio[0]) + abs(promedio[1]));
+        if (plan.residuo <= opciones.tolerancia)
+        {
+            plan.convergio = true;
+            break;
+        }
+        if (iteracion >= opciones.maxIteraciones)
+        {
+            break;
+        }
+        iteracion++;
+
+        // Subproblemas en paralelo: cada tarea usa solo el estado de su escenario
+        planificador.ejecutar(S, [&](size_t s, unsigned)
+                              {
+            SubproblemaEscenario &sub = subproblemas[s];
+            for (int j = 0; j < 2; j++)
+            {
+                sub.w[j] += rho[j] * (sub.x[j] - promedio[j]);
+                sub.modelo.lineal[j] = c.produccion[j] - sub.w[j] + rho[j] * promedio[j];
+                sub.modelo.cuadratica[j * 4 + j] = rho[j];
+            }
+            ResultadoCuadratico resultado = resolverConjuntoActivo(sub.modelo, sub.x, token);
+            sub.estado = resultado.estado;
+            if (resultado.estado == LP_OPTIMO)
+            {
+                sub.x = resultado.x;
+            } });
+
+        for (size_t s = 0; s < S; s++)
+        {
+            if (subproblemas[s].estado != LP_OPTIMO)
+            {
+                throw runtime_error("El subproblema del escenario " + to_string(s + 1) + " no terminó correctamente.");
+            }
+        }
+    }
+
+    plan.produccion.x1 = promedio[0];
+    plan.produccion.x2 = promedio[1];
+    plan.produccion.gananciaMaxima = evaluarPlanEstocastico(modelo, promedio[0], promedio[1]);
+    plan.produccion.solucionEncontrada = true;
+    plan.iteraciones = iteracion;
+    return plan;
+}
+
+/**
+ * Caso Flair con la demanda de sillas incierta: compara el plan clásico
+ * (que ignora la demanda), el plan con la demanda promedio y el plan
+ * estocástico, y mide el equivalente determinista contra la cobertura
+ * progresiva con muchos escenarios
+ * @param escenarios Número de escenarios de demanda
+ */
+void ejecutarBenchmarkEstocastico(size_t escenarios)
+{
+    ModeloEstocastico modelo;
+    modelo.produccion.precioMesa = 120.0;
+    modelo.produccion.precioSilla = 45.0;
+    modelo.produccion.restricciones.push_back(4 * X1 + 3 * X2 <= 240);
+    modelo.produccion.restricciones.push_back(2 * X1 + X2 <= 100);
+    modelo.costoMesa = 50.0;
+    modelo.costoSilla = 30.0;
+    modelo.rescateMesa = 20.0;
+    modelo.rescateSilla = 5.0;
+    modelo.penalizacionMesa = 10.0;
+    modelo.penalizacionSilla = 2.0;
+
+    // Mesas por pedido fijo; sillas con demanda normal truncada en cero
+    mt19937 generador(2024);
+    normal_distribution<double> demandaSillas(40.0, 15.0);
+    escenarios = max<size_t>(escenarios, 1);
+    double demandaPromedio = 0.0;
+    for (size_t s = 0; s < escenarios; s++)
+    {
+        double demanda = max(0.0, demandaSillas(generador));
+        modelo.escenarios.push_back(EscenarioDemanda(1.0 / escenarios, 30.0, demanda));
+        demandaPromedio += demanda / escenarios;
+    }
+
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: DEMANDA ESTOCÁSTICA (DOS ETAPAS)" << endl;
+    cout << string(60, '=') << endl;
+    cout << "Escenarios: " << escenarios << " (30 mesas; sillas con media " << demandaPromedio << ")" << endl;
+
+    // Plan clásico: ganancia unitaria fija, sin demanda
+    ModeloProduccion clasico = modelo.produccion;
+    clasico.precioMesa -= modelo.costoMesa;
+    clasico.precioSilla -= modelo.costoSilla;
+    SolucionOptima planClasico = resolverPuntosExtremos(clasico.restricciones, clasico.precioMesa, clasico.precioSilla,
+                                                        pmr::new_delete_resource());
+
+    ModeloEstocastico promedio = modelo;
+    promedio.escenarios.assign(1, EscenarioDemanda(1.0, 30.0, demandaPromedio));
+    PlanEstocastico planPromedio = resolverEquivalenteDeterminista(promedio);
+
+    auto inicio = chrono::steady_clock::now();
+    PlanEstocastico equivalente = resolverEquivalenteDeterminista(modelo);
+    double segundosEquivalente = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    PlanificadorRobo planificador;
+    inicio = chrono::steady_clock::now();
+    PlanEstocastico cobertura = resolverCoberturaProgresiva(modelo, planificador);
+    double segundosCobertura = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    auto mostrarPlan = [&](const string &nombre, double mesas, double sillas)
+    {
+        cout << "  • " << nombre << ": " << mesas << " mesas, " << sillas << " sillas, ganancia esperada $"
+             << evaluarPlanEstocastico(modelo, mesas, sillas) << endl;
+    };
+    cout << "\nGanancia esperada de cada plan:" << endl;
+    mostrarPlan("Clásico (ganancia fija por unidad)", planClasico.x1, planClasico.x2);
+    mostrarPlan("Demanda promedio", planPromedio.produccion.x1, planPromedio.produccion.x2);
+    mostrarPlan("Estocástico", equivalente.produccion.x1, equivalente.produccion.x2);
+    cout << "  • Con la demanda conocida de antemano: $" << equivalente.cotaEsperaVer << endl;
+    cout << "  Valor de la solución estocástica: $"
+         << equivalente.produccion.gananciaMaxima - evaluarPlanEstocastico(modelo, planPromedio.produccion.x1,
+                                                                            planPromedio.produccion.x2)
+         << "; valor de la información perfecta: $" << equivalente.cotaEsperaVer - equivalente.produccion.gananciaMaxima
+         << endl;
+
+    cout << "\nEquivalente determinista (" << 2 * escenarios + 2 << " variables):" << endl;
+    cout << "  • Ganancia esperada: $" << equivalente.produccion.gananciaMaxima << endl;
+    cout << "  • Tiempo: " << segundosEquivalente * 1000 << " ms (" << equivalente.iteraciones << " iteraciones)"
+         << endl;
+    cout << "\nCobertura progresiva (" << planificador.getNumHilos() << " hilos):" << endl;
+    cout << "  • Plan: " << cobertura.produccion.x1 << " mesas, " << cobertura.produccion.x2 << " sillas" << endl;
+    cout << "  • Ganancia esperada: $" << cobertura.produccion.gananciaMaxima << endl;
+    cout << "  • Iteraciones: " << cobertura.iteraciones << " (residuo " << scientific << cobertura.residuo << fixed
+         << ")" << endl;
+    cout << "  • Tiempo: " << segundosCobertura * 1000 << " ms" << endl;
+
+    if (!cobertura.convergio)
+    {
+        mostrarMensajeError("La cobertura progresiva no convergió.");
+    }
+    if (abs(cobertura.produccion.gananciaMaxima - equivalente.produccion.gananciaMaxima) >
+        1e-3 * (1.0 + abs(equivalente.produccion.gananciaMaxima)))
+    {
+        mostrarMensajeError("Los dos métodos no coinciden en la ganancia esperada.");
+    }
+}
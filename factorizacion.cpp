@@ -0,0 +1,1341 @@
+/**
+ * MÓDULO DE FACTORIZACIÓN DISPERSA
+ * Matriz de restricciones por filas y por columnas, y factorización LU de la
+ * base del símplex (pivotes de Markowitz, actualizaciones de Forrest-Tomlin y
+ * FTRAN/BTRAN hiperdispersos)
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+using namespace std;
+
+static const double UMBRAL_PIVOTE_LU = 0.1;   // Fracción del mayor de la columna que debe alcanzar el pivote
+static const double TOL_PIVOTE_LU = 1e-11;    // Pivote mínimo (debajo, la base se considera singular)
+static const double TOL_CERO_LU = 1e-14;      // Valores menores se descartan en FTRAN y BTRAN
+static const double DENSIDAD_HIPERDISPERSA = 0.1; // Fracción de no nulos hasta la que conviene recorrer alcanzables
+static const int MAX_LINEAS_MARKOWITZ = 4;    // Filas o columnas revisadas por pivote, después de hallar uno
+
+// ===== MATRIZ DISPERSA =====
+
+MatrizDispersa::MatrizDispersa() : numFilas(0), numColumnas(0), inicioFila(1, 0), inicioColumna(1, 0)
+{
+}
+
+void MatrizDispersa::cargar(int filas, int columnas, const vector<vector<pair<int, double>>> &coeficientesPorFila)
+{
+    numFilas = filas;
+    numColumnas = columnas;
+    inicioFila.assign(1, 0);
+    columnaFila.clear();
+    valorFila.clear();
+
+    // Los coeficientes repetidos de una fila se suman en el lugar del primero
+    vector<int> lugar(columnas, -1);
+    for (int i = 0; i < filas; i++)
+    {
+        int primero = static_cast<int>(columnaFila.size());
+        for (const auto &coeficiente : coeficientesPorFila[i])
+        {
+            if (coeficiente.second == 0.0)
+                continue;
+            if (coeficiente.first < 0 || coeficiente.first >= columnas)
+                throw out_of_range("La fila hace referencia a una variable inexistente.");
+            if (lugar[coeficiente.first] >= 0)
+            {
+                valorFila[lugar[coeficiente.first]] += coeficiente.second;
+                continue;
+            }
+            lugar[coeficiente.first] = static_cast<int>(columnaFila.size());
+            columnaFila.push_back(coeficiente.first);
+            valorFila.push_back(coeficiente.second);
+        }
+        for (size_t p = primero; p < columnaFila.size(); p++)
+            lugar[columnaFila[p]] = -1;
+        inicioFila.push_back(static_cast<int>(columnaFila.size()));
+    }
+    armarColumnas();
+}
+
+void MatrizDispersa::armarColumnas()
+{
+    inicioColumna.assign(numColumnas + 1, 0);
+    for (int j : columnaFila)
+        inicioColumna[j + 1]++;
+    for (int j = 0; j < numColumnas; j++)
+        inicioColumna[j + 1] += inicioColumna[j];
+
+    // Recorrer las filas en orden deja cada columna ordenada por fila
+    filaColumna.resize(columnaFila.size());
+    valorColumna.resize(valorFila.size());
+    vector<int> libre(inicioColumna.begin(), inicioColumna.end() - 1);
+    for (int i = 0; i < numFilas; i++)
+    {
+        for (int p = inicioFila[i]; p < inicioFila[i + 1]; p++)
+        {
+            int destino = libre[columnaFila[p]]++;
+            filaColumna[destino] = i;
+            valorColumna[destino] = valorFila[p];
+        }
+    }
+}
+
+void MatrizDispersa::armarFilas()
+{
+    inicioFila.assign(numFilas + 1, 0);
+    for (int i : filaColumna)
+        inicioFila[i + 1]++;
+    for (int i = 0; i < numFilas; i++)
+        inicioFila[i + 1] += inicioFila[i];
+
+    columnaFila.resize(filaColumna.size());
+    valorFila.resize(valorColumna.size());
+    vector<int> libre(inicioFila.begin(), inicioFila.end() - 1);
+    for (int j = 0; j < numColumnas; j++)
+    {
+        for (int p = inicioColumna[j]; p < inicioColumna[j + 1]; p++)
+        {
+            int destino = libre[filaColumna[p]]++;
+            columnaFila[destino] = j;
+            valorFila[destino] = valorColumna[p];
+        }
+    }
+}
+
+// Nueva columna al final: se agrega a la vista por columnas y se rearma la otra
+void MatrizDispersa::agregarColumna(const vector<pair<int, double>> &columna)
+{
+    vector<pair<int, double>> ordenada;
+    for (const auto &coeficiente : columna)
+    {
+        if (coeficiente.first < 0 || coeficiente.first >= numFilas)
+            throw out_of_range("La columna hace referencia a una fila inexistente.");
+        if (coeficiente.second != 0.0)
+            ordenada.push_back(coeficiente);
+    }
+    sort(ordenada.begin(), ordenada.end(),
+         [](const pair<int, double> &a, const pair<int, double> &b)
+         { return a.first < b.first; });
+    for (size_t p = 0; p < ordenada.size(); p++)
+    {
+        if (p > 0 && ordenada[p].first == filaColumna.back())
+        {
+            valorColumna.back() += ordenada[p].second;
+            continue;
+        }
+        filaColumna.push_back(ordenada[p].first);
+        valorColumna.push_back(ordenada[p].second);
+    }
+    numColumnas++;
+    inicioColumna.push_back(static_cast<int>(filaColumna.size()));
+    armarFilas();
+}
+
+// Nueva fila al final: se agrega a la vista por filas y se rearma la otra
+void MatrizDispersa::agregarFila(const vector<pair<int, double>> &fila)
+{
+    vector<vector<pair<int, double>>> sola(1, fila);
+    MatrizDispersa nueva;
+    nueva.cargar(1, numColumnas, sola);
+    columnaFila.insert(columnaFila.end(), nueva.columnaFila.begin(), nueva.columnaFila.end());
+    valorFila.insert(valorFila.end(), nueva.valorFila.begin(), nueva.valorFila.end());
+    numFilas++;
+    inicioFila.push_back(static_cast<int>(columnaFila.size()));
+    armarColumnas();
+}
+
+void MatrizDispersa::quitarFilas(const vector<int> &nuevoIndice, int restantes)
+{
+    vector<int> nuevoInicio(1, 0);
+    size_t escritos = 0;
+    for (int i = 0; i < numFilas; i++)
+    {
+        if (nuevoIndice[i] < 0)
+            continue;
+        for (int p = inicioFila[i]; p < inicioFila[i + 1]; p++)
+        {
+            columnaFila[escritos] = columnaFila[p];
+            valorFila[escritos] = valorFila[p];
+            escritos++;
+        }
+        nuevoInicio.push_back(static_cast<int>(escritos));
+    }
+    columnaFila.resize(escritos);
+    valorFila.resize(escritos);
+    inicioFila.swap(nuevoInicio);
+    numFilas = restantes;
+    armarColumnas();
+}
+
+// ===== VECTOR DISPERSO =====
+
+void VectorDisperso::reiniciar(int dimension)
+{
+    if (static_cast<int>(valores.size()) != dimension)
+    {
+        valores.assign(dimension, 0.0);
+        marcas.assign(dimension, 0);
+        indices.clear();
+        return;
+    }
+    for (int i : indices)
+    {
+        valores[i] = 0.0;
+        marcas[i] = 0;
+    }
+    indices.clear();
+}
+
+void VectorDisperso::reconstruirIndices()
+{
+    for (int i : indices)
+        marcas[i] = 0;
+    indices.clear();
+    for (size_t i = 0; i < valores.size(); i++)
+    {
+        if (valores[i] != 0.0)
+        {
+            marcas[i] = 1;
+            indices.push_back(static_cast<int>(i));
+        }
+    }
+}
+
+void VectorDisperso::depurar(double tolerancia)
+{
+    size_t quedan = 0;
+    for (int i : indices)
+    {
+        if (abs(valores[i]) < tolerancia)
+        {
+            valores[i] = 0.0;
+            marcas[i] = 0;
+            continue;
+        }
+        indices[quedan++] = i;
+    }
+    indices.resize(quedan);
+}
+
+// ===== FACTORIZACIÓN LU =====
+
+void FactorizacionLU::ListaEtas::limpiar()
+{
+    pivote.clear();
+    inicio.assign(1, 0);
+    indice.clear();
+    valor.clear();
+}
+
+// Empieza una eta nueva (sus elementos son los que se agreguen después)
+void FactorizacionLU::ListaEtas::abrir(int fila)
+{
+    pivote.push_back(fila);
+    inicio.push_back(static_cast<int>(indice.size()));
+}
+
+// Orden topológico de los nodos alcanzables desde las semillas (búsqueda en
+// profundidad sin recursión): cada nodo queda antes que sus sucesores
+template <class Grado, class Vecino>
+static void ordenTopologico(const vector<int> &semillas, Grado grado, Vecino vecino, vector<char> &visitado,
+                            vector<int> &pila, vector<int> &siguiente, vector<int> &salida)
+{
+    salida.clear();
+    for (int semilla : semillas)
+    {
+        if (visitado[semilla])
+            continue;
+        visitado[semilla] = 1;
+        pila.assign(1, semilla);
+        siguiente.assign(1, 0);
+        while (!pila.empty())
+        {
+            size_t tope = pila.size() - 1;
+            int nodo = pila[tope];
+            if (siguiente[tope] < grado(nodo))
+            {
+                int sucesor = vecino(nodo, siguiente[tope]++);
+                if (!visitado[sucesor])
+                {
+                    visitado[sucesor] = 1;
+                    pila.push_back(sucesor);
+                    siguiente.push_back(0);
+                }
+                continue;
+            }
+            salida.push_back(nodo);
+            pila.pop_back();
+            siguiente.pop_back();
+        }
+    }
+    for (int nodo : salida)
+        visitado[nodo] = 0;
+    reverse(salida.begin(), salida.end());
+}
+
+// Quita el elemento con el índice dado de una lista (índice, valor)
+static void quitarDeLista(vector<pair<int, double>> &lista, int indice)
+{
+    for (size_t p = 0; p < lista.size(); p++)
+    {
+        if (lista[p].first == indice)
+        {
+            lista[p] = lista.back();
+            lista.pop_back();
+            return;
+        }
+    }
+}
+
+// Deja cantidad listas vacías, conservando la memoria de las que ya había
+template <class T>
+static void vaciarListas(vector<vector<T>> &listas, int cantidad)
+{
+    listas.resize(cantidad);
+    for (auto &lista : listas)
+        lista.clear();
+}
+
+FactorizacionLU::FactorizacionLU()
+    : densa(false), hiperdispersa(true), m(0), actualizaciones(0), noNulosFactorizacion(0), noNulosAgregados(0),
+      espigaValida(false), densidadFtran(0.0),
+      densidadBtran(0.0)
+{
+}
+
+void FactorizacionLU::dimensionarTrabajo()
+{
+    auxiliar.reiniciar(m);
+    espiga.reiniciar(m);
+    visitado.assign(m, 0);
+}
+
+long FactorizacionLU::getNoNulos() const
+{
+    if (densa)
+        return static_cast<long>(m) * m;
+    long total = static_cast<long>(etasL.valor.size() + etasR.valor.size()) + m;
+    for (const auto &fila : filasU)
+        total += static_cast<long>(fila.size());
+    return total;
+}
+
+// Gauss-Jordan con pivoteo parcial sobre la base armada en forma densa
+bool FactorizacionLU::factorizarDensa(const vector<int> &base, int n, const MatrizDispersa &matriz)
+{
+    size_t dim = static_cast<size_t>(m);
+    vector<double> densaB(dim * dim, 0.0);
+    for (int k = 0; k < m; k++)
+    {
+        int variable = base[k];
+        if (variable < n)
+        {
+            const int *filas = matriz.getFilasColumna(variable);
+            const double *valores = matriz.getValoresColumna(variable);
+            for (int p = 0; p < matriz.getLargoColumna(variable); p++)
+                densaB[filas[p] * dim + k] = valores[p];
+        }
+        else
+        {
+            densaB[(variable - n) * dim + k] = -1.0;
+        }
+    }
+
+    vector<double> nueva(dim * dim, 0.0);
+    for (size_t i = 0; i < dim; i++)
+    {
+        nueva[i * dim + i] = 1.0;
+    }
+
+    for (size_t col = 0; col < dim; col++)
+    {
+        size_t pivote = col;
+        for (size_t i = col + 1; i < dim; i++)
+        {
+            if (abs(densaB[i * dim + col]) > abs(densaB[pivote * dim + col]))
+            {
+                pivote = i;
+            }
+        }
+
+        if (abs(densaB[pivote * dim + col]) < TOL_PIVOTE_LU)
+            return false;
+
+        if (pivote != col)
+        {
+            swap_ranges(densaB.begin() + pivote * dim, densaB.begin() + (pivote + 1) * dim, densaB.begin() + col * dim);
+            swap_ranges(nueva.begin() + pivote * dim, nueva.begin() + (pivote + 1) * dim, nueva.begin() + col * dim);
+        }
+
+        double factor = 1.0 / densaB[col * dim + col];
+        for (size_t j = 0; j < dim; j++)
+        {
+            densaB[col * dim + j] *= factor;
+            nueva[col * dim + j] *= factor;
+        }
+
+        for (size_t i = 0; i < dim; i++)
+        {
+            double f = densaB[i * dim + col];
+            if (i != col && f != 0.0)
+            {
+                for (size_t j = 0; j < dim; j++)
+                {
+                    densaB[i * dim + j] -= f * densaB[col * dim + j];
+                    nueva[i * dim + j] -= f * nueva[col * dim + j];
+                }
+            }
+        }
+    }
+
+    inversa.swap(nueva);
+    return true;
+}
+
+/**
+ * Factoriza la base indicada (base[k] es la variable de la posición k; las
+ * variables desde n son lógicas). En cada paso se prefiere una columna con un
+ * solo elemento, después una fila con uno solo y, si no hay, se revisan las
+ * líneas con menos elementos buscando el menor (r - 1)·(c - 1) entre los
+ * pivotes que pasan el umbral. Devuelve false si la base es singular.
+ */
+bool FactorizacionLU::factorizar(const vector<int> &base, int n, const MatrizDispersa &matriz)
+{
+    m = static_cast<int>(base.size());
+    actualizaciones = 0;
+    espigaValida = false;
+    dimensionarTrabajo();
+    if (densa)
+        return factorizarDensa(base, n, matriz);
+
+    // Submatriz activa: por columnas con valores y por filas solo las posiciones
+    vector<vector<pair<int, double>>> &activaColumnas = eliminacion.columnas;
+    vector<vector<int>> &activaFilas = eliminacion.filas;
+    vaciarListas(activaColumnas, m);
+    vaciarListas(activaFilas, m);
+    for (int k = 0; k < m; k++)
+    {
+        int variable = base[k];
+        if (variable < n)
+        {
+            const int *filas = matriz.getFilasColumna(variable);
+            const double *valores = matriz.getValoresColumna(variable);
+            for (int p = 0; p < matriz.getLargoColumna(variable); p++)
+            {
+                activaColumnas[k].push_back(make_pair(filas[p], valores[p]));
+                activaFilas[filas[p]].push_back(k);
+            }
+        }
+        else
+        {
+            activaColumnas[k].push_back(make_pair(variable - n, -1.0));
+            activaFilas[variable - n].push_back(k);
+        }
+    }
+
+    // Listas por cantidad de elementos; una línea puede figurar en listas
+    // viejas y se descarta al encontrarla si su cantidad ya no coincide
+    vector<vector<int>> &columnasPorConteo = eliminacion.columnasPorConteo;
+    vector<vector<int>> &filasPorConteo = eliminacion.filasPorConteo;
+    vector<char> &columnaHecha = eliminacion.columnaHecha;
+    vector<char> &filaHecha = eliminacion.filaHecha;
+    vaciarListas(columnasPorConteo, m + 1);
+    vaciarListas(filasPorConteo, m + 1);
+    columnaHecha.assign(m, 0);
+    filaHecha.assign(m, 0);
+    for (int k = 0; k < m; k++)
+    {
+        columnasPorConteo[activaColumnas[k].size()].push_back(k);
+        filasPorConteo[activaFilas[k].size()].push_back(k);
+    }
+    auto columnaVigente = [&](int c, size_t conteo)
+    { return !columnaHecha[c] && activaColumnas[c].size() == conteo; };
+    auto filaVigente = [&](int r, size_t conteo)
+    { return !filaHecha[r] && activaFilas[r].size() == conteo; };
+    auto mayorDeColumna = [&](int c)
+    {
+        double mayor = 0.0;
+        for (const auto &elemento : activaColumnas[c])
+            mayor = max(mayor, abs(elemento.second));
+        return mayor;
+    };
+    auto valorEn = [&](int r, int c)
+    {
+        for (const auto &elemento : activaColumnas[c])
+        {
+            if (elemento.first == r)
+                return elemento.second;
+        }
+        return 0.0;
+    };
+
+    etasL.limpiar();
+    etasR.limpiar();
+    vaciarListas(filasU, m);
+    vaciarListas(columnasU, m);
+    diagonal.assign(m, 0.0);
+    columnaDeFila.assign(m, -1);
+    filaDeColumna.assign(m, -1);
+    etaDeFila.assign(m, -1);
+    orden.clear();
+    lugarEnOrden.assign(m, -1);
+    vector<int> &lugarEnColumna = eliminacion.lugarEnColumna;
+    lugarEnColumna.assign(m, -1);
+
+    for (int paso = 0; paso < m; paso++)
+    {
+        int filaPivote = -1;
+        int columnaPivote = -1;
+
+        // Una columna vacía deja la base singular
+        for (int c : columnasPorConteo[0])
+        {
+            if (columnaVigente(c, 0))
+                return false;
+        }
+
+        // Columna con un solo elemento
+        vector<int> &singulares = columnasPorConteo[1];
+        while (!singulares.empty() && columnaPivote < 0)
+        {
+            int c = singulares.back();
+            singulares.pop_back();
+            if (!columnaVigente(c, 1))
+                continue;
+            if (abs(activaColumnas[c][0].second) < TOL_PIVOTE_LU)
+                return false;
+            columnaPivote = c;
+            filaPivote = activaColumnas[c][0].first;
+        }
+
+        // Fila con un solo elemento que pase el umbral
+        vector<int> &filasSolas = filasPorConteo[1];
+        for (size_t p = 0; p < filasSolas.size() && columnaPivote < 0;)
+        {
+            int r = filasSolas[p];
+            if (!filaVigente(r, 1))
+            {
+                filasSolas[p] = filasSolas.back();
+                filasSolas.pop_back();
+                continue;
+            }
+            int c = activaFilas[r][0];
+            double a = abs(valorEn(r, c));
+            if (a >= TOL_PIVOTE_LU && a >= UMBRAL_PIVOTE_LU * mayorDeColumna(c))
+            {
+                columnaPivote = c;
+                filaPivote = r;
+            }
+            p++;
+        }
+
+        // Markowitz sobre las líneas más cortas
+        if (columnaPivote < 0)
+        {
+            long mejorMerito = -1;
+            double mejorValor = 0.0;
+            int revisadas = 0;
+            auto considerar = [&](int r, int c, double a)
+            {
+                long merito = static_cast<long>(activaFilas[r].size() - 1) * static_cast<long>(activaColumnas[c].size() - 1);
+                if (mejorMerito < 0 || merito < mejorMerito || (merito == mejorMerito && abs(a) > mejorValor))
+                {
+                    mejorMerito = merito;
+                    mejorValor = abs(a);
+                    filaPivote = r;
+                    columnaPivote = c;
+                }
+            };
+            for (int conteo = 1; conteo <= m && !(mejorMerito >= 0 && revisadas >= MAX_LINEAS_MARKOWITZ); conteo++)
+            {
+                vector<int> &columnasConteo = columnasPorConteo[conteo];
+                for (size_t p = 0; p < columnasConteo.size() && !(mejorMerito >= 0 && revisadas >= MAX_LINEAS_MARKOWITZ);)
+                {
+                    int c = columnasConteo[p];
+                    if (!columnaVigente(c, conteo))
+                    {
+                        columnasConteo[p] = columnasConteo.back();
+                        columnasConteo.pop_back();
+                        continue;
+                    }
+                    double mayor = mayorDeColumna(c);
+                    for (const auto &elemento : activaColumnas[c])
+                    {
+                        double a = elemento.second;
+                        if (abs(a) >= TOL_PIVOTE_LU && abs(a) >= UMBRAL_PIVOTE_LU * mayor)
+                            considerar(elemento.first, c, a);
+                    }
+                    revisadas++;
+                    p++;
+                }
+                vector<int> &filasConteo = filasPorConteo[conteo];
+                for (size_t p = 0; p < filasConteo.size() && !(mejorMerito >= 0 && revisadas >= MAX_LINEAS_MARKOWITZ);)
+                {
+                    int r = filasConteo[p];
+                    if (!filaVigente(r, conteo))
+                    {
+                        filasConteo[p] = filasConteo.back();
+                        filasConteo.pop_back();
+                        continue;
+                    }
+                    for (int c : activaFilas[r])
+                    {
+                        double a = valorEn(r, c);
+                        if (abs(a) >= TOL_PIVOTE_LU && abs(a) >= UMBRAL_PIVOTE_LU * mayorDeColumna(c))
+                            considerar(r, c, a);
+                    }
+                    revisadas++;
+                    p++;
+                }
+                if (mejorMerito == 0)
+                    break;
+            }
+            if (columnaPivote < 0)
+                return false;
+        }
+
+        // Registrar el pivote
+        double pivote = valorEn(filaPivote, columnaPivote);
+        diagonal[filaPivote] = pivote;
+        columnaDeFila[filaPivote] = columnaPivote;
+        filaDeColumna[columnaPivote] = filaPivote;
+        lugarEnOrden[filaPivote] = static_cast<int>(orden.size());
+        orden.push_back(filaPivote);
+        columnaHecha[columnaPivote] = 1;
+        filaHecha[filaPivote] = 1;
+
+        // La fila pivote (sin el pivote) pasa a U y sale de sus columnas
+        vector<pair<int, double>> &filaU = filasU[filaPivote];
+        for (int c : activaFilas[filaPivote])
+        {
+            if (c == columnaPivote)
+                continue;
+            double u = valorEn(filaPivote, c);
+            quitarDeLista(activaColumnas[c], filaPivote);
+            columnasPorConteo[activaColumnas[c].size()].push_back(c);
+            if (u != 0.0)
+            {
+                filaU.push_back(make_pair(c, u));
+                columnasU[c].push_back(make_pair(filaPivote, u));
+            }
+        }
+        activaFilas[filaPivote].clear();
+
+        // Multiplicadores de la columna pivote: la columna eta de L
+        vector<pair<int, double>> &multiplicadores = eliminacion.multiplicadores;
+        multiplicadores.clear();
+        for (const auto &elemento : activaColumnas[columnaPivote])
+        {
+            int r = elemento.first;
+            if (r == filaPivote)
+                continue;
+            multiplicadores.push_back(make_pair(r, elemento.second / pivote));
+            vector<int> &filaActiva = activaFilas[r];
+            filaActiva.erase(find(filaActiva.begin(), filaActiva.end(), columnaPivote));
+        }
+        activaColumnas[columnaPivote].clear();
+        if (!multiplicadores.empty())
+        {
+            etaDeFila[filaPivote] = etasL.cantidad();
+            etasL.abrir(filaPivote);
+            for (const auto &multiplicador : multiplicadores)
+            {
+                etasL.indice.push_back(multiplicador.first);
+                etasL.valor.push_back(multiplicador.second);
+            }
+            etasL.inicio.back() = static_cast<int>(etasL.indice.size());
+        }
+
+        // Eliminación: a_ic -= l_i·u_c en cada columna de la fila pivote
+        for (const auto &elementoU : filaU)
+        {
+            int c = elementoU.first;
+            vector<pair<int, double>> &columna = activaColumnas[c];
+            for (size_t p = 0; p < columna.size(); p++)
+                lugarEnColumna[columna[p].first] = static_cast<int>(p);
+            for (const auto &multiplicador : multiplicadores)
+            {
+                int r = multiplicador.first;
+                double cambio = -multiplicador.second * elementoU.second;
+                if (lugarEnColumna[r] >= 0)
+                {
+                    columna[lugarEnColumna[r]].second += cambio;
+                    continue;
+                }
+                lugarEnColumna[r] = static_cast<int>(columna.size());
+                columna.push_back(make_pair(r, cambio));
+                activaFilas[r].push_back(c);
+            }
+            for (const auto &elemento : columna)
+                lugarEnColumna[elemento.first] = -1;
+            columnasPorConteo[columna.size()].push_back(c);
+        }
+        for (const auto &multiplicador : multiplicadores)
+            filasPorConteo[activaFilas[multiplicador.first].size()].push_back(multiplicador.first);
+    }
+
+    // Los multiplicadores de L agrupados por fila, para BTRAN
+    transpuestaL.limpiar();
+    vector<int> cantidadPorFila(m + 1, 0);
+    for (int i : etasL.indice)
+        cantidadPorFila[i + 1]++;
+    for (int i = 0; i < m; i++)
+    {
+        transpuestaL.pivote.push_back(i);
+        transpuestaL.inicio.push_back(transpuestaL.inicio.back() + cantidadPorFila[i + 1]);
+    }
+    transpuestaL.indice.resize(etasL.indice.size());
+    transpuestaL.valor.resize(etasL.valor.size());
+    vector<int> libre(transpuestaL.inicio.begin(), transpuestaL.inicio.end() - 1);
+    for (int k = 0; k < etasL.cantidad(); k++)
+    {
+        for (int p = etasL.inicio[k]; p < etasL.inicio[k + 1]; p++)
+        {
+            int destino = libre[etasL.indice[p]]++;
+            transpuestaL.indice[destino] = etasL.pivote[k];
+            transpuestaL.valor[destino] = etasL.valor[p];
+        }
+    }
+    noNulosFactorizacion = getNoNulos();
+    noNulosAgregados = 0;
+    return true;
+}
+
+// El recorrido por alcanzables solo conviene si el lado derecho y los
+// resultados recientes tienen pocos no nulos
+bool FactorizacionLU::usarHiperdispersa(const VectorDisperso &x, double densidadEsperada) const
+{
+    return hiperdispersa && x.indices.size() < DENSIDAD_HIPERDISPERSA * m && densidadEsperada < DENSIDAD_HIPERDISPERSA;
+}
+
+void FactorizacionLU::registrarDensidad(const VectorDisperso &x, double &densidad) const
+{
+    densidad = 0.9 * densidad + 0.1 * static_cast<double>(x.indices.size()) / max(1, m);
+}
+
+// Resuelve U·z = x: x viene por filas y z queda en x por posiciones
+void FactorizacionLU::resolverU(VectorDisperso &x, double densidadEsperada) const
+{
+    auxiliar.reiniciar(m);
+    auto despejar = [&](int r)
+    {
+        double v = x.valores[r];
+        if (v == 0.0)
+            return;
+        int c = columnaDeFila[r];
+        double z = v / diagonal[r];
+        auxiliar.sumar(c, z);
+        for (const auto &elemento : columnasU[c])
+            x.sumar(elemento.first, -elemento.second * z);
+    };
+
+    if (usarHiperdispersa(x, densidadEsperada))
+    {
+        ordenTopologico(
+            x.indices, [&](int r)
+            { return static_cast<int>(columnasU[columnaDeFila[r]].size()); },
+            [&](int r, int t)
+            { return columnasU[columnaDeFila[r]][t].first; },
+            visitado, pila, siguiente, recorrido);
+        for (int r : recorrido)
+            despejar(r);
+    }
+    else
+    {
+        for (int t = static_cast<int>(orden.size()) - 1; t >= 0; t--)
+        {
+            if (orden[t] >= 0)
+                despejar(orden[t]);
+        }
+    }
+    x.reiniciar(m);
+    swap(x.valores, auxiliar.valores);
+    swap(x.indices, auxiliar.indices);
+    swap(x.marcas, auxiliar.marcas);
+}
+
+// Resuelve zᵀ·U = xᵀ: x viene por posiciones y z queda en x por filas
+void FactorizacionLU::resolverUTranspuesta(VectorDisperso &x, double densidadEsperada) const
+{
+    auxiliar.reiniciar(m);
+    auto despejar = [&](int c)
+    {
+        double v = x.valores[c];
+        if (v == 0.0)
+            return;
+        int r = filaDeColumna[c];
+        double z = v / diagonal[r];
+        auxiliar.sumar(r, z);
+        for (const auto &elemento : filasU[r])
+            x.sumar(elemento.first, -elemento.second * z);
+    };
+
+    if (usarHiperdispersa(x, densidadEsperada))
+    {
+        ordenTopologico(
+            x.indices, [&](int c)
+            { return static_cast<int>(filasU[filaDeColumna[c]].size()); },
+            [&](int c, int t)
+            { return filasU[filaDeColumna[c]][t].first; },
+            visitado, pila, siguiente, recorrido);
+        for (int c : recorrido)
+            despejar(c);
+    }
+    else
+    {
+        for (int r : orden)
+        {
+            if (r >= 0)
+                despejar(columnaDeFila[r]);
+        }
+    }
+    x.reiniciar(m);
+    swap(x.valores, auxiliar.valores);
+    swap(x.indices, auxiliar.indices);
+    swap(x.marcas, auxiliar.marcas);
+}
+
+/**
+ * FTRAN: x := B⁻¹·x = U⁻¹·R·L⁻¹·x. Con guardarEspiga se conserva R·L⁻¹·x,
+ * que es la columna que ocupará U si esta variable entra a la base.
+ */
+void FactorizacionLU::ftran(VectorDisperso &x, bool guardarEspiga)
+{
+    if (densa)
+    {
+        // Sumas en el orden de las columnas de B⁻¹, como en el producto completo
+        auxiliar.reiniciar(m);
+        double *resultado = auxiliar.valores.data();
+        for (int j = 0; j < m; j++)
+        {
+            double v = x.valores[j];
+            if (v == 0.0)
+                continue;
+            for (int i = 0; i < m; i++)
+                resultado[i] += inversa[static_cast<size_t>(i) * m + j] * v;
+        }
+        swap(x.valores, auxiliar.valores);
+        auxiliar.valores.assign(m, 0.0);
+        x.reconstruirIndices();
+        return;
+    }
+
+    // L⁻¹: cada eta resta su columna por el valor de su fila pivote
+    auto aplicarEtaL = [&](int k)
+    {
+        double v = x.valores[etasL.pivote[k]];
+        if (v == 0.0)
+            return;
+        for (int p = etasL.inicio[k]; p < etasL.inicio[k + 1]; p++)
+            x.sumar(etasL.indice[p], -etasL.valor[p] * v);
+    };
+    if (usarHiperdispersa(x, densidadFtran))
+    {
+        ordenTopologico(
+            x.indices, [&](int r)
+            { return etaDeFila[r] < 0 ? 0 : etasL.inicio[etaDeFila[r] + 1] - etasL.inicio[etaDeFila[r]]; },
+            [&](int r, int t)
+            { return etasL.indice[etasL.inicio[etaDeFila[r]] + t]; },
+            visitado, pila, siguiente, recorrido);
+        for (int r : recorrido)
+        {
+            if (etaDeFila[r] >= 0)
+                aplicarEtaL(etaDeFila[r]);
+        }
+    }
+    else
+    {
+        for (int k = 0; k < etasL.cantidad(); k++)
+            aplicarEtaL(k);
+    }
+
+    // R: cada fila eta resta a su fila la combinación de las otras
+    for (int t = 0; t < etasR.cantidad(); t++)
+    {
+        double suma = 0.0;
+        for (int p = etasR.inicio[t]; p < etasR.inicio[t + 1]; p++)
+            suma += etasR.valor[p] * x.valores[etasR.indice[p]];
+        if (suma != 0.0)
+            x.sumar(etasR.pivote[t], -suma);
+    }
+    x.depurar(TOL_CERO_LU);
+
+    if (guardarEspiga)
+    {
+        espiga.reiniciar(m);
+        for (int i : x.indices)
+            espiga.sumar(i, x.valores[i]);
+        espigaValida = true;
+    }
+
+    resolverU(x, densidadFtran);
+    x.depurar(TOL_CERO_LU);
+    registrarDensidad(x, densidadFtran);
+}
+
+// BTRAN: xᵀ := xᵀ·B⁻¹ = ((xᵀ·U⁻¹)·R)·L⁻¹
+void FactorizacionLU::btran(VectorDisperso &x) const
+{
+    if (densa)
+    {
+        auxiliar.reiniciar(m);
+        double *resultado = auxiliar.valores.data();
+        for (int i = 0; i < m; i++)
+        {
+            double c = x.valores[i];
+            if (c == 0.0)
+                continue;
+            const double *fila = &inversa[static_cast<size_t>(i) * m];
+            for (int j = 0; j < m; j++)
+                resultado[j] += c * fila[j];
+        }
+        swap(x.valores, auxiliar.valores);
+        auxiliar.valores.assign(m, 0.0);
+        x.reconstruirIndices();
+        return;
+    }
+
+    resolverUTranspuesta(x, densidadBtran);
+
+    // R transpuesta, de la última fila eta a la primera
+    for (int t = etasR.cantidad() - 1; t >= 0; t--)
+    {
+        double v = x.valores[etasR.pivote[t]];
+        if (v == 0.0)
+            continue;
+        for (int p = etasR.inicio[t]; p < etasR.inicio[t + 1]; p++)
+            x.sumar(etasR.indice[p], -etasR.valor[p] * v);
+    }
+
+    // L⁻¹ transpuesta: la fila pivote de cada eta recibe Σ l_i·x_i
+    if (usarHiperdispersa(x, densidadBtran))
+    {
+        ordenTopologico(
+            x.indices, [&](int i)
+            { return transpuestaL.inicio[i + 1] - transpuestaL.inicio[i]; },
+            [&](int i, int t)
+            { return transpuestaL.indice[transpuestaL.inicio[i] + t]; },
+            visitado, pila, siguiente, recorrido);
+        for (int i : recorrido)
+        {
+            double v = x.valores[i];
+            if (v == 0.0)
+                continue;
+            for (int p = transpuestaL.inicio[i]; p < transpuestaL.inicio[i + 1]; p++)
+                x.sumar(transpuestaL.indice[p], -transpuestaL.valor[p] * v);
+        }
+    }
+    else
+    {
+        for (int k = etasL.cantidad() - 1; k >= 0; k--)
+        {
+            double suma = 0.0;
+            for (int p = etasL.inicio[k]; p < etasL.inicio[k + 1]; p++)
+                suma += etasL.valor[p] * x.valores[etasL.indice[p]];
+            if (suma != 0.0)
+                x.sumar(etasL.pivote[k], -suma);
+        }
+    }
+    x.depurar(TOL_CERO_LU);
+    registrarDensidad(x, densidadBtran);
+}
+
+/**
+ * Cambio de base en la posición indicada; alfa = B⁻¹·a_q de la entrante (su
+ * FTRAN debe haber guardado la espiga). Forrest-Tomlin: la espiga reemplaza a
+ * la columna de U, la fila pivote de esa posición pasa al final del orden y
+ * sus elementos se eliminan con las filas siguientes (una fila eta de R). El
+ * pivote nuevo debe coincidir con pivote viejo·alfa[posicion]; si no, o si la
+ * versión densa pierde precisión, devuelve false para refactorizar.
+ */
+bool FactorizacionLU::actualizar(int posicion, const VectorDisperso &alfa)
+{
+    actualizaciones++;
+    double pivoteAlfa = alfa.valores[posicion];
+    if (densa)
+    {
+        double *filaPivote = &inversa[static_cast<size_t>(posicion) * m];
+        double inversoPivote = 1.0 / pivoteAlfa;
+        for (int j = 0; j < m; j++)
+        {
+            filaPivote[j] *= inversoPivote;
+        }
+
+        for (int i = 0; i < m; i++)
+        {
+            double f = alfa.valores[i];
+            if (i == posicion || f == 0.0)
+                continue;
+            double *filaI = &inversa[static_cast<size_t>(i) * m];
+            for (int j = 0; j < m; j++)
+            {
+                filaI[j] -= f * filaPivote[j];
+            }
+        }
+        return true;
+    }
+
+    if (!espigaValida)
+        return false;
+    espigaValida = false;
+    int fila = filaDeColumna[posicion];
+    double esperado = diagonal[fila] * pivoteAlfa;
+
+    // Sale la columna vieja de U
+    for (const auto &elemento : columnasU[posicion])
+        quitarDeLista(filasU[elemento.first], posicion);
+    columnasU[posicion].clear();
+
+    // La fila pivote queda fuera de la diagonal en el orden nuevo: eliminarla
+    // con las filas que le siguen, de la primera a la última
+    VectorDisperso &resto = auxiliar;
+    resto.reiniciar(m);
+    for (const auto &elemento : filasU[fila])
+    {
+        quitarDeLista(columnasU[elemento.first], fila);
+        resto.sumar(elemento.first, elemento.second);
+    }
+    filasU[fila].clear();
+
+    vector<pair<int, int>> monticulo; // (-lugar en el orden, posición)
+    for (int c : resto.indices)
+        monticulo.push_back(make_pair(-lugarEnOrden[filaDeColumna[c]], c));
+    make_heap(monticulo.begin(), monticulo.end());
+    etasR.abrir(fila);
+    double nuevoPivote = espiga.valores[fila];
+    while (!monticulo.empty())
+    {
+        pop_heap(monticulo.begin(), monticulo.end());
+        int c = monticulo.back().second;
+        monticulo.pop_back();
+        double v = resto.valores[c];
+        resto.valores[c] = 0.0;
+        if (v == 0.0)
+            continue;
+
+        int otra = filaDeColumna[c];
+        double multiplicador = v / diagonal[otra];
+        etasR.indice.push_back(otra);
+        etasR.valor.push_back(multiplicador);
+        nuevoPivote -= multiplicador * espiga.valores[otra];
+        for (const auto &elemento : filasU[otra])
+        {
+            if (!resto.marcas[elemento.first])
+            {
+                monticulo.push_back(make_pair(-lugarEnOrden[filaDeColumna[elemento.first]], elemento.first));
+                push_heap(monticulo.begin(), monticulo.end());
+            }
+            resto.sumar(elemento.first, -multiplicador * elemento.second);
+        }
+    }
+    etasR.inicio.back() = static_cast<int>(etasR.indice.size());
+    if (etasR.inicio[etasR.cantidad() - 1] == etasR.inicio.back())
+    {
+        etasR.pivote.pop_back();
+        etasR.inicio.pop_back();
+    }
+    resto.reiniciar(m);
+
+    // Entra la espiga como columna de U, con la fila pivote al final del orden
+    for (int i : espiga.indices)
+    {
+        double s = espiga.valores[i];
+        if (i == fila || s == 0.0)
+            continue;
+        columnasU[posicion].push_back(make_pair(i, s));
+        filasU[i].push_back(make_pair(posicion, s));
+    }
+    diagonal[fila] = nuevoPivote;
+    orden[lugarEnOrden[fila]] = -1;
+    lugarEnOrden[fila] = static_cast<int>(orden.size());
+    orden.push_back(fila);
+    noNulosAgregados += static_cast<long>(columnasU[posicion].size()) + etasR.inicio.back() - etasR.inicio[etasR.cantidad() - 1];
+
+    // También conviene refactorizar cuando las actualizaciones duplicaron los factores
+    return abs(nuevoPivote) >= TOL_PIVOTE_LU && abs(nuevoPivote - esperado) <= 1e-8 * max(1.0, abs(nuevoPivote)) &&
+           noNulosAgregados <= noNulosFactorizacion;
+}
+
+/**
+ * Agrega una fila a B con su variable lógica básica en la posición nueva:
+ * B' = [B 0; a_B -1]. La fila nueva se elimina contra U con una fila eta de R
+ * (zᵀ·U = a_B) y queda al final del orden con pivote -1.
+ */
+void FactorizacionLU::agregarFila(const vector<pair<int, double>> &coeficientesBase)
+{
+    int nueva = m;
+    actualizaciones++;
+    espigaValida = false;
+
+    if (densa)
+    {
+        m++;
+        // B'⁻¹ = [B⁻¹ 0; a_B·B⁻¹ -1]
+        vector<double> ampliada(static_cast<size_t>(m) * m, 0.0);
+        for (int i = 0; i < nueva; i++)
+        {
+            copy(inversa.begin() + static_cast<size_t>(i) * nueva, inversa.begin() + static_cast<size_t>(i + 1) * nueva,
+                 ampliada.begin() + static_cast<size_t>(i) * m);
+        }
+        vector<double> filaBase(nueva, 0.0);
+        for (const auto &coeficiente : coeficientesBase)
+            filaBase[coeficiente.first] += coeficiente.second;
+        for (int i = 0; i < nueva; i++)
+        {
+            double f = filaBase[i];
+            if (f == 0.0)
+                continue;
+            for (int j = 0; j < nueva; j++)
+            {
+                ampliada[static_cast<size_t>(nueva) * m + j] += f * inversa[static_cast<size_t>(i) * nueva + j];
+            }
+        }
+        ampliada[static_cast<size_t>(nueva) * m + nueva] = -1.0;
+        inversa.swap(ampliada);
+        dimensionarTrabajo();
+        return;
+    }
+
+    VectorDisperso z;
+    z.reiniciar(nueva);
+    for (const auto &coeficiente : coeficientesBase)
+        z.sumar(coeficiente.first, coeficiente.second);
+    resolverUTranspuesta(z, densidadBtran);
+    z.depurar(TOL_CERO_LU);
+    m++;
+
+    filasU.push_back(vector<pair<int, double>>());
+    columnasU.push_back(vector<pair<int, double>>());
+    diagonal.push_back(-1.0);
+    columnaDeFila.push_back(nueva);
+    filaDeColumna.push_back(nueva);
+    etaDeFila.push_back(-1);
+    transpuestaL.pivote.push_back(nueva);
+    transpuestaL.inicio.push_back(transpuestaL.inicio.back());
+    lugarEnOrden.push_back(static_cast<int>(orden.size()));
+    orden.push_back(nueva);
+    if (!z.indices.empty())
+    {
+        etasR.abrir(nueva);
+        for (int i : z.indices)
+        {
+            etasR.indice.push_back(i);
+            etasR.valor.push_back(z.valores[i]);
+        }
+        etasR.inicio.back() = static_cast<int>(etasR.indice.size());
+    }
+    dimensionarTrabajo();
+}
+
+// ===== BENCHMARK =====
+
+// Plan multiproducto y multiperíodo: producción e inventario de cada producto
+// en cada período. Las ventas (producción + inventario anterior - inventario
+// final) van de 0 a la demanda y cada producto usa dos de los recursos, cuya
+// capacidad por período no alcanza para toda la demanda
+static ModeloLineal construirPlanMultiproducto(int productos, int periodos, int recursos, unsigned semilla)
+{
+    mt19937 generador(semilla);
+    uniform_real_distribution<double> uniforme(0.0, 1.0);
+    ModeloLineal modelo;
+    int celdas = productos * periodos;
+    vector<double> precio(productos);
+    vector<double> demanda(celdas);
+    vector<pair<int, int>> usos(productos);
+    for (int p = 0; p < productos; p++)
+    {
+        precio[p] = round(20 + 30 * uniforme(generador));
+        usos[p] = make_pair(static_cast<int>(generador() % recursos), static_cast<int>(generador() % recursos));
+    }
+
+    // Producción (p, t) en p·periodos + t; el inventario, a continuación
+    for (int p = 0; p < productos; p++)
+    {
+        for (int t = 0; t < periodos; t++)
+        {
+            double costoEstacional = precio[p] * (0.4 + 0.3 * uniforme(generador) + 0.2 * sin(6.2832 * t / periodos));
+            modelo.agregarVariable(precio[p] - costoEstacional);
+            demanda[p * periodos + t] = round(10 + 40 * uniforme(generador));
+        }
+    }
+    for (int p = 0; p < productos; p++)
+    {
+        double almacenaje = round(1 + 2 * uniforme(generador));
+        for (int t = 0; t < periodos; t++)
+            modelo.agregarVariable(t + 1 < periodos ? -almacenaje : -precio[p] - almacenaje);
+    }
+
+    for (int p = 0; p < productos; p++)
+    {
+        for (int t = 0; t < periodos; t++)
+        {
+            int celda = p * periodos + t;
+            vector<pair<int, double>> fila;
+            fila.push_back(make_pair(celda, 1.0));
+            if (t > 0)
+                fila.push_back(make_pair(celdas + celda - 1, 1.0));
+            fila.push_back(make_pair(celdas + celda, -1.0));
+            modelo.agregarFila(fila, "<=", demanda[celda]);
+            modelo.filaInferior.back() = 0.0;
+        }
+    }
+
+    for (int r = 0; r < recursos; r++)
+    {
+        for (int t = 0; t < periodos; t++)
+        {
+            vector<pair<int, double>> fila;
+            double necesario = 0.0;
+            for (int p = 0; p < productos; p++)
+            {
+                int veces = (usos[p].first == r ? 1 : 0) + (usos[p].second == r ? 1 : 0);
+                if (veces == 0)
+                    continue;
+                double uso = veces * round(1 + 4 * uniforme(generador));
+                fila.push_back(make_pair(p * periodos + t, uso));
+                necesario += uso * demanda[p * periodos + t];
+            }
+            if (!fila.empty())
+                modelo.agregarFila(fila, "<=", round(0.6 * necesario));
+        }
+    }
+    return modelo;
+}
+
+/**
+ * Compara la base guardada como B⁻¹ densa con la LU dispersa (con y sin
+ * FTRAN/BTRAN hiperdispersos) en planes multiproducto, y mide las
+ * resoluciones con la base óptima del plan grande
+ */
+void ejecutarBenchmarkFactorizacion()
+{
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: FACTORIZACIÓN DISPERSA DE LA BASE" << endl;
+    cout << string(60, '=') << endl;
+
+    struct Configuracion
+    {
+        string nombre;
+        bool dispersa;
+        bool hiperdispersa;
+    };
+    vector<Configuracion> configuraciones = {{"B⁻¹ densa", false, false},
+                                             {"LU dispersa", true, false},
+                                             {"LU dispersa + FTRAN/BTRAN hiperdispersos", true, true}};
+
+    struct Plan
+    {
+        int productos;
+        int periodos;
+        int recursos;
+    };
+    ResolvedorSimplex optimoGrande;
+    for (const Plan &plan : {Plan{40, 8, 12}, Plan{300, 12, 300}})
+    {
+        ModeloLineal modelo = construirPlanMultiproducto(plan.productos, plan.periodos, plan.recursos, 5);
+        MatrizDispersa matriz;
+        matriz.cargar(modelo.getNumFilas(), modelo.getNumVariables(), modelo.filas);
+        bool grande = plan.productos > 100;
+        cout << "\nPlan de " << plan.productos << " productos y " << plan.periodos << " períodos: "
+             << modelo.getNumFilas() << " filas, " << modelo.getNumVariables() << " columnas, " << matriz.getNoNulos()
+             << " no nulos (" << static_cast<double>(matriz.getNoNulos()) / modelo.getNumFilas() << " por fila)"
+             << endl;
+
+        double referencia = 0.0;
+        bool hayReferencia = false;
+        for (const Configuracion &configuracion : configuraciones)
+        {
+            if (grande && !configuracion.dispersa)
+            {
+                cout << "  • " << configuracion.nombre << ": se omite (B⁻¹ ocuparía "
+                     << 8.0 * modelo.getNumFilas() * modelo.getNumFilas() / (1024 * 1024) << " MB)" << endl;
+                continue;
+            }
+            OpcionesSimplex opciones;
+            opciones.factorizacionDispersa = configuracion.dispersa;
+            opciones.hiperdispersa = configuracion.hiperdispersa;
+            ResolvedorSimplex lp;
+            lp.setOpciones(opciones);
+            lp.cargar(modelo);
+            auto inicio = chrono::steady_clock::now();
+            EstadoLP estado = lp.resolver();
+            double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+            cout << "  • " << configuracion.nombre << ": " << lp.getIteraciones() << " iteraciones, "
+                 << segundos * 1000 << " ms, óptimo " << lp.getValorObjetivo() << endl;
+            if (!hayReferencia)
+            {
+                referencia = lp.getValorObjetivo();
+                hayReferencia = true;
+            }
+            if (estado != LP_OPTIMO || abs(lp.getValorObjetivo() - referencia) > 1e-6 * (1.0 + abs(referencia)))
+                mostrarMensajeError("La configuración no llega al mismo óptimo.");
+            if (grande && configuracion.hiperdispersa)
+                optimoGrande = lp;
+        }
+
+        if (!grande)
+            continue;
+
+        // FTRAN de columnas estructurales y BTRAN de vectores unitarios con la base óptima
+        int filas = optimoGrande.getNumFilas();
+        int columnas = optimoGrande.getNumVariables();
+        vector<int> base(filas);
+        for (int i = 0; i < filas; i++)
+            base[i] = optimoGrande.getBasica(i);
+        const int resoluciones = 4000;
+        cout << "\nResoluciones con la base óptima (" << resoluciones << " FTRAN y " << resoluciones << " BTRAN):"
+             << endl;
+        for (bool hiperdispersa : {false, true})
+        {
+            FactorizacionLU lu;
+            lu.setHiperdispersa(hiperdispersa);
+            auto inicio = chrono::steady_clock::now();
+            if (!lu.factorizar(base, columnas, matriz))
+            {
+                mostrarMensajeError("La base óptima resultó singular.");
+                return;
+            }
+            double segundosFactorizar = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+            mt19937 elecciones(17);
+            VectorDisperso x;
+            long noNulos = 0;
+            inicio = chrono::steady_clock::now();
+            for (int r = 0; r < resoluciones; r++)
+            {
+                int j = static_cast<int>(elecciones() % columnas);
+                x.reiniciar(filas);
+                for (int p = 0; p < matriz.getLargoColumna(j); p++)
+                    x.sumar(matriz.getFilasColumna(j)[p], matriz.getValoresColumna(j)[p]);
+                lu.ftran(x);
+                noNulos += static_cast<long>(x.indices.size());
+            }
+            double segundosFtran = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+            inicio = chrono::steady_clock::now();
+            for (int r = 0; r < resoluciones; r++)
+            {
+                x.reiniciar(filas);
+                x.sumar(static_cast<int>(elecciones() % filas), 1.0);
+                lu.btran(x);
+                noNulos += static_cast<long>(x.indices.size());
+            }
+            double segundosBtran = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+            if (!hiperdispersa)
+            {
+                cout << "  • Factorización: " << segundosFactorizar * 1000 << " ms, " << lu.getNoNulos()
+                     << " no nulos en L y U (B⁻¹ densa: " << static_cast<long>(filas) * filas << ")" << endl;
+                cout << "  • No nulos por resultado: " << static_cast<double>(noNulos) / (2 * resoluciones) << " de "
+                     << filas << endl;
+            }
+            cout << "  • " << (hiperdispersa ? "Hiperdispersas" : "Recorriendo todo el orden") << ": FTRAN "
+                 << segundosFtran * 1e6 / resoluciones << " µs, BTRAN " << segundosBtran * 1e6 / resoluciones << " µs"
+                 << endl;
+        }
+    }
+}
@@ -9,7 +9,7 @@
  * - macOS: brew install sfml
  *
  * COMPILACIÓN:
- * g++ -o optimizacion main.cpp optimizacion.cpp validaciones.cpp graficos.cpp -lsfml-graphics -lsfml-window -lsfml-system
+ * g++ -std=c++17 -pthread -o optimizacion main.cpp optimizacion.cpp validaciones.cpp graficos.cpp lotes.cpp arena.cpp traza.cpp trabajos.cpp simplex.cpp planificacion.cpp instantanea.cpp reportes.cpp perezosas.cpp redes.cpp corte.cpp modelado.cpp cuadratica.cpp entero.cpp alternativas.cpp cortes.cpp nodos.cpp factorizacion.cpp precios.cpp pareto.cpp metas.cpp robusto.cpp estocastico.cpp verificacion.cpp -lsfml-graphics -lsfml-window -lsfml-system
  */
 
 #include "optimizacion.h"
@@ -17,6 +17,8 @@
 #include <vector>
 #include <cmath>
 #include <algorithm>
+#include <cstdio>
+#include <chrono>
 #include <sstream>
 #include <iomanip>
 
@@ -48,6 +50,8 @@ private:
     double escalaX, escalaY;
     double maxX, maxY;
     double origenX, origenY;
+    ArenaMonotona arenaCuadro;             // Temporales de geometría de cada cuadro
+    pmr::memory_resource *recursoGeometria; // arenaCuadro, o el heap al medir el esquema anterior
 
 #ifdef SFML_DISPONIBLE
     RenderWindow ventana;
@@ -55,7 +59,8 @@ private:
 #endif
 
 public:
-    VisualizadorGrafico();
+    explicit VisualizadorGrafico(pmr::memory_resource *recursoGeometria = nullptr,
+                                 pmr::memory_resource *superiorArena = pmr::new_delete_resource());
     bool inicializar();
     void configurarEscala(const vector<Restriccion> &restricciones, const SolucionOptima &solucion);
     void dibujarEjes();
@@ -68,13 +73,18 @@ public:
 
 private:
     PuntoGrafico convertirAPantalla(double x, double y);
-    vector<PuntoGrafico> calcularPuntosRecta(const Restriccion &restriccion, double xMin, double xMax);
-    vector<PuntoGrafico> encontrarVerticesAreaFactible(const vector<Restriccion> &restricciones);
+    pmr::vector<PuntoGrafico> calcularPuntosRecta(const Restriccion &restriccion, double xMin, double xMax);
+    pmr::vector<PuntoGrafico> encontrarVerticesAreaFactible(const vector<Restriccion> &restricciones);
     string formatearNumero(double numero, int decimales = 2);
+
+    friend MedicionCuadros medirCuadrosGrafico(size_t numCuadros, bool conArena);
 };
 
-// Constructor
-VisualizadorGrafico::VisualizadorGrafico() : escalaX(1.0), escalaY(1.0), maxX(100.0), maxY(100.0)
+// Constructor (sin recurso: la geometría de cada cuadro sale de arenaCuadro,
+// que pide sus bloques a superiorArena)
+VisualizadorGrafico::VisualizadorGrafico(pmr::memory_resource *recursoGeometria, pmr::memory_resource *superiorArena)
+    : escalaX(1.0), escalaY(1.0), maxX(100.0), maxY(100.0), arenaCuadro(16 * 1024, superiorArena),
+      recursoGeometria(recursoGeometria != nullptr ? recursoGeometria : &arenaCuadro)
 {
     origenX = MARGEN;
     origenY = ALTO_VENTANA - MARGEN;
@@ -246,7 +256,7 @@ void VisualizadorGrafico::dibujarRestricciones(const vector<Restriccion> &restri
                 continue;
             }
 
-            vector<PuntoGrafico> puntosRecta = calcularPuntosRecta(restriccion, 0, maxX);
+            pmr::vector<PuntoGrafico> puntosRecta = calcularPuntosRecta(restriccion, 0, maxX);
 
             if (puntosRecta.size() >= 2)
             {
@@ -281,7 +291,9 @@ void VisualizadorGrafico::dibujarRestricciones(const vector<Restriccion> &restri
 // Dibujar el área factible sombreada
 void VisualizadorGrafico::dibujarAreaFactible(const vector<Restriccion> &restricciones)
 {
-    vector<PuntoGrafico> vertices = encontrarVerticesAreaFactible(restricciones);
+    TRAZA_AMBITO("grafico.areaFactible", "grafico");
+
+    pmr::vector<PuntoGrafico> vertices = encontrarVerticesAreaFactible(restricciones);
 
     if (vertices.size() >= 3)
     {
@@ -405,9 +417,9 @@ void VisualizadorGrafico::mostrarLeyenda(const vector<Restriccion> &restriccione
 #endif
 
 // Calcular puntos de una recta para dibujar
-vector<PuntoGrafico> VisualizadorGrafico::calcularPuntosRecta(const Restriccion &restriccion, double xMin, double xMax)
+pmr::vector<PuntoGrafico> VisualizadorGrafico::calcularPuntosRecta(const Restriccion &restriccion, double xMin, double xMax)
 {
-    vector<PuntoGrafico> puntos;
+    pmr::vector<PuntoGrafico> puntos(recursoGeometria);
 
     if (restriccion.coeficienteX2 != 0)
     {
@@ -456,9 +468,9 @@ vector<PuntoGrafico> VisualizadorGrafico::calcularPuntosRecta(const Restriccion
 }
 
 // Encontrar vértices del área factible
-vector<PuntoGrafico> VisualizadorGrafico::encontrarVerticesAreaFactible(const vector<Restriccion> &restricciones)
+pmr::vector<PuntoGrafico> VisualizadorGrafico::encontrarVerticesAreaFactible(const vector<Restriccion> &restricciones)
 {
-    vector<PuntoGrafico> vertices;
+    pmr::vector<PuntoGrafico> vertices(recursoGeometria);
 
     // Agregar punto origen si es factible
     bool origenFactible = true;
@@ -584,6 +596,8 @@ void VisualizadorGrafico::ejecutarVisualizacion(const SistemaOptimizacion &siste
 
     while (ventana.isOpen())
     {
+        TRAZA_AMBITO("grafico.cuadro", "grafico");
+
         Event evento;
         while (ventana.pollEvent(evento))
         {
@@ -602,6 +616,9 @@ void VisualizadorGrafico::ejecutarVisualizacion(const SistemaOptimizacion &siste
 
         ventana.clear(Color::White);
 
+        // La geometría del cuadro anterior ya no se usa
+        arenaCuadro.reiniciar();
+
         // Dibujar todos los elementos
         dibujarEjes();
         dibujarAreaFactible(sistema.getRestricciones());
@@ -617,7 +634,10 @@ void VisualizadorGrafico::ejecutarVisualizacion(const SistemaOptimizacion &siste
         instrucciones.setPosition(10, ALTO_VENTANA - 25);
         ventana.draw(instrucciones);
 
-        ventana.display();
+        {
+            TRAZA_AMBITO("grafico.presentar", "grafico");
+            ventana.display();
+        }
     }
 #else
     cout << "[ERROR] SFML no está compilado. Mostrando información de la solución:" << endl;
@@ -632,12 +652,88 @@ void VisualizadorGrafico::ejecutarVisualizacion(const SistemaOptimizacion &siste
 
 // Función auxiliar para formatear números
 string VisualizadorGrafico::formatearNumero(double numero, int decimales)
+{
+    char buffer[64];
+    int longitud = snprintf(buffer, sizeof(buffer), "%.*f", decimales, numero);
+    return string(buffer, longitud > 0 ? min(static_cast<size_t>(longitud), sizeof(buffer) - 1) : 0);
+}
+
+// Formato de las etiquetas antes de usar snprintf: un ostringstream por número
+static string formatearNumeroFlujo(double numero, int decimales = 2)
 {
     ostringstream stream;
     stream << fixed << setprecision(decimales) << numero;
     return stream.str();
 }
 
+/**
+ * Repite la geometría y las etiquetas de un cuadro del gráfico (lo que se
+ * calcula antes de dibujar) y cuenta sus asignaciones con un
+ * ContadorAsignaciones: debajo de la arena o como recurso de los vectores, y
+ * como recurso de las etiquetas. Los números sueltos caben en el búfer
+ * interno de std::string; las etiquetas concatenadas no
+ * @param numCuadros Cantidad de cuadros a preparar
+ * @param conArena true: arena reiniciada por cuadro y snprintf; false: vectores
+ *                 del heap y un ostringstream por número, como antes
+ * @return Asignaciones y tiempo totales
+ */
+MedicionCuadros medirCuadrosGrafico(size_t numCuadros, bool conArena)
+{
+    vector<Restriccion> restricciones;
+    restricciones.push_back(Restriccion(4.0, 3.0, 240.0));
+    restricciones.push_back(Restriccion(2.0, 1.0, 100.0));
+    restricciones.push_back(Restriccion(0.0, 1.0, 60.0));
+    restricciones.push_back(Restriccion(1.0, 2.0, 150.0));
+    restricciones.push_back(Restriccion(3.0, 1.0, 135.0));
+    restricciones.push_back(Restriccion(1.0, 0.0, 0.0, ">="));
+    restricciones.push_back(Restriccion(0.0, 1.0, 0.0, ">="));
+
+    SolucionOptima solucion;
+    solucion.x1 = 30.0;
+    solucion.x2 = 40.0;
+    solucion.gananciaMaxima = 4100.0;
+    solucion.solucionEncontrada = true;
+
+    ContadorAsignaciones contador;
+    VisualizadorGrafico visualizador(conArena ? nullptr : &contador, &contador);
+    visualizador.configurarEscala(restricciones, solucion);
+    auto formatear = [&](double numero, int decimales)
+    {
+        return conArena ? visualizador.formatearNumero(numero, decimales) : formatearNumeroFlujo(numero, decimales);
+    };
+
+    MedicionCuadros medicion;
+    size_t control = 0;
+    auto inicio = chrono::steady_clock::now();
+    for (size_t cuadro = 0; cuadro < numCuadros; cuadro++)
+    {
+        if (conArena)
+        {
+            visualizador.arenaCuadro.reiniciar();
+        }
+
+        for (const auto &restriccion : restricciones)
+        {
+            pmr::vector<PuntoGrafico> puntosRecta = visualizador.calcularPuntosRecta(restriccion, 0, visualizador.maxX);
+            pmr::string etiqueta(&contador);
+            etiqueta.append(formatear(restriccion.coeficienteX1, 2)).append("x₁ + ");
+            etiqueta.append(formatear(restriccion.coeficienteX2, 2)).append("x₂ ");
+            etiqueta.append(restriccion.operador).append(" ").append(formatear(restriccion.valorConstante, 2));
+            control += puntosRecta.size() + etiqueta.size();
+        }
+
+        pmr::vector<PuntoGrafico> vertices = visualizador.encontrarVerticesAreaFactible(restricciones);
+        pmr::string etiquetaOptimo(&contador);
+        etiquetaOptimo.append("Óptimo (").append(formatear(solucion.x1, 0)).append(", ");
+        etiquetaOptimo.append(formatear(solucion.x2, 0)).append(")\nZ = $").append(formatear(solucion.gananciaMaxima, 2));
+        control += vertices.size() + etiquetaOptimo.size();
+    }
+    medicion.segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+    medicion.asignaciones = contador.asignaciones;
+    medicion.control = control;
+    return medicion;
+}
+
 // Función global para mostrar la visualización gráfica
 void SistemaOptimizacion::mostrarSolucionGrafica()
 {
@@ -0,0 +1,444 @@
+/**
+ * MÓDULO DE INSTANTÁNEAS BINARIAS
+ * Guarda y restaura el estado de una sesión en un archivo binario
+ * versionado y con suma de verificación. La lectura mapea el archivo en
+ * memoria: los registros se usan directamente, sin interpretar texto
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <cstdio>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <random>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// Suma FNV-1a de 64 bits
+static uint64_t sumaFnv(const char *datos, size_t tamano, uint64_t suma = 1469598103934665603ULL)
+{
+    for (size_t i = 0; i < tamano; i++)
+    {
+        suma ^= static_cast<unsigned char>(datos[i]);
+        suma *= 1099511628211ULL;
+    }
+    return suma;
+}
+
+static uint64_t sumaCabecera(CabeceraInstantanea cabecera)
+{
+    cabecera.sumaCabecera = 0;
+    return sumaFnv(reinterpret_cast<const char *>(&cabecera), sizeof(cabecera));
+}
+
+static uint32_t codificarOperador(const string &operador)
+{
+    if (operador == "<=")
+        return 0;
+    if (operador == ">=")
+        return 1;
+    if (operador == "=")
+        return 2;
+    throw invalid_argument("Operador de restricción inválido: " + operador);
+}
+
+static string decodificarOperador(uint32_t codigo)
+{
+    switch (codigo)
+    {
+    case 0:
+        return "<=";
+    case 1:
+        return ">=";
+    case 2:
+        return "=";
+    default:
+        throw runtime_error("La instantánea contiene un operador desconocido.");
+    }
+}
+
+static void liberarMapeo(const char *datos, size_t tamano)
+{
+#ifdef _WIN32
+    (void)tamano;
+    UnmapViewOfFile(datos);
+#else
+    munmap(const_cast<char *>(datos), tamano);
+#endif
+}
+
+// Vértices del área factible: candidatos factibles sin repetir
+static vector<VerticeBinario> calcularVertices(const vector<Restriccion> &restricciones)
+{
+    vector<VerticeBinario> vertices;
+    if (restricciones.empty())
+    {
+        return vertices;
+    }
+
+    pmr::monotonic_buffer_resource memoria;
+    pmr::vector<pair<double, double>> puntos(&memoria);
+    calcularPuntosCandidatos(restricciones, puntos);
+
+    for (const auto &punto : puntos)
+    {
+        if (!esPuntoFactible(restricciones, punto.first, punto.second))
+            continue;
+
+        bool repetido = false;
+        for (const auto &vertice : vertices)
+        {
+            if (abs(vertice.x1 - punto.first) < 1e-9 && abs(vertice.x2 - punto.second) < 1e-9)
+            {
+                repetido = true;
+                break;
+            }
+        }
+        if (!repetido)
+        {
+            vertices.push_back(VerticeBinario{punto.first, punto.second});
+        }
+    }
+    return vertices;
+}
+
+/**
+ * Escribe la instantánea de una sesión
+ * @param ruta Archivo de destino (se reemplaza solo si la escritura termina bien)
+ * @param modelo Precios y restricciones
+ * @param solucion Última solución calculada
+ * @param banderas Partes válidas del estado (INSTANTANEA_*)
+ */
+void guardarInstantanea(const string &ruta, const ModeloProduccion &modelo,
+                        const SolucionOptima &solucion, uint32_t banderas)
+{
+    TRAZA_AMBITO("instantanea.guardar", "archivo");
+
+    vector<RestriccionBinaria> restricciones;
+    restricciones.reserve(modelo.restricciones.size());
+    for (const auto &r : modelo.restricciones)
+    {
+        restricciones.push_back(RestriccionBinaria{r.coeficienteX1, r.coeficienteX2, r.valorConstante,
+                                                   codificarOperador(r.operador), 0});
+    }
+    vector<VerticeBinario> vertices = calcularVertices(modelo.restricciones);
+
+    CabeceraInstantanea cabecera;
+    memset(&cabecera, 0, sizeof(cabecera));
+    memcpy(cabecera.firma, FIRMA_INSTANTANEA, sizeof(cabecera.firma));
+    cabecera.version = VERSION_INSTANTANEA;
+    cabecera.marcaOrden = MARCA_ORDEN_BYTES;
+    cabecera.numRestricciones = static_cast<uint32_t>(restricciones.size());
+    cabecera.numVertices = static_cast<uint32_t>(vertices.size());
+    cabecera.banderas = banderas;
+    cabecera.precioMesa = modelo.precioMesa;
+    cabecera.precioSilla = modelo.precioSilla;
+    if (banderas & INSTANTANEA_SOLUCION)
+    {
+        cabecera.solucionX1 = solucion.x1;
+        cabecera.solucionX2 = solucion.x2;
+        cabecera.solucionGanancia = solucion.gananciaMaxima;
+    }
+
+    size_t bytesRestricciones = restricciones.size() * sizeof(RestriccionBinaria);
+    size_t bytesVertices = vertices.size() * sizeof(VerticeBinario);
+    cabecera.tamanoArchivo = sizeof(cabecera) + bytesRestricciones + bytesVertices;
+
+    uint64_t suma = sumaFnv(reinterpret_cast<const char *>(restricciones.data()), bytesRestricciones);
+    cabecera.sumaDatos = sumaFnv(reinterpret_cast<const char *>(vertices.data()), bytesVertices, suma);
+    cabecera.sumaCabecera = sumaCabecera(cabecera);
+
+    // Escribir en un temporal y renombrar: un corte a mitad no deja la sesión anterior dañada
+    string temporal = ruta + ".tmp";
+    {
+        ofstream archivo(temporal, ios::binary | ios::trunc);
+        if (!archivo)
+        {
+            throw runtime_error("No se pudo crear el archivo: " + temporal);
+        }
+        archivo.write(reinterpret_cast<const char *>(&cabecera), sizeof(cabecera));
+        archivo.write(reinterpret_cast<const char *>(restricciones.data()), bytesRestricciones);
+        archivo.write(reinterpret_cast<const char *>(vertices.data()), bytesVertices);
+        if (!archivo.flush())
+        {
+            throw runtime_error("No se pudo escribir el archivo: " + temporal);
+        }
+    }
+
+#ifdef _WIN32
+    // rename() no reemplaza un archivo existente en Windows; borrar antes dejaría un hueco sin sesión
+    bool reemplazado = MoveFileExA(temporal.c_str(), ruta.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    bool reemplazado = rename(temporal.c_str(), ruta.c_str()) == 0;
+#endif
+    if (!reemplazado)
+    {
+        remove(temporal.c_str());
+        throw runtime_error("No se pudo reemplazar el archivo: " + ruta);
+    }
+}
+
+// Constructor: mapea el archivo completo en memoria de solo lectura
+InstantaneaMapeada::InstantaneaMapeada(const string &ruta, bool verificarDatos)
+    : datos(nullptr), tamano(0)
+{
+    TRAZA_AMBITO("instantanea.mapear", "archivo");
+
+#ifdef _WIN32
+    HANDLE archivo = CreateFileA(ruta.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                 FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (archivo == INVALID_HANDLE_VALUE)
+    {
+        throw runtime_error("No se pudo abrir la instantánea: " + ruta);
+    }
+    LARGE_INTEGER tamanoArchivo;
+    if (!GetFileSizeEx(archivo, &tamanoArchivo) || tamanoArchivo.QuadPart < static_cast<LONGLONG>(sizeof(CabeceraInstantanea)))
+    {
+        CloseHandle(archivo);
+        throw runtime_error("La instantánea está incompleta: " + ruta);
+    }
+    HANDLE mapeo = CreateFileMappingA(archivo, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void *vista = mapeo ? MapViewOfFile(mapeo, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (mapeo)
+        CloseHandle(mapeo); // La vista mantiene el mapeo abierto
+    CloseHandle(archivo);
+    if (!vista)
+    {
+        throw runtime_error("No se pudo mapear la instantánea: " + ruta);
+    }
+    tamano = static_cast<size_t>(tamanoArchivo.QuadPart);
+#else
+    int descriptor = open(ruta.c_str(), O_RDONLY);
+    if (descriptor < 0)
+    {
+        throw runtime_error("No se pudo abrir la instantánea: " + ruta);
+    }
+    struct stat informacion;
+    if (fstat(descriptor, &informacion) != 0 || informacion.st_size < static_cast<off_t>(sizeof(CabeceraInstantanea)))
+    {
+        close(descriptor);
+        throw runtime_error("La instantánea está incompleta: " + ruta);
+    }
+    tamano = static_cast<size_t>(informacion.st_size);
+    void *vista = mmap(nullptr, tamano, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor); // El mapeo sigue válido después de cerrar el descriptor
+    if (vista == MAP_FAILED)
+    {
+        throw runtime_error("No se pudo mapear la instantánea: " + ruta);
+    }
+#endif
+    datos = static_cast<const char *>(vista);
+
+    // Validar; si falla hay que liberar el mapeo aquí porque el destructor no se ejecutará
+    string error;
+    const CabeceraInstantanea &cabecera = getCabecera();
+    if (memcmp(cabecera.firma, FIRMA_INSTANTANEA, sizeof(cabecera.firma)) != 0)
+        error = "El archivo no es una instantánea del sistema.";
+    else if (cabecera.marcaOrden != MARCA_ORDEN_BYTES)
+        error = "La instantánea fue escrita en un equipo con otro orden de bytes.";
+    else if (cabecera.version == 0 || cabecera.version > VERSION_INSTANTANEA)
+        error = "Versión de instantánea no soportada: " + to_string(cabecera.version);
+    else if (cabecera.sumaCabecera != sumaCabecera(cabecera))
+        error = "La cabecera de la instantánea está dañada.";
+    else if (cabecera.tamanoArchivo != tamano ||
+             tamano != sizeof(CabeceraInstantanea) + static_cast<size_t>(cabecera.numRestricciones) * sizeof(RestriccionBinaria) +
+                           static_cast<size_t>(cabecera.numVertices) * sizeof(VerticeBinario))
+        error = "El tamaño de la instantánea no coincide con su contenido.";
+    else if (verificarDatos &&
+             cabecera.sumaDatos != sumaFnv(datos + sizeof(CabeceraInstantanea), tamano - sizeof(CabeceraInstantanea)))
+        error = "Los datos de la instantánea están dañados (suma de verificación incorrecta).";
+
+    if (!error.empty())
+    {
+        liberarMapeo(datos, tamano);
+        throw runtime_error(error);
+    }
+}
+
+// Destructor: libera el mapeo
+InstantaneaMapeada::~InstantaneaMapeada()
+{
+    liberarMapeo(datos, tamano);
+}
+
+const RestriccionBinaria *InstantaneaMapeada::getRestricciones() const
+{
+    return reinterpret_cast<const RestriccionBinaria *>(datos + sizeof(CabeceraInstantanea));
+}
+
+const VerticeBinario *InstantaneaMapeada::getVertices() const
+{
+    return reinterpret_cast<const VerticeBinario *>(getRestricciones() + getNumRestricciones());
+}
+
+Restriccion InstantaneaMapeada::getRestriccion(size_t i) const
+{
+    if (i >= getNumRestricciones())
+    {
+        throw out_of_range("Índice de restricción fuera de rango en la instantánea.");
+    }
+    const RestriccionBinaria &r = getRestricciones()[i];
+    return Restriccion(r.coeficienteX1, r.coeficienteX2, r.valorConstante, decodificarOperador(r.operador));
+}
+
+ModeloProduccion InstantaneaMapeada::obtenerModelo() const
+{
+    ModeloProduccion modelo;
+    modelo.precioMesa = getCabecera().precioMesa;
+    modelo.precioSilla = getCabecera().precioSilla;
+    modelo.restricciones.reserve(getNumRestricciones());
+    for (size_t i = 0; i < getNumRestricciones(); i++)
+    {
+        modelo.restricciones.push_back(getRestriccion(i));
+    }
+    return modelo;
+}
+
+SolucionOptima InstantaneaMapeada::obtenerSolucion() const
+{
+    SolucionOptima solucion;
+    if (tiene(INSTANTANEA_SOLUCION))
+    {
+        solucion.x1 = getCabecera().solucionX1;
+        solucion.x2 = getCabecera().solucionX2;
+        solucion.gananciaMaxima = getCabecera().solucionGanancia;
+        solucion.solucionEncontrada = true;
+    }
+    return solucion;
+}
+
+/**
+ * Muestra el contenido de una instantánea leyendo directamente del mapeo
+ * @param ruta Archivo de la instantánea
+ */
+void mostrarInstantanea(const string &ruta)
+{
+    InstantaneaMapeada instantanea(ruta);
+    const CabeceraInstantanea &cabecera = instantanea.getCabecera();
+
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  INSTANTÁNEA: " << ruta << endl;
+    cout << string(60, '=') << endl;
+    cout << "Versión del formato: " << cabecera.version << " (" << cabecera.tamanoArchivo << " bytes)" << endl;
+
+    if (instantanea.tiene(INSTANTANEA_PRECIOS))
+    {
+        cout << "Precios: mesa $" << cabecera.precioMesa << ", silla $" << cabecera.precioSilla << endl;
+    }
+    else
+    {
+        cout << "Precios: no configurados" << endl;
+    }
+
+    cout << "Restricciones: " << instantanea.getNumRestricciones() << endl;
+    const RestriccionBinaria *restricciones = instantanea.getRestricciones();
+    for (size_t i = 0; i < instantanea.getNumRestricciones(); i++)
+    {
+        cout << "  " << (i + 1) << ". " << restricciones[i].coeficienteX1 << "x₁ + " << restricciones[i].coeficienteX2
+             << "x₂ " << decodificarOperador(restricciones[i].operador) << " " << restricciones[i].valorConstante << endl;
+    }
+
+    cout << "Vértices del área factible: " << instantanea.getNumVertices() << endl;
+    const VerticeBinario *vertices = instantanea.getVertices();
+    for (size_t i = 0; i < instantanea.getNumVertices(); i++)
+    {
+        cout << "  (" << vertices[i].x1 << ", " << vertices[i].x2 << ")" << endl;
+    }
+
+    if (instantanea.tiene(INSTANTANEA_SOLUCION))
+    {
+        cout << "Solución: " << cabecera.solucionX1 << " mesas, " << cabecera.solucionX2
+             << " sillas, ganancia $" << cabecera.solucionGanancia << endl;
+    }
+    else
+    {
+        cout << "Solución: no calculada" << endl;
+    }
+}
+
+/**
+ * Mide la carga de instantáneas de distinto tamaño: validar solo la cabecera,
+ * validar con la suma de los registros y copiar las restricciones al modelo
+ * editable, que es lo que hace restaurarSesion(). Las dos últimas crecen con
+ * el número de restricciones
+ * @param repeticiones Cargas de cada archivo para promediar
+ */
+void ejecutarBenchmarkInstantanea(size_t repeticiones)
+{
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: CARGA DE INSTANTÁNEAS" << endl;
+    cout << string(60, '=') << endl;
+
+    const string ruta = "benchmark_sesion.snap";
+    mt19937 generador(32);
+    uniform_real_distribution<double> coeficiente(1.0, 10.0);
+    uniform_real_distribution<double> capacidad(200.0, 1000.0);
+
+    for (size_t numRestricciones : {10, 100, 1000, 10000})
+    {
+        ModeloProduccion modelo;
+        modelo.precioMesa = 70.0;
+        modelo.precioSilla = 50.0;
+        for (size_t i = 0; i < numRestricciones; i++)
+        {
+            modelo.restricciones.push_back(Restriccion(coeficiente(generador), coeficiente(generador), capacidad(generador)));
+        }
+        SolucionOptima solucion;
+        guardarInstantanea(ruta, modelo, solucion, INSTANTANEA_PRECIOS | INSTANTANEA_RESTRICCIONES);
+
+        double segundos[3] = {0.0, 0.0, 0.0};
+        size_t control = 0;
+        size_t bytes = 0;
+        for (size_t k = 0; k < repeticiones; k++)
+        {
+            auto inicio = chrono::steady_clock::now();
+            {
+                InstantaneaMapeada instantanea(ruta, false);
+                control += instantanea.getNumRestricciones();
+                bytes = instantanea.getCabecera().tamanoArchivo;
+            }
+            segundos[0] += chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+            inicio = chrono::steady_clock::now();
+            {
+                InstantaneaMapeada instantanea(ruta);
+                control += instantanea.getNumRestricciones();
+            }
+            segundos[1] += chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+            inicio = chrono::steady_clock::now();
+            {
+                InstantaneaMapeada instantanea(ruta);
+                ModeloProduccion cargado = instantanea.obtenerModelo();
+                control += cargado.restricciones.size();
+            }
+            segundos[2] += chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+        }
+
+        if (control != 3 * repeticiones * numRestricciones)
+        {
+            mostrarMensajeError("Las cargas no leyeron todas las restricciones.");
+        }
+        cout << numRestricciones << " restricciones (" << bytes << " bytes), promedio de " << repeticiones
+             << " cargas:" << endl;
+        cout << "  • Solo la cabecera: " << segundos[0] / repeticiones * 1e6 << " µs" << endl;
+        cout << "  • Con la suma de los registros: " << segundos[1] / repeticiones * 1e6 << " µs" << endl;
+        cout << "  • Con la copia al modelo editable (restaurarSesion): " << segundos[2] / repeticiones * 1e6
+             << " µs" << endl;
+    }
+    remove(ruta.c_str());
+}
@@ -0,0 +1,347 @@
+/**
+ * MÓDULO DE EJECUCIÓN POR LOTES
+ * Resuelve en paralelo muchas variaciones de un mismo modelo base
+ * (precios y capacidades distintas) usando un planificador con robo de trabajo
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+// Constructor: crea los hilos trabajadores y sus colas
+PlanificadorRobo::PlanificadorRobo(unsigned numHilos)
+    : tareaActual(nullptr), tareasPendientes(0), hilosActivos(0), generacion(0), detener(false)
+{
+    if (numHilos == 0)
+    {
+        numHilos = max(1u, thread::hardware_concurrency());
+    }
+
+    for (unsigned i = 0; i < numHilos; i++)
+    {
+        colas.push_back(unique_ptr<ColaHilo>(new ColaHilo()));
+    }
+
+    for (unsigned i = 0; i < numHilos; i++)
+    {
+        hilos.push_back(thread(&PlanificadorRobo::cicloHilo, this, i));
+    }
+}
+
+// Destructor: detiene los hilos y espera a que terminen
+PlanificadorRobo::~PlanificadorRobo()
+{
+    {
+        lock_guard<mutex> bloqueo(mtxEstado);
+        detener = true;
+    }
+    cvTrabajo.notify_all();
+
+    for (auto &hilo : hilos)
+    {
+        hilo.join();
+    }
+}
+
+void PlanificadorRobo::ejecutar(size_t numTareas, const function<void(size_t, unsigned)> &tarea)
+{
+    if (numTareas == 0)
+    {
+        return;
+    }
+
+    // Solo un lote a la vez por planificador
+    lock_guard<mutex> bloqueoEjecucion(mtxEjecucion);
+
+    // Repartir las tareas en bloques contiguos: cada hilo empieza con datos cercanos
+    size_t numColas = colas.size();
+    size_t porCola = (numTareas + numColas - 1) / numColas;
+    for (size_t c = 0; c < numColas; c++)
+    {
+        lock_guard<mutex> bloqueoCola(colas[c]->mtx);
+        size_t inicio = c * porCola;
+        size_t fin = min(numTareas, inicio + porCola);
+        for (size_t i = inicio; i < fin; i++)
+        {
+            colas[c]->tareas.push_back(i);
+        }
+    }
+
+    unique_lock<mutex> bloqueo(mtxEstado);
+    tareaActual = &tarea;
+    tareasPendientes = numTareas;
+    primerError = nullptr;
+    generacion++;
+    cvTrabajo.notify_all();
+
+    // Esperar también a que los hilos suelten la referencia a la tarea
+    cvFin.wait(bloqueo, [this]
+               { return tareasPendientes == 0 && hilosActivos == 0; });
+    tareaActual = nullptr;
+
+    if (primerError)
+    {
+        exception_ptr error = primerError;
+        primerError = nullptr;
+        rethrow_exception(error);
+    }
+}
+
+// Toma una tarea de la cola propia (por el final) o roba de otra (por el inicio)
+bool PlanificadorRobo::obtenerTarea(unsigned idHilo, size_t &tarea)
+{
+    {
+        ColaHilo &propia = *colas[idHilo];
+        lock_guard<mutex> bloqueo(propia.mtx);
+        if (!propia.tareas.empty())
+        {
+            tarea = propia.tareas.back();
+            propia.tareas.pop_back();
+            return true;
+        }
+    }
+
+    for (size_t k = 1; k < colas.size(); k++)
+    {
+        ColaHilo &victima = *colas[(idHilo + k) % colas.size()];
+        lock_guard<mutex> bloqueo(victima.mtx);
+        if (!victima.tareas.empty())
+        {
+            tarea = victima.tareas.front();
+            victima.tareas.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void PlanificadorRobo::cicloHilo(unsigned idHilo)
+{
+    unsigned long long generacionVista = 0;
+
+    while (true)
+    {
+        const function<void(size_t, unsigned)> *tarea;
+        {
+            unique_lock<mutex> bloqueo(mtxEstado);
+            cvTrabajo.wait(bloqueo, [this, generacionVista]
+                           { return detener || generacion != generacionVista; });
+            if (detener)
+            {
+                return;
+            }
+            generacionVista = generacion;
+            tarea = tareaActual;
+            if (tarea == nullptr)
+            {
+                continue; // El lote ya terminó antes de que este hilo despertara
+            }
+            hilosActivos++;
+        }
+
+        size_t indice;
+        while (obtenerTarea(idHilo, indice))
+        {
+            try
+            {
+                (*tarea)(indice, idHilo);
+            }
+            catch (...)
+            {
+                lock_guard<mutex> bloqueo(mtxEstado);
+                if (!primerError)
+                {
+                    primerError = current_exception();
+                }
+            }
+
+            lock_guard<mutex> bloqueo(mtxEstado);
+            tareasPendientes--;
+        }
+
+        lock_guard<mutex> bloqueo(mtxEstado);
+        if (--hilosActivos == 0 && tareasPendientes == 0)
+        {
+            cvFin.notify_all();
+        }
+    }
+}
+
+// Memoria de trabajo propia de cada hilo, reutilizada entre escenarios
+struct BufferHilo
+{
+    vector<Restriccion> restricciones;
+    ArenaMonotona arena; // Temporales del cálculo; se reinicia en cada escenario
+};
+
+vector<SolucionOptima> resolverLoteEscenarios(const ModeloProduccion &base,
+                                              const vector<VariacionEscenario> &variaciones,
+                                              PlanificadorRobo &planificador)
+{
+    TRAZA_AMBITO("lote.escenarios", "lote");
+    vector<SolucionOptima> resultados(variaciones.size());
+    vector<BufferHilo> buffers(planificador.getNumHilos());
+
+    planificador.ejecutar(variaciones.size(), [&](size_t i, unsigned idHilo)
+                          {
+        const VariacionEscenario &variacion = variaciones[i];
+        BufferHilo &buffer = buffers[idHilo];
+
+        // Copiar el modelo base sobre la memoria ya reservada del hilo
+        buffer.restricciones.assign(base.restricciones.begin(), base.restricciones.end());
+        for (const auto &ajuste : variacion.capacidades)
+        {
+            if (ajuste.indiceRestriccion >= buffer.restricciones.size())
+            {
+                throw out_of_range("Índice de restricción fuera de rango en el escenario " + to_string(i + 1));
+            }
+            buffer.restricciones[ajuste.indiceRestriccion].valorConstante = ajuste.valorConstante;
+        }
+
+        double precioMesa = variacion.cambiaPrecios ? variacion.precioMesa : base.precioMesa;
+        double precioSilla = variacion.cambiaPrecios ? variacion.precioSilla : base.precioSilla;
+
+        // Infactible por filas contradictorias o por propagación de cotas: se
+        // descarta sin resolver. Los demás problemas (un precio no positivo,
+        // por ejemplo) no impiden el cálculo y el escenario se resuelve igual
+        // que en serie; si el primer problema no es de factibilidad, la
+        // resolución decide
+        DiagnosticoModelo diagnostico = diagnosticarModelo(buffer.restricciones, precioMesa, precioSilla, true);
+        if (!diagnostico.esValido() && (diagnostico.problemas[0].tipo == PROBLEMA_INFACTIBLE ||
+                                        diagnostico.problemas[0].tipo == PROBLEMA_FILAS_CONTRADICTORIAS))
+        {
+            resultados[i] = SolucionOptima();
+            return;
+        }
+
+        // Cada tarea escribe solo en su posición: el orden de entrada se conserva
+        buffer.arena.reiniciar();
+        resultados[i] = resolverPuntosExtremos(buffer.restricciones, precioMesa, precioSilla, &buffer.arena); });
+
+    return resultados;
+}
+
+/**
+ * Compara el lote en paralelo con el mismo cálculo en serie: los resultados
+ * deben volver en el orden de entrada y coincidir uno a uno (también los de
+ * precio no positivo, que la verificación previa no descarta), y un índice de
+ * restricción fuera de rango debe rechazar el lote
+ * @param numEscenarios Cantidad de variaciones del modelo base
+ */
+void ejecutarBenchmarkLotes(size_t numEscenarios)
+{
+    ModeloProduccion base;
+    base.precioMesa = 70.0;
+    base.precioSilla = 50.0;
+    base.restricciones.push_back(Restriccion(4.0, 3.0, 240.0));
+    base.restricciones.push_back(Restriccion(2.0, 1.0, 100.0));
+    base.restricciones.push_back(Restriccion(0.0, 1.0, 60.0));
+    base.restricciones.push_back(Restriccion(1.0, 2.0, 150.0));
+
+    // Precios y capacidades distintos en cada escenario; algunos infactibles
+    mt19937 generador(26);
+    uniform_real_distribution<double> precio(20.0, 120.0);
+    uniform_real_distribution<double> capacidad(0.5, 1.5);
+    vector<VariacionEscenario> variaciones(numEscenarios);
+    size_t preciosNoPositivos = 0;
+    for (size_t i = 0; i < numEscenarios; i++)
+    {
+        VariacionEscenario &variacion = variaciones[i];
+        variacion.cambiaPrecios = i % 3 != 0;
+        variacion.precioMesa = precio(generador);
+        variacion.precioSilla = precio(generador);
+        for (size_t r = 0; r < base.restricciones.size(); r++)
+        {
+            if ((i + r) % 2 == 0)
+                variacion.capacidades.push_back(AjusteCapacidad(r, base.restricciones[r].valorConstante * capacidad(generador)));
+        }
+        if (i % 97 == 0)
+            variacion.capacidades.push_back(AjusteCapacidad(1, -10.0));
+        // Algunos con precio de silla no positivo: la verificación los marca,
+        // pero tienen solución y deben resolverse como en serie
+        if (i % 89 == 1)
+        {
+            variacion.cambiaPrecios = true;
+            variacion.precioSilla = i % 2 == 0 ? 0.0 : -precio(generador);
+            preciosNoPositivos++;
+        }
+    }
+
+    // En serie: el mismo cálculo escenario por escenario, sin planificador
+    auto inicio = chrono::steady_clock::now();
+    vector<SolucionOptima> serie;
+    serie.reserve(numEscenarios);
+    for (const auto &variacion : variaciones)
+    {
+        vector<Restriccion> restricciones = base.restricciones;
+        for (const auto &ajuste : variacion.capacidades)
+            restricciones[ajuste.indiceRestriccion].valorConstante = ajuste.valorConstante;
+        double precioMesa = variacion.cambiaPrecios ? variacion.precioMesa : base.precioMesa;
+        double precioSilla = variacion.cambiaPrecios ? variacion.precioSilla : base.precioSilla;
+        serie.push_back(resolverPuntosExtremos(restricciones, precioMesa, precioSilla, pmr::new_delete_resource()));
+    }
+    double segundosSerie = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    PlanificadorRobo planificador;
+    inicio = chrono::steady_clock::now();
+    vector<SolucionOptima> paralelo = resolverLoteEscenarios(base, variaciones, planificador);
+    double segundosParalelo = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    size_t diferencias = 0, infactibles = 0;
+    for (size_t i = 0; i < numEscenarios; i++)
+    {
+        const SolucionOptima &a = serie[i], &b = paralelo[i];
+        if (!a.solucionEncontrada)
+            infactibles++;
+        bool iguales = a.solucionEncontrada == b.solucionEncontrada &&
+                       (!a.solucionEncontrada || (abs(a.x1 - b.x1) <= 1e-9 && abs(a.x2 - b.x2) <= 1e-9 &&
+                                                  abs(a.gananciaMaxima - b.gananciaMaxima) <= 1e-6));
+        if (!iguales)
+            diferencias++;
+    }
+
+    // Un índice fuera de rango en cualquier escenario debe llegar al llamador
+    bool rechazaIndice = false;
+    vector<VariacionEscenario> invalidas(variaciones.begin(), variaciones.begin() + min<size_t>(numEscenarios, 64));
+    if (!invalidas.empty())
+    {
+        invalidas.back().capacidades.push_back(AjusteCapacidad(base.restricciones.size(), 1.0));
+        try
+        {
+            resolverLoteEscenarios(base, invalidas, planificador);
+        }
+        catch (const out_of_range &)
+        {
+            rechazaIndice = true;
+        }
+    }
+
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: LOTE DE ESCENARIOS EN PARALELO" << endl;
+    cout << string(60, '=') << endl;
+    cout << "Escenarios: " << numEscenarios << " (" << infactibles << " infactibles, " << preciosNoPositivos
+         << " con precio no positivo), hilos: "
+         << planificador.getNumHilos() << endl;
+    cout << "\nEn serie: " << segundosSerie * 1000 << " ms" << endl;
+    cout << "En paralelo: " << segundosParalelo * 1000 << " ms" << endl;
+    cout << "Aceleración: " << segundosSerie / segundosParalelo << "x" << endl;
+    if (planificador.getNumHilos() == 1)
+    {
+        cout << "(Con un solo hilo el lote solo agrega la verificación previa y el planificador)" << endl;
+    }
+    cout << "\nResultados distintos de la ejecución en serie: " << diferencias << endl;
+    cout << "Índice fuera de rango rechazado: " << (rechazaIndice ? "sí" : "no") << endl;
+
+    if (diferencias > 0 || !rechazaIndice)
+    {
+        throw runtime_error("El lote en paralelo no coincide con la ejecución en serie.");
+    }
+}
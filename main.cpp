@@ -14,6 +14,9 @@
 #include "optimizacion.h"
 #include <iostream>
 #include <limits>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
 
 using namespace std;
 
@@ -33,11 +36,244 @@ void mostrarInformacionInicial()
     cin.get();
 }
 
+// Guarda la traza al salir de main por cualquier camino: modos no
+// interactivos, menú y errores
+struct GuardiaTraza
+{
+    ~GuardiaTraza()
+    {
+        try
+        {
+            guardarTraza();
+        }
+        catch (...)
+        {
+        }
+    }
+};
+
 // Función principal
-int main()
+int main(int argc, char *argv[])
 {
+    GuardiaTraza guardiaTraza;
+
     try
     {
+        string archivoSesion = "sesion_optimizacion.bin";
+        string formatoReporte, archivoReporte, archivoPrecios;
+        bool fronteraPareto = false;
+        double limiteTiempo = 0.0; // 0 = el límite predeterminado del sistema
+
+        // La traza se activa antes de cualquier modo, aunque --traza venga después
+        for (int i = 1; i + 1 < argc; i++)
+        {
+            if (string(argv[i]) == "--traza")
+            {
+                // Guardar los intervalos de la sesión en un JSON de Chrome trace-event
+                activarTraza(argv[i + 1]);
+            }
+        }
+
+        // Modos no interactivos seleccionados por argumentos
+        for (int i = 1; i < argc; i++)
+        {
+            string argumento = argv[i];
+
+            if (argumento == "--benchmark-alternativos")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkAlternativos();
+                return 0;
+            }
+            else if (argumento == "--benchmark-arena")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkArena();
+                return 0;
+            }
+            else if (argumento == "--benchmark-corte")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkCorte();
+                return 0;
+            }
+            else if (argumento == "--benchmark-cortes")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkCortes();
+                return 0;
+            }
+            else if (argumento == "--benchmark-cuadratica")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkCuadratica();
+                return 0;
+            }
+            else if (argumento == "--benchmark-estocastico")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkEstocastico();
+                return 0;
+            }
+            else if (argumento == "--benchmark-factorizacion")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkFactorizacion();
+                return 0;
+            }
+            else if (argumento == "--benchmark-instantanea")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkInstantanea();
+                return 0;
+            }
+            else if (argumento == "--benchmark-lexicografico")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkLexicografico();
+                return 0;
+            }
+            else if (argumento == "--benchmark-lotes")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkLotes();
+                return 0;
+            }
+            else if (argumento == "--benchmark-modelado")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkModelado();
+                return 0;
+            }
+            else if (argumento == "--benchmark-multiperiodo")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkMultiperiodo();
+                return 0;
+            }
+            else if (argumento == "--benchmark-pareto")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkPareto();
+                return 0;
+            }
+            else if (argumento == "--benchmark-perezosas")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkPerezosas();
+                return 0;
+            }
+            else if (argumento == "--benchmark-precios")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkPrecios();
+                return 0;
+            }
+            else if (argumento == "--benchmark-puntos-control")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkPuntosControl();
+                return 0;
+            }
+            else if (argumento == "--benchmark-redes")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkRedes();
+                return 0;
+            }
+            else if (argumento == "--benchmark-reporte")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkReporte();
+                return 0;
+            }
+            else if (argumento == "--benchmark-robusto")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkRobusto();
+                return 0;
+            }
+            else if (argumento == "--benchmark-simplex")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkSimplex();
+                return 0;
+            }
+            else if (argumento == "--benchmark-tramos")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkTramos();
+                return 0;
+            }
+            else if (argumento == "--benchmark-verificacion")
+            {
+                cout << fixed << setprecision(2);
+                ejecutarBenchmarkVerificacion();
+                return 0;
+            }
+            else if (argumento == "--exportar-reporte" && i + 2 < argc)
+            {
+                // Reporte de la sesión guardada: --exportar-reporte <texto|csv|json> <archivo|->
+                formatoReporte = argv[++i];
+                archivoReporte = argv[++i];
+            }
+            else if (argumento == "--flujo-precios" && i + 1 < argc)
+            {
+                // Reoptimizar con cada precio leído: --flujo-precios <archivo|->
+                archivoPrecios = argv[++i];
+            }
+            else if (argumento == "--limite-tiempo" && i + 1 < argc)
+            {
+                // Segundos que puede durar un cálculo antes de cancelarse: --limite-tiempo <segundos>
+                char *fin = nullptr;
+                limiteTiempo = strtod(argv[++i], &fin);
+                if (*fin != '\0' || !isfinite(limiteTiempo) || limiteTiempo <= 0.0)
+                {
+                    throw invalid_argument("El límite de tiempo debe ser un número positivo de segundos.");
+                }
+            }
+            else if (argumento == "--pareto")
+            {
+                // Frontera de Pareto de la sesión guardada
+                fronteraPareto = true;
+            }
+            else if (argumento == "--ver-instantanea" && i + 1 < argc)
+            {
+                cout << fixed << setprecision(2);
+                mostrarInstantanea(argv[++i]);
+                return 0;
+            }
+            else if (argumento == "--sesion" && i + 1 < argc)
+            {
+                // Archivo de la sesión; una ruta vacía desactiva guardar y restaurar
+                archivoSesion = argv[++i];
+            }
+            else if (argumento == "--traza" && i + 1 < argc)
+            {
+                i++; // Ya activada antes de recorrer los modos
+            }
+        }
+
+        if (!formatoReporte.empty())
+        {
+            exportarReporteSesion(archivoSesion, formatoReporte, archivoReporte);
+            return 0;
+        }
+
+        if (!archivoPrecios.empty())
+        {
+            cout << fixed << setprecision(2);
+            procesarFlujoPrecios(archivoSesion, archivoPrecios);
+            return 0;
+        }
+
+        if (fronteraPareto)
+        {
+            cout << fixed << setprecision(2);
+            mostrarFronteraSesion(archivoSesion);
+            return 0;
+        }
+
         // Configurar la salida para mostrar números decimales correctamente
         cout << fixed << setprecision(2);
 
@@ -46,6 +282,11 @@ int main()
 
         // Crear instancia del sistema de optimización
         SistemaOptimizacion sistema;
+        sistema.setArchivoSesion(archivoSesion);
+        if (limiteTiempo > 0.0)
+        {
+            sistema.setLimiteTiempoCalculo(limiteTiempo);
+        }
 
         // Ejecutar el sistema principal
         sistema.ejecutarSistema();
@@ -0,0 +1,351 @@
+/**
+ * MÓDULO DE OBJETIVOS JERÁRQUICOS Y METAS
+ * Resuelve listas de objetivos en orden de prioridad (lexicográfico) y
+ * modelos de metas con variables de desviación. Cada etapa agrega el óptimo
+ * de la anterior como fila y cambia el objetivo sobre el mismo resolvedor:
+ * la base óptima sigue siendo factible y el símplex primal continúa desde ella
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <map>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+static const double TOL_FIJAR = 1e-9; // Margen relativo mínimo al fijar un óptimo (errores de redondeo)
+
+/**
+ * Cada meta agrega dos variables (exceso y defecto, ambas >= 0) y la fila
+ * a·x - exceso + defecto = valor. Las desviaciones que la meta no admite
+ * entran con su peso en el objetivo de su prioridad.
+ */
+vector<ObjetivoJerarquico> agregarMetas(ModeloLineal &modelo, const vector<MetaLineal> &metas)
+{
+    map<int, vector<pair<int, double>>> porPrioridad;
+    for (const auto &meta : metas)
+    {
+        if (meta.operador != "<=" && meta.operador != ">=" && meta.operador != "=")
+        {
+            throw invalid_argument("Operador de meta inválido en \"" + meta.nombre + "\": " + meta.operador);
+        }
+        if (!(meta.peso > 0.0))
+        {
+            throw invalid_argument("El peso de la meta \"" + meta.nombre + "\" debe ser positivo.");
+        }
+
+        int exceso = modelo.agregarVariable(0.0);
+        int defecto = modelo.agregarVariable(0.0);
+        vector<pair<int, double>> fila = meta.coeficientes;
+        fila.push_back(make_pair(exceso, -1.0));
+        fila.push_back(make_pair(defecto, 1.0));
+        modelo.agregarFila(fila, "=", meta.valor);
+
+        vector<pair<int, double>> &penalizadas = porPrioridad[meta.prioridad];
+        if (meta.operador != ">=")
+            penalizadas.push_back(make_pair(exceso, meta.peso));
+        if (meta.operador != "<=")
+            penalizadas.push_back(make_pair(defecto, meta.peso));
+    }
+
+    vector<ObjetivoJerarquico> objetivos;
+    for (const auto &nivel : porPrioridad)
+    {
+        objetivos.push_back(ObjetivoJerarquico("Desviación de prioridad " + to_string(nivel.first), nivel.second, false));
+    }
+    return objetivos;
+}
+
+// Valor del objetivo en la solución actual
+static double evaluarObjetivo(const ObjetivoJerarquico &objetivo, const ResolvedorSimplex &simplex)
+{
+    double valor = 0.0;
+    for (const auto &coeficiente : objetivo.coeficientes)
+        valor += coeficiente.second * simplex.getValor(coeficiente.first);
+    return valor;
+}
+
+// Fila que impide perder más de la holgura en el objetivo ya optimizado
+static void fijarOptimo(ResolvedorSimplex &simplex, const ObjetivoJerarquico &objetivo, double valor)
+{
+    double margen = max(objetivo.holgura * abs(valor), TOL_FIJAR * max(1.0, abs(valor)));
+    if (objetivo.maximizar)
+        simplex.agregarFila(objetivo.coeficientes, valor - margen, INFINITO_LP);
+    else
+        simplex.agregarFila(objetivo.coeficientes, -INFINITO_LP, valor + margen);
+}
+
+static void validarObjetivos(const ModeloLineal &modelo, const vector<ObjetivoJerarquico> &objetivos)
+{
+    if (objetivos.empty())
+    {
+        throw invalid_argument("Se necesita al menos un objetivo.");
+    }
+    if (!modelo.costosPorTramos.empty())
+    {
+        throw invalid_argument("Los objetivos jerárquicos no admiten costos por tramos.");
+    }
+    for (const auto &objetivo : objetivos)
+    {
+        for (const auto &coeficiente : objetivo.coeficientes)
+        {
+            if (coeficiente.first < 0 || coeficiente.first >= modelo.getNumVariables())
+            {
+                throw out_of_range("El objetivo \"" + objetivo.nombre + "\" usa una variable inexistente.");
+            }
+        }
+    }
+}
+
+/**
+ * Resuelve los objetivos en orden sobre un único resolvedor. Después de cada
+ * etapa se agrega la fila con su óptimo (la base sigue siendo factible: la
+ * variable lógica de la fila nueva entra básica) y se cambian los costos; la
+ * etapa siguiente solo hace los pivoteos que faltan desde esa base. Eso es
+ * poco cuando las etapas anteriores dejan una cara óptima chica (metas con
+ * prioridades); si la cara es grande, como la de una ganancia proporcional a
+ * las horas de un recurso, la etapa cuesta casi lo mismo que desde cero.
+ * @param modelo Modelo con las restricciones (su objetivo se ignora)
+ * @param objetivos Objetivos de la más importante a la menos
+ * @return Valores de cada etapa; se detiene en la primera que no es óptima
+ */
+ResultadoLexicografico resolverLexicografico(const ModeloLineal &modelo, const vector<ObjetivoJerarquico> &objetivos,
+                                             const OpcionesSimplex &opciones, const TokenCancelacion *token)
+{
+    TRAZA_AMBITO("lexicografico.resolver", "calculo");
+    validarObjetivos(modelo, objetivos);
+
+    // El símplex maximiza: los objetivos a minimizar entran con el signo cambiado
+    ModeloLineal primera = modelo;
+    primera.objetivo.assign(modelo.getNumVariables(), 0.0);
+    for (const auto &coeficiente : objetivos[0].coeficientes)
+        primera.objetivo[coeficiente.first] += objetivos[0].maximizar ? coeficiente.second : -coeficiente.second;
+
+    ResolvedorSimplex simplex;
+    simplex.setOpciones(opciones);
+    simplex.cargar(primera);
+    vector<double> costos = primera.objetivo;
+
+    ResultadoLexicografico resultado;
+    for (size_t k = 0; k < objetivos.size(); k++)
+    {
+        const ObjetivoJerarquico &objetivo = objetivos[k];
+        if (k > 0)
+        {
+            fijarOptimo(simplex, objetivos[k - 1], resultado.etapas.back().valor);
+            for (const auto &coeficiente : objetivos[k - 1].coeficientes)
+            {
+                costos[coeficiente.first] = 0.0;
+                simplex.cambiarObjetivo(coeficiente.first, 0.0);
+            }
+            for (const auto &coeficiente : objetivo.coeficientes)
+                costos[coeficiente.first] += objetivo.maximizar ? coeficiente.second : -coeficiente.second;
+            for (const auto &coeficiente : objetivo.coeficientes)
+                simplex.cambiarObjetivo(coeficiente.first, costos[coeficiente.first]);
+        }
+
+        auto inicio = chrono::steady_clock::now();
+        EtapaLexicografica etapa;
+        etapa.nombre = objetivo.nombre;
+        etapa.estado = simplex.resolver(token);
+        etapa.iteraciones = simplex.getIteraciones();
+        etapa.segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+        etapa.valor = etapa.estado == LP_OPTIMO ? evaluarObjetivo(objetivo, simplex) : 0.0;
+        resultado.etapas.push_back(etapa);
+        resultado.iteraciones += etapa.iteraciones;
+
+        if (etapa.estado != LP_OPTIMO)
+        {
+            resultado.estado = etapa.estado;
+            return resultado;
+        }
+        resultado.valores = simplex.getValores();
+    }
+
+    resultado.estado = LP_OPTIMO;
+    return resultado;
+}
+
+// ===== BENCHMARK =====
+
+// Mismas etapas, pero cada una carga desde cero un modelo con las filas de las anteriores
+static ResultadoLexicografico resolverEtapasDesdeCero(const ModeloLineal &modelo,
+                                                      const vector<ObjetivoJerarquico> &objetivos)
+{
+    ResultadoLexicografico resultado;
+    ModeloLineal etapas = modelo;
+    for (size_t k = 0; k < objetivos.size(); k++)
+    {
+        const ObjetivoJerarquico &objetivo = objetivos[k];
+        if (k > 0)
+        {
+            const ObjetivoJerarquico &anterior = objetivos[k - 1];
+            double valor = resultado.etapas.back().valor;
+            double margen = max(anterior.holgura * abs(valor), TOL_FIJAR * max(1.0, abs(valor)));
+            etapas.agregarFila(anterior.coeficientes, anterior.maximizar ? ">=" : "<=",
+                               anterior.maximizar ? valor - margen : valor + margen);
+        }
+        etapas.objetivo.assign(etapas.getNumVariables(), 0.0);
+        for (const auto &coeficiente : objetivo.coeficientes)
+            etapas.objetivo[coeficiente.first] += objetivo.maximizar ? coeficiente.second : -coeficiente.second;
+
+        auto inicio = chrono::steady_clock::now();
+        ResolvedorSimplex simplex;
+        simplex.cargar(etapas);
+        EtapaLexicografica etapa;
+        etapa.nombre = objetivo.nombre;
+        etapa.estado = simplex.resolver();
+        etapa.iteraciones = simplex.getIteraciones();
+        etapa.valor = etapa.estado == LP_OPTIMO ? evaluarObjetivo(objetivo, simplex) : 0.0;
+        etapa.segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+        resultado.etapas.push_back(etapa);
+        resultado.iteraciones += etapa.iteraciones;
+        if (etapa.estado != LP_OPTIMO)
+        {
+            resultado.estado = etapa.estado;
+            return resultado;
+        }
+        resultado.valores = simplex.getValores();
+    }
+    resultado.estado = LP_OPTIMO;
+    return resultado;
+}
+
+// Plan de productos con horas extra: la ganancia es proporcional a las horas
+// del recurso 0, así que hay muchos planes de ganancia máxima
+struct PlanConHorasExtra
+{
+    ModeloLineal modelo;
+    vector<pair<int, double>> ganancia;
+    vector<pair<int, double>> horasExtra;
+    vector<pair<int, double>> unidades;
+    vector<double> demanda;
+};
+
+static PlanConHorasExtra construirPlanConHorasExtra(int productos, int recursos, unsigned semilla)
+{
+    mt19937 generador(semilla);
+    uniform_int_distribution<int> horas(1, 5);
+    uniform_int_distribution<int> recurso(1, recursos - 1);
+    uniform_real_distribution<double> demanda(20.0, 80.0);
+
+    PlanConHorasExtra plan;
+    vector<vector<pair<int, double>>> filas(recursos);
+    for (int j = 0; j < productos; j++)
+    {
+        plan.demanda.push_back(demanda(generador));
+        int x = plan.modelo.agregarVariable(0.0, 0.0, plan.demanda.back());
+        double horasBase = horas(generador);
+        filas[0].push_back(make_pair(x, horasBase));
+        plan.ganancia.push_back(make_pair(x, 10.0 * horasBase));
+        plan.unidades.push_back(make_pair(x, 1.0));
+        for (int u = 0; u < 3; u++)
+            filas[recurso(generador)].push_back(make_pair(x, static_cast<double>(horas(generador))));
+    }
+    for (int r = 0; r < recursos; r++)
+    {
+        double necesidad = 0.0;
+        for (const auto &coeficiente : filas[r])
+            necesidad += coeficiente.second * plan.demanda[coeficiente.first];
+        double capacidad = 0.5 * necesidad;
+        int extra = plan.modelo.agregarVariable(0.0, 0.0, 0.2 * capacidad);
+        plan.horasExtra.push_back(make_pair(extra, 1.0));
+        filas[r].push_back(make_pair(extra, -1.0));
+        plan.modelo.agregarFila(filas[r], "<=", capacidad);
+    }
+    return plan;
+}
+
+// Muestra las etapas con y sin arranque en caliente y verifica que coincidan
+static void compararEtapas(const ModeloLineal &modelo, const vector<ObjetivoJerarquico> &objetivos)
+{
+    ResultadoLexicografico caliente = resolverLexicografico(modelo, objetivos);
+    ResultadoLexicografico frio = resolverEtapasDesdeCero(modelo, objetivos);
+
+    double totalCaliente = 0.0, totalFrio = 0.0;
+    bool coinciden = caliente.estado == frio.estado && caliente.etapas.size() == frio.etapas.size();
+    for (size_t k = 0; k < caliente.etapas.size(); k++)
+    {
+        const EtapaLexicografica &etapa = caliente.etapas[k];
+        totalCaliente += etapa.segundos;
+        cout << "  " << k + 1 << ". " << etapa.nombre << ": " << etapa.valor << " (" << etapa.iteraciones
+             << " iteraciones, " << etapa.segundos * 1000 << " ms";
+        if (k < frio.etapas.size())
+        {
+            totalFrio += frio.etapas[k].segundos;
+            cout << "; desde cero " << frio.etapas[k].iteraciones << " iteraciones, " << frio.etapas[k].segundos * 1000
+                 << " ms";
+            double valor = frio.etapas[k].valor;
+            if (abs(valor - etapa.valor) > 1e-6 * max(1.0, abs(valor)))
+                coinciden = false;
+        }
+        cout << ")" << endl;
+    }
+    cout << "  • Total en caliente: " << caliente.iteraciones << " iteraciones, " << totalCaliente * 1000 << " ms" << endl;
+    cout << "  • Total desde cero: " << frio.iteraciones << " iteraciones, " << totalFrio * 1000 << " ms ("
+         << totalFrio / max(totalCaliente, 1e-9) << "x el tiempo en caliente)" << endl;
+    if (!coinciden)
+    {
+        mostrarMensajeError("Las etapas en caliente no coinciden con las resueltas desde cero.");
+    }
+}
+
+/**
+ * Resuelve objetivos jerárquicos y metas sobre Flair y sobre un plan grande,
+ * con cada etapa en caliente y desde cero
+ */
+void ejecutarBenchmarkLexicografico()
+{
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: OBJETIVOS JERÁRQUICOS Y METAS" << endl;
+    cout << string(60, '=') << endl;
+
+    // Flair con la ganancia paralela a las horas de carpintería: todo el lado
+    // entre (30, 40) y (15, 60) da $4800; entre esos planes, menos pintura
+    ModeloProduccion flair;
+    flair.precioMesa = 80.0;
+    flair.precioSilla = 60.0;
+    flair.restricciones.push_back(4 * X1 + 3 * X2 <= 240);
+    flair.restricciones.push_back(2 * X1 + X2 <= 100);
+    flair.restricciones.push_back(X2 <= 60);
+    ModeloLineal lineal = construirModeloLineal(flair);
+    vector<ObjetivoJerarquico> objetivosFlair = {ObjetivoJerarquico("Ganancia", {{0, 80.0}, {1, 60.0}}),
+                                                 ObjetivoJerarquico("Horas de pintura", {{0, 2.0}, {1, 1.0}}, false)};
+    ResultadoLexicografico resultadoFlair = resolverLexicografico(lineal, objetivosFlair);
+    cout << "\nFlair: ganancia máxima y luego menos horas de pintura" << endl;
+    for (const auto &etapa : resultadoFlair.etapas)
+        cout << "  • " << etapa.nombre << ": " << etapa.valor << endl;
+    cout << "  • Plan: " << resultadoFlair.valores[0] << " mesas, " << resultadoFlair.valores[1] << " sillas" << endl;
+    if (abs(resultadoFlair.valores[0] - 15.0) > 1e-6 || abs(resultadoFlair.valores[1] - 60.0) > 1e-6)
+    {
+        mostrarMensajeError("Flair debería quedar en 15 mesas y 60 sillas.");
+    }
+
+    PlanConHorasExtra plan = construirPlanConHorasExtra(400, 80, 3);
+    cout << "\nPlan de 400 productos y 80 recursos con horas extra (" << plan.modelo.getNumVariables()
+         << " variables, " << plan.modelo.getNumFilas() << " filas):" << endl;
+    vector<ObjetivoJerarquico> objetivos = {ObjetivoJerarquico("Ganancia", plan.ganancia),
+                                            ObjetivoJerarquico("Horas extra", plan.horasExtra, false),
+                                            ObjetivoJerarquico("Unidades", plan.unidades)};
+    compararEtapas(plan.modelo, objetivos);
+
+    // Metas: sin horas extra, luego una ganancia que las necesita, luego el 30% de cada demanda
+    ResultadoLexicografico referencia = resolverLexicografico(plan.modelo, {objetivos[0]});
+    ModeloLineal conMetas = plan.modelo;
+    vector<MetaLineal> metas;
+    for (const auto &extra : plan.horasExtra)
+        metas.push_back(MetaLineal("Sin horas extra", {extra}, "<=", 0.0, 1));
+    metas.push_back(MetaLineal("Ganancia", plan.ganancia, ">=", 0.98 * referencia.etapas[0].valor, 2));
+    for (size_t j = 0; j < plan.unidades.size(); j++)
+        metas.push_back(MetaLineal("Demanda mínima", {plan.unidades[j]}, ">=", 0.3 * plan.demanda[j], 3));
+    vector<ObjetivoJerarquico> prioridades = agregarMetas(conMetas, metas);
+
+    cout << "\nMetas sobre el mismo plan (" << metas.size() << " metas en " << prioridades.size()
+         << " prioridades):" << endl;
+    compararEtapas(conMetas, prioridades);
+}
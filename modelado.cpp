@@ -0,0 +1,116 @@
+/**
+ * MÓDULO DE MODELADO CON EXPRESIONES
+ * Medición de la capa de plantillas de expresión declarada en optimizacion.h
+ * frente a la construcción de restricciones con el operador como cadena
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <cmath>
+
+using namespace std;
+
+/**
+ * Construye el mismo conjunto de restricciones con el constructor de
+ * Restriccion y con expresiones, y compara tiempos y resultados
+ * @param restricciones Número de restricciones de cada prueba
+ */
+void ejecutarBenchmarkModelado(size_t restricciones)
+{
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: MODELADO CON PLANTILLAS DE EXPRESIÓN" << endl;
+    cout << string(60, '=') << endl;
+
+    auto coeficiente = [](size_t i, size_t modulo) { return 1.0 + static_cast<double>(i % modulo); };
+
+    // Modelo de dos variables: operador leído como cadena, como en el ingreso por menú
+    vector<Restriccion> conCadenas;
+    conCadenas.reserve(restricciones);
+    auto inicio = chrono::steady_clock::now();
+    for (size_t i = 0; i < restricciones; i++)
+    {
+        string operador = i % 4 == 0 ? ">=" : "<=";
+        conCadenas.push_back(Restriccion(coeficiente(i, 7), coeficiente(i, 5), 100.0 + i % 100, operador));
+    }
+    double segundosCadenas = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    vector<Restriccion> conExpresiones;
+    conExpresiones.reserve(restricciones);
+    inicio = chrono::steady_clock::now();
+    // Las dos últimas formas son la misma "<=" escrita con la constante a la
+    // izquierda y multiplicada por -1: deben quedar en forma canónica
+    for (size_t i = 0; i < restricciones; i++)
+    {
+        if (i % 4 == 0)
+            conExpresiones.push_back(coeficiente(i, 7) * X1 + coeficiente(i, 5) * X2 >= 100.0 + i % 100);
+        else if (i % 4 == 1)
+            conExpresiones.push_back(coeficiente(i, 7) * X1 + coeficiente(i, 5) * X2 <= 100.0 + i % 100);
+        else if (i % 4 == 2)
+            conExpresiones.push_back(100.0 + i % 100 >= coeficiente(i, 7) * X1 + coeficiente(i, 5) * X2);
+        else
+            conExpresiones.push_back(-coeficiente(i, 7) * X1 - coeficiente(i, 5) * X2 >= -(100.0 + i % 100));
+    }
+    double segundosExpresiones = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    size_t diferencias = 0;
+    for (size_t i = 0; i < restricciones; i++)
+    {
+        const Restriccion &a = conCadenas[i];
+        const Restriccion &b = conExpresiones[i];
+        if (a.coeficienteX1 != b.coeficienteX1 || a.coeficienteX2 != b.coeficienteX2 ||
+            a.valorConstante != b.valorConstante || a.operador != b.operador)
+            diferencias++;
+    }
+
+    cout << restricciones << " restricciones de dos variables:" << endl;
+    cout << "  • Constructor con cadena: " << segundosCadenas * 1000 << " ms" << endl;
+    cout << "  • Expresiones: " << segundosExpresiones * 1000 << " ms" << endl;
+    cout << "  • Tamaño de '4 * X1 + 3 * X2 <= 240' en la pila: " << sizeof(4 * X1 + 3 * X2 <= 240) << " bytes" << endl;
+    if (diferencias > 0)
+    {
+        mostrarMensajeError("Las dos construcciones no coinciden en " + to_string(diferencias) + " restricciones.");
+    }
+
+    // Modelo general: filas de tres términos sobre 1000 variables
+    const int variables = 1000;
+    size_t filas = restricciones / 10;
+
+    ModeloLineal manual;
+    for (int j = 0; j < variables; j++)
+        manual.agregarVariable(1.0);
+    inicio = chrono::steady_clock::now();
+    for (size_t i = 0; i < filas; i++)
+    {
+        int j = static_cast<int>(i % (variables - 2));
+        vector<pair<int, double>> fila = {{j, coeficiente(i, 7)}, {j + 1, coeficiente(i, 5)}, {j + 2, -1.0}};
+        manual.agregarFila(fila, "<=", 100.0 + i % 100);
+    }
+    double segundosManual = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    ModeloLineal modelado;
+    for (int j = 0; j < variables; j++)
+        modelado.agregarVariable(1.0);
+    inicio = chrono::steady_clock::now();
+    for (size_t i = 0; i < filas; i++)
+    {
+        int j = static_cast<int>(i % (variables - 2));
+        VariableLineal a(j), b(j + 1), c(j + 2);
+        if (i % 2 == 0)
+            agregarRestriccion(modelado, coeficiente(i, 7) * a + coeficiente(i, 5) * b - c <= 100.0 + i % 100);
+        else
+            agregarRestriccion(modelado, 100.0 + i % 100 >= coeficiente(i, 7) * a + coeficiente(i, 5) * b - c);
+    }
+    double segundosModelado = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    bool iguales = manual.filas == modelado.filas && manual.filaInferior == modelado.filaInferior &&
+                   manual.filaSuperior == modelado.filaSuperior;
+
+    cout << "\n" << filas << " filas de un modelo lineal de " << variables << " variables:" << endl;
+    cout << "  • Vector de pares y cadena: " << segundosManual * 1000 << " ms" << endl;
+    cout << "  • agregarRestriccion con expresiones: " << segundosModelado * 1000 << " ms" << endl;
+    if (!iguales)
+    {
+        mostrarMensajeError("Los modelos lineales construidos no coinciden.");
+    }
+}
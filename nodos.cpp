@@ -0,0 +1,698 @@
+/**
+ * MÓDULO DE ALMACENAMIENTO DE NODOS
+ * Cola de nodos abiertos del modo entero con presupuesto de memoria (los
+ * nodos de peor cota se pasan a un archivo de desborde) y puntos de control
+ * para retomar una búsqueda larga exactamente donde quedó
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <cstdio>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <map>
+
+using namespace std;
+
+// Registro de un nodo en disco, seguido de numCambios registros de cambio
+struct RegistroNodo
+{
+    double cota;
+    int32_t profundidad;
+    uint32_t numCambios;
+};
+
+struct RegistroCambio
+{
+    double inferior;
+    double superior;
+    int32_t variable;
+    uint32_t reservado;
+};
+
+// Registro de un corte, seguido de numCoeficientes registros de coeficiente
+struct RegistroCorte
+{
+    double lado;
+    uint64_t firma;
+    uint32_t tipo;
+    uint32_t numCoeficientes;
+};
+
+struct RegistroCoeficiente
+{
+    double valor;
+    int32_t variable;
+    uint32_t reservado;
+};
+
+const char FIRMA_PUNTO_CONTROL[8] = {'F', 'L', 'A', 'I', 'R', 'B', 'Y', 'B'};
+const uint32_t VERSION_PUNTO_CONTROL = 1;
+
+struct CabeceraPuntoControl
+{
+    char firma[8];           // FIRMA_PUNTO_CONTROL
+    uint32_t version;        // VERSION_PUNTO_CONTROL
+    uint32_t marcaOrden;     // MARCA_ORDEN_BYTES
+    uint64_t tamanoArchivo;  // Bytes totales, cabecera incluida
+    uint64_t sumaDatos;      // FNV-1a de todo lo que sigue a la cabecera
+    uint64_t sumaCabecera;   // FNV-1a de la cabecera con este campo en cero
+    uint64_t firmaModelo;
+    double mejorValor;
+    double cotaRaizInicial;
+    double cotaRaiz;
+    int64_t nodos;
+    int64_t iteracionesSimplex;
+    int64_t cortes;
+    uint32_t numValores;
+    uint32_t numNodos;
+    uint32_t numCortes;
+    uint32_t reservado;
+};
+
+// Suma FNV-1a de 64 bits
+static uint64_t sumaFnv(const char *datos, size_t tamano, uint64_t suma = 1469598103934665603ULL)
+{
+    for (size_t i = 0; i < tamano; i++)
+    {
+        suma ^= static_cast<unsigned char>(datos[i]);
+        suma *= 1099511628211ULL;
+    }
+    return suma;
+}
+
+template <typename T>
+static uint64_t sumarValor(uint64_t suma, const T &valor)
+{
+    return sumaFnv(reinterpret_cast<const char *>(&valor), sizeof(T), suma);
+}
+
+static uint64_t sumaCabecera(CabeceraPuntoControl cabecera)
+{
+    cabecera.sumaCabecera = 0;
+    return sumaFnv(reinterpret_cast<const char *>(&cabecera), sizeof(cabecera));
+}
+
+template <typename T>
+static void escribirRegistro(vector<char> &destino, const T &registro)
+{
+    const char *datos = reinterpret_cast<const char *>(&registro);
+    destino.insert(destino.end(), datos, datos + sizeof(T));
+}
+
+// Lee un registro y avanza; false si no queda espacio
+template <typename T>
+static bool leerRegistro(const char *&actual, const char *fin, T &registro)
+{
+    if (static_cast<size_t>(fin - actual) < sizeof(T))
+        return false;
+    memcpy(&registro, actual, sizeof(T));
+    actual += sizeof(T);
+    return true;
+}
+
+// Solo el último cambio de cada variable, en orden de variable
+static void escribirNodo(vector<char> &destino, const NodoRamificacion &nodo)
+{
+    map<int, const CambioCota *> vigentes;
+    for (const auto &cambio : nodo.cambios)
+        vigentes[cambio.variable] = &cambio;
+
+    escribirRegistro(destino, RegistroNodo{nodo.cota, nodo.profundidad, static_cast<uint32_t>(vigentes.size())});
+    for (const auto &vigente : vigentes)
+    {
+        const CambioCota &cambio = *vigente.second;
+        escribirRegistro(destino, RegistroCambio{cambio.inferior, cambio.superior, cambio.variable, 0});
+    }
+}
+
+static bool leerNodo(const char *&actual, const char *fin, NodoRamificacion &nodo)
+{
+    RegistroNodo registro;
+    if (!leerRegistro(actual, fin, registro) ||
+        static_cast<size_t>(fin - actual) / sizeof(RegistroCambio) < registro.numCambios)
+        return false;
+    nodo.cota = registro.cota;
+    nodo.profundidad = registro.profundidad;
+    nodo.cambios.resize(registro.numCambios);
+    for (auto &cambio : nodo.cambios)
+    {
+        RegistroCambio leido;
+        leerRegistro(actual, fin, leido);
+        cambio = CambioCota{leido.variable, leido.inferior, leido.superior};
+    }
+    return true;
+}
+
+static vector<char> leerArchivo(const string &ruta)
+{
+    ifstream archivo(ruta, ios::binary | ios::ate);
+    if (!archivo)
+        return {};
+    vector<char> datos(static_cast<size_t>(archivo.tellg()));
+    archivo.seekg(0);
+    archivo.read(datos.data(), datos.size());
+    if (!archivo)
+        throw runtime_error("No se pudo leer el archivo: " + ruta);
+    return datos;
+}
+
+// ===== COLA DE NODOS =====
+
+static const size_t BLOQUE_LECTURA = 64 * 1024; // Bytes leídos de cada tramo por acceso
+
+// Orden del montículo: mayor cota primero y, a igual cota, el más profundo
+static bool menorCota(const NodoRamificacion &a, const NodoRamificacion &b)
+{
+    return a.cota < b.cota || (a.cota == b.cota && a.profundidad < b.profundidad);
+}
+
+static vector<char> leerRango(ifstream &archivo, uint64_t inicio, size_t bytes)
+{
+    vector<char> datos(bytes);
+    archivo.clear();
+    archivo.seekg(static_cast<streamoff>(inicio));
+    if (!archivo.read(datos.data(), bytes))
+        throw runtime_error("El archivo de desborde está incompleto.");
+    return datos;
+}
+
+ColaNodos::ColaNodos(size_t presupuestoBytes, const string &rutaDesborde)
+    : bytesEnMemoria(0), presupuesto(presupuestoBytes), rutaDesborde(rutaDesborde), tamanoArchivo(0),
+      nodosEnDisco(0), umbralPoda(-INFINITO_LP), desbordes(0), recargas(0)
+{
+    if (presupuesto > 0 && rutaDesborde.empty())
+    {
+        throw invalid_argument("Con presupuesto de memoria hace falta un archivo de desborde.");
+    }
+    if (presupuesto > 0)
+        remove(rutaDesborde.c_str()); // Restos de una búsqueda que no terminó
+}
+
+ColaNodos::~ColaNodos()
+{
+    if (tamanoArchivo > 0)
+        remove(rutaDesborde.c_str());
+}
+
+size_t ColaNodos::bytesNodo(const NodoRamificacion &nodo)
+{
+    return sizeof(NodoRamificacion) + nodo.cambios.size() * sizeof(CambioCota);
+}
+
+double ColaNodos::getMejorCotaEnDisco() const
+{
+    double cota = -INFINITO_LP;
+    for (const auto &tramo : tramos)
+        cota = max(cota, tramo.cotaPrimero);
+    return cota;
+}
+
+void ColaNodos::agregar(NodoRamificacion nodo)
+{
+    bytesEnMemoria += bytesNodo(nodo);
+    monticulo.push_back(move(nodo));
+    push_heap(monticulo.begin(), monticulo.end(), menorCota);
+    if (presupuesto > 0 && bytesEnMemoria > presupuesto)
+        desbordar();
+}
+
+// Deja en memoria los mejores nodos hasta la mitad del presupuesto y escribe
+// el resto, ordenado, como un tramo nuevo al final del archivo
+void ColaNodos::desbordar()
+{
+    TRAZA_AMBITO("nodos.desbordar", "archivo");
+
+    sort(monticulo.begin(), monticulo.end(), [](const NodoRamificacion &a, const NodoRamificacion &b)
+         { return menorCota(b, a); });
+    size_t conservar = 0;
+    size_t bytes = 0;
+    while (conservar < monticulo.size() && bytes + bytesNodo(monticulo[conservar]) <= presupuesto / 2)
+        bytes += bytesNodo(monticulo[conservar++]);
+
+    vector<char> datos;
+    TramoDisco tramo{tamanoArchivo, tamanoArchivo, 0, -INFINITO_LP};
+    for (size_t k = conservar; k < monticulo.size() && monticulo[k].cota > umbralPoda; k++)
+    {
+        if (tramo.nodos++ == 0)
+            tramo.cotaPrimero = monticulo[k].cota;
+        escribirNodo(datos, monticulo[k]);
+    }
+    if (tramo.nodos > 0)
+    {
+        ofstream archivo(rutaDesborde, ios::binary | ios::app);
+        if (!archivo.write(datos.data(), datos.size()) || !archivo.flush())
+        {
+            throw runtime_error("No se pudo escribir el archivo de desborde: " + rutaDesborde);
+        }
+        tramo.fin += datos.size();
+        tamanoArchivo = tramo.fin;
+        tramos.push_back(tramo);
+        nodosEnDisco += tramo.nodos;
+    }
+
+    monticulo.resize(conservar);
+    make_heap(monticulo.begin(), monticulo.end(), menorCota);
+    bytesEnMemoria = bytes;
+    desbordes++;
+}
+
+// Mezcla los tramos de mayor a menor cota: trae al menos el mejor nodo del
+// disco y sigue hasta tres cuartos del presupuesto
+void ColaNodos::recargar()
+{
+    TRAZA_AMBITO("nodos.recargar", "archivo");
+
+    ifstream archivo(rutaDesborde, ios::binary);
+    if (!archivo)
+    {
+        throw runtime_error("No se pudo abrir el archivo de desborde: " + rutaDesborde);
+    }
+    // Bloque leído de cada tramo; la posición en el bloque corresponde a tramo.inicio
+    vector<vector<char>> bloques(tramos.size());
+    vector<size_t> posiciones(tramos.size(), 0);
+    auto asegurar = [&](size_t t, size_t bytes)
+    {
+        if (bloques[t].size() - posiciones[t] >= bytes)
+            return;
+        size_t restante = static_cast<size_t>(tramos[t].fin - tramos[t].inicio);
+        bloques[t] = leerRango(archivo, tramos[t].inicio, min(restante, max(BLOQUE_LECTURA, bytes)));
+        posiciones[t] = 0;
+    };
+
+    bool primero = true;
+    while (primero || bytesEnMemoria < presupuesto / 4 * 3)
+    {
+        size_t mejor = tramos.size();
+        for (size_t t = 0; t < tramos.size(); t++)
+        {
+            if (tramos[t].nodos > 0 && tramos[t].cotaPrimero > umbralPoda &&
+                (mejor == tramos.size() || tramos[t].cotaPrimero > tramos[mejor].cotaPrimero))
+                mejor = t;
+        }
+        if (mejor == tramos.size())
+            break;
+
+        TramoDisco &tramo = tramos[mejor];
+        RegistroNodo registro;
+        asegurar(mejor, sizeof(registro));
+        memcpy(&registro, bloques[mejor].data() + posiciones[mejor], sizeof(registro));
+        size_t tamano = sizeof(RegistroNodo) + registro.numCambios * sizeof(RegistroCambio);
+        asegurar(mejor, tamano);
+        const char *actual = bloques[mejor].data() + posiciones[mejor];
+        NodoRamificacion nodo;
+        if (!leerNodo(actual, actual + tamano, nodo))
+        {
+            throw runtime_error("El archivo de desborde está dañado: " + rutaDesborde);
+        }
+        posiciones[mejor] += tamano;
+        tramo.inicio += tamano;
+        tramo.nodos--;
+        nodosEnDisco--;
+        if (tramo.nodos > 0)
+        {
+            asegurar(mejor, sizeof(double));
+            memcpy(&tramo.cotaPrimero, bloques[mejor].data() + posiciones[mejor], sizeof(double));
+        }
+
+        bytesEnMemoria += bytesNodo(nodo);
+        monticulo.push_back(move(nodo));
+        push_heap(monticulo.begin(), monticulo.end(), menorCota);
+        primero = false;
+    }
+
+    // Fuera los tramos leídos del todo o que ya solo tienen nodos podados
+    for (size_t t = tramos.size(); t-- > 0;)
+    {
+        if (tramos[t].nodos == 0 || tramos[t].cotaPrimero <= umbralPoda)
+        {
+            nodosEnDisco -= tramos[t].nodos;
+            tramos.erase(tramos.begin() + t);
+        }
+    }
+    archivo.close();
+    compactarArchivo();
+    recargas++;
+    if (bytesEnMemoria > presupuesto)
+        desbordar();
+}
+
+// Borra el archivo si ya no tiene tramos, o lo reescribe cuando más de la
+// mitad son nodos ya leídos
+void ColaNodos::compactarArchivo()
+{
+    if (tramos.empty())
+    {
+        if (tamanoArchivo > 0)
+            remove(rutaDesborde.c_str());
+        tamanoArchivo = 0;
+        return;
+    }
+    uint64_t vivos = 0;
+    for (const auto &tramo : tramos)
+        vivos += tramo.fin - tramo.inicio;
+    if (vivos * 2 > tamanoArchivo || tamanoArchivo < presupuesto)
+        return;
+
+    TRAZA_AMBITO("nodos.compactar", "archivo");
+    string temporal = rutaDesborde + ".tmp";
+    {
+        ifstream origen(rutaDesborde, ios::binary);
+        ofstream destino(temporal, ios::binary | ios::trunc);
+        uint64_t posicion = 0;
+        for (auto &tramo : tramos)
+        {
+            vector<char> datos = leerRango(origen, tramo.inicio, static_cast<size_t>(tramo.fin - tramo.inicio));
+            destino.write(datos.data(), datos.size());
+            tramo.inicio = posicion;
+            posicion += datos.size();
+            tramo.fin = posicion;
+        }
+        if (!destino.flush())
+        {
+            throw runtime_error("No se pudo escribir el archivo: " + temporal);
+        }
+        tamanoArchivo = posicion;
+    }
+#ifdef _WIN32
+    remove(rutaDesborde.c_str()); // En Windows rename() no reemplaza un archivo existente
+#endif
+    if (rename(temporal.c_str(), rutaDesborde.c_str()) != 0)
+    {
+        remove(temporal.c_str());
+        throw runtime_error("No se pudo reemplazar el archivo: " + rutaDesborde);
+    }
+}
+
+bool ColaNodos::extraer(NodoRamificacion &nodo)
+{
+    if (nodosEnDisco > 0 && (monticulo.empty() || monticulo.front().cota < getMejorCotaEnDisco()))
+        recargar();
+    if (monticulo.empty())
+        return false;
+
+    pop_heap(monticulo.begin(), monticulo.end(), menorCota);
+    nodo = move(monticulo.back());
+    monticulo.pop_back();
+    bytesEnMemoria -= bytesNodo(nodo);
+    return true;
+}
+
+double ColaNodos::getMejorCota() const
+{
+    double cota = monticulo.empty() ? -INFINITO_LP : monticulo.front().cota;
+    return max(cota, getMejorCotaEnDisco());
+}
+
+void ColaNodos::podar(double valor)
+{
+    umbralPoda = max(umbralPoda, valor);
+    for (size_t t = tramos.size(); t-- > 0;)
+    {
+        // Cada tramo está ordenado: si el primero no mejora la solución, ninguno lo hace
+        if (tramos[t].cotaPrimero <= umbralPoda)
+        {
+            nodosEnDisco -= tramos[t].nodos;
+            tramos.erase(tramos.begin() + t);
+        }
+    }
+    compactarArchivo();
+}
+
+vector<NodoRamificacion> ColaNodos::copiarNodos() const
+{
+    vector<NodoRamificacion> nodos(monticulo.begin(), monticulo.end());
+    if (tramos.empty())
+        return nodos;
+
+    ifstream archivo(rutaDesborde, ios::binary);
+    for (const auto &tramo : tramos)
+    {
+        vector<char> datos = leerRango(archivo, tramo.inicio, static_cast<size_t>(tramo.fin - tramo.inicio));
+        const char *actual = datos.data();
+        for (size_t k = 0; k < tramo.nodos; k++)
+        {
+            NodoRamificacion nodo;
+            if (!leerNodo(actual, datos.data() + datos.size(), nodo))
+            {
+                throw runtime_error("El archivo de desborde está dañado: " + rutaDesborde);
+            }
+            if (nodo.cota <= umbralPoda)
+                break;
+            nodos.push_back(move(nodo));
+        }
+    }
+    return nodos;
+}
+
+// ===== PUNTOS DE CONTROL =====
+
+uint64_t calcularFirmaModeloEntero(const ModeloEntero &modelo)
+{
+    const ModeloLineal &lineal = modelo.lineal;
+    uint64_t suma = calcularFirmaFactible(lineal, modelo.variablesEnteras);
+    for (double costo : lineal.objetivo)
+        suma = sumarValor(suma, costo);
+    for (const auto &costo : lineal.costosPorTramos)
+    {
+        for (size_t k = 0; k < costo.funcion.puntos.size(); k++)
+        {
+            suma = sumarValor(suma, costo.funcion.puntos[k]);
+            suma = sumarValor(suma, costo.funcion.valores[k]);
+        }
+    }
+    for (const auto &conjunto : modelo.conjuntosSOS2)
+    {
+        for (size_t k = 0; k < conjunto.variables.size(); k++)
+        {
+            suma = sumarValor(suma, conjunto.variables[k]);
+            suma = sumarValor(suma, conjunto.pesos[k]);
+        }
+    }
+    return suma;
+}
+
+/**
+ * Escribe el punto de control de una búsqueda
+ * @param ruta Archivo de destino (se reemplaza solo si la escritura termina bien)
+ * @param estado Incumbente, nodos abiertos, contadores y cortes del pool
+ */
+void guardarPuntoControl(const string &ruta, const EstadoBusqueda &estado)
+{
+    TRAZA_AMBITO("nodos.guardarPuntoControl", "archivo");
+
+    vector<char> datos;
+    for (double valor : estado.valores)
+        escribirRegistro(datos, valor);
+    for (const auto &nodo : estado.abiertos)
+        escribirNodo(datos, nodo);
+    for (const auto &corte : estado.pool)
+    {
+        escribirRegistro(datos, RegistroCorte{corte.lado, corte.firma, static_cast<uint32_t>(corte.tipo),
+                                              static_cast<uint32_t>(corte.coeficientes.size())});
+        for (const auto &coeficiente : corte.coeficientes)
+            escribirRegistro(datos, RegistroCoeficiente{coeficiente.second, coeficiente.first, 0});
+    }
+
+    CabeceraPuntoControl cabecera;
+    memset(&cabecera, 0, sizeof(cabecera));
+    memcpy(cabecera.firma, FIRMA_PUNTO_CONTROL, sizeof(cabecera.firma));
+    cabecera.version = VERSION_PUNTO_CONTROL;
+    cabecera.marcaOrden = MARCA_ORDEN_BYTES;
+    cabecera.tamanoArchivo = sizeof(cabecera) + datos.size();
+    cabecera.sumaDatos = sumaFnv(datos.data(), datos.size());
+    cabecera.firmaModelo = estado.firmaModelo;
+    cabecera.mejorValor = estado.mejorValor;
+    cabecera.cotaRaizInicial = estado.cotaRaizInicial;
+    cabecera.cotaRaiz = estado.cotaRaiz;
+    cabecera.nodos = estado.nodos;
+    cabecera.iteracionesSimplex = estado.iteracionesSimplex;
+    cabecera.cortes = estado.cortes;
+    cabecera.numValores = static_cast<uint32_t>(estado.valores.size());
+    cabecera.numNodos = static_cast<uint32_t>(estado.abiertos.size());
+    cabecera.numCortes = static_cast<uint32_t>(estado.pool.size());
+    cabecera.sumaCabecera = sumaCabecera(cabecera);
+
+    // Escribir en un temporal y renombrar: un corte a mitad deja el punto anterior intacto
+    string temporal = ruta + ".tmp";
+    {
+        ofstream archivo(temporal, ios::binary | ios::trunc);
+        if (!archivo)
+        {
+            throw runtime_error("No se pudo crear el archivo: " + temporal);
+        }
+        archivo.write(reinterpret_cast<const char *>(&cabecera), sizeof(cabecera));
+        archivo.write(datos.data(), datos.size());
+        if (!archivo.flush())
+        {
+            throw runtime_error("No se pudo escribir el archivo: " + temporal);
+        }
+    }
+
+#ifdef _WIN32
+    remove(ruta.c_str()); // En Windows rename() no reemplaza un archivo existente
+#endif
+    if (rename(temporal.c_str(), ruta.c_str()) != 0)
+    {
+        remove(temporal.c_str());
+        throw runtime_error("No se pudo reemplazar el archivo: " + ruta);
+    }
+}
+
+/**
+ * Lee un punto de control
+ * @param ruta Archivo escrito por guardarPuntoControl
+ * @param estado Estado leído (solo se modifica si el archivo es válido)
+ * @return false si el archivo no existe
+ */
+bool cargarPuntoControl(const string &ruta, EstadoBusqueda &estado)
+{
+    TRAZA_AMBITO("nodos.cargarPuntoControl", "archivo");
+
+    if (!ifstream(ruta, ios::binary))
+        return false;
+    vector<char> datos = leerArchivo(ruta);
+
+    CabeceraPuntoControl cabecera;
+    if (datos.size() < sizeof(cabecera))
+    {
+        throw runtime_error("El punto de control está incompleto: " + ruta);
+    }
+    memcpy(&cabecera, datos.data(), sizeof(cabecera));
+    if (memcmp(cabecera.firma, FIRMA_PUNTO_CONTROL, sizeof(cabecera.firma)) != 0)
+        throw runtime_error("El archivo no es un punto de control del modo entero: " + ruta);
+    if (cabecera.marcaOrden != MARCA_ORDEN_BYTES)
+        throw runtime_error("El punto de control fue escrito en un equipo con otro orden de bytes.");
+    if (cabecera.version == 0 || cabecera.version > VERSION_PUNTO_CONTROL)
+        throw runtime_error("Versión de punto de control no soportada: " + to_string(cabecera.version));
+    if (cabecera.sumaCabecera != sumaCabecera(cabecera))
+        throw runtime_error("La cabecera del punto de control está dañada.");
+    if (cabecera.tamanoArchivo != datos.size() ||
+        cabecera.sumaDatos != sumaFnv(datos.data() + sizeof(cabecera), datos.size() - sizeof(cabecera)))
+        throw runtime_error("Los datos del punto de control están dañados (suma de verificación incorrecta).");
+
+    EstadoBusqueda leido;
+    leido.firmaModelo = cabecera.firmaModelo;
+    leido.mejorValor = cabecera.mejorValor;
+    leido.cotaRaizInicial = cabecera.cotaRaizInicial;
+    leido.cotaRaiz = cabecera.cotaRaiz;
+    leido.nodos = cabecera.nodos;
+    leido.iteracionesSimplex = cabecera.iteracionesSimplex;
+    leido.cortes = cabecera.cortes;
+
+    const char *actual = datos.data() + sizeof(cabecera);
+    const char *fin = datos.data() + datos.size();
+    bool completo = true;
+    leido.valores.resize(cabecera.numValores);
+    for (size_t k = 0; k < leido.valores.size() && completo; k++)
+        completo = leerRegistro(actual, fin, leido.valores[k]);
+    leido.abiertos.resize(cabecera.numNodos);
+    for (size_t k = 0; k < leido.abiertos.size() && completo; k++)
+        completo = leerNodo(actual, fin, leido.abiertos[k]);
+    leido.pool.resize(cabecera.numCortes);
+    for (size_t k = 0; k < leido.pool.size() && completo; k++)
+    {
+        Corte &corte = leido.pool[k];
+        RegistroCorte registro;
+        completo = leerRegistro(actual, fin, registro) && registro.tipo <= CORTE_CUBIERTA;
+        if (!completo)
+            break;
+        corte.lado = registro.lado;
+        corte.firma = registro.firma;
+        corte.tipo = static_cast<TipoCorte>(registro.tipo);
+        corte.coeficientes.resize(registro.numCoeficientes);
+        for (auto &coeficiente : corte.coeficientes)
+        {
+            RegistroCoeficiente valor;
+            completo = completo && leerRegistro(actual, fin, valor);
+            coeficiente = make_pair(static_cast<int>(valor.variable), valor.valor);
+        }
+    }
+    if (!completo || actual != fin)
+    {
+        throw runtime_error("El contenido del punto de control no coincide con su cabecera.");
+    }
+
+    estado = move(leido);
+    return true;
+}
+
+// ===== BENCHMARK =====
+
+/**
+ * Mide el desborde a disco y la reanudación desde un punto de control sobre
+ * una planta de lotes sin cortes (un árbol de cientos de miles de nodos)
+ */
+void ejecutarBenchmarkPuntosControl()
+{
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: NODOS EN DISCO Y PUNTOS DE CONTROL" << endl;
+    cout << string(60, '=') << endl;
+
+    ModeloEntero planta = construirPlantaLotes(15, 4, 1);
+    ParametrosCortes sinCortes;
+    sinCortes.rondasRaiz = 0;
+    sinCortes.poolEnNodos = false;
+    const string puntoControl = "benchmark_entero.ckpt";
+    remove(puntoControl.c_str());
+
+    auto medir = [&](const OpcionesAlmacenamiento &opciones, long limiteNodos, double &segundos)
+    {
+        auto inicio = chrono::steady_clock::now();
+        ResultadoEntero resultado = resolverModeloEntero(planta, nullptr, limiteNodos, sinCortes, nullptr, opciones);
+        segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+        return resultado;
+    };
+    auto mismoOptimo = [](const ResultadoEntero &a, const ResultadoEntero &b)
+    {
+        return a.estado == LP_OPTIMO && b.estado == LP_OPTIMO &&
+               abs(a.valorObjetivo - b.valorObjetivo) <= 1e-6 * (1.0 + abs(a.valorObjetivo));
+    };
+
+    double segundos = 0.0;
+    ResultadoEntero referencia = medir(OpcionesAlmacenamiento(), 10000000, segundos);
+    cout << "Planta 1 sin cortes, todo en memoria: utilidad $" << referencia.valorObjetivo << ", "
+         << referencia.nodos << " nodos, " << segundos * 1000 << " ms" << endl;
+
+    // Desborde: el mismo árbol con pocos KB de nodos en memoria
+    cout << "\nCon presupuesto de memoria para los nodos abiertos:" << endl;
+    for (size_t kilobytes : {1024, 64})
+    {
+        OpcionesAlmacenamiento opciones;
+        opciones.presupuestoMemoria = kilobytes * 1024;
+        opciones.archivoDesborde = "benchmark_entero.nodos";
+        ResultadoEntero resultado = medir(opciones, 10000000, segundos);
+        cout << "  • " << kilobytes << " KB: utilidad $" << resultado.valorObjetivo << ", " << resultado.nodos
+             << " nodos, " << resultado.desbordes << " desbordes, " << resultado.recargas << " recargas, "
+             << segundos * 1000 << " ms" << endl;
+        if (!mismoOptimo(referencia, resultado))
+            mostrarMensajeError("Con nodos en disco no se llega al mismo óptimo.");
+    }
+
+    // Interrupciones: tramos de 20000 nodos, cada uno retoma el punto del anterior
+    OpcionesAlmacenamiento opciones;
+    opciones.archivoPuntoControl = puntoControl;
+    opciones.presupuestoMemoria = 256 * 1024;
+    ResultadoEntero resultado;
+    int tramos = 0;
+    double total = 0.0;
+    do
+    {
+        resultado = medir(opciones, 20000, segundos);
+        total += segundos;
+        tramos++;
+    } while (resultado.estado == LP_LIMITE_ITERACIONES);
+    cout << "\nEn " << tramos << " ejecuciones de hasta 20000 nodos, reanudando cada una desde el punto de control:"
+         << endl;
+    cout << "  utilidad $" << resultado.valorObjetivo << ", " << resultado.nodos << " nodos en total, " << total * 1000
+         << " ms" << endl;
+    if (!mismoOptimo(referencia, resultado))
+        mostrarMensajeError("Al reanudar no se llega al mismo óptimo.");
+    else
+        mostrarMensajeExito("Mismo óptimo con nodos en disco y con reanudación.");
+    remove(puntoControl.c_str());
+}
@@ -9,7 +9,8 @@
 #include <limits>
 #include <algorithm>
 #include <cmath>
-#include <sstream>
+#include <chrono>
+#include <fstream>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -23,7 +24,9 @@ using namespace std;
 
 // Constructor de la clase SistemaOptimizacion
 SistemaOptimizacion::SistemaOptimizacion()
-    : precioMesa(0.0), precioSilla(0.0), preciosIngresados(false), restriccionesIngresadas(false)
+    : precioMesa(0.0), precioSilla(0.0), preciosIngresados(false), restriccionesIngresadas(false),
+      estadoUltimoCalculo(TRABAJO_COMPLETADO), incumbenteUltimoCalculo(0.0), resultadoPorMostrar(false),
+      limiteTiempoCalculo(60.0), versionModelo(1), versionTrabajoEspeculativo(0), versionSolucionEspeculativa(0)
 {
     // Inicializar restricciones predeterminadas del caso Flair Furniture
     // Estas se pueden modificar en la Opción 2
@@ -36,6 +39,14 @@ void SistemaOptimizacion::ejecutarSistema()
     int opcion;
     bool continuar = true;
 
+    // Ofrecer la sesión guardada en la ejecución anterior
+    if (!archivoSesion.empty() && ifstream(archivoSesion).good() &&
+        solicitarConfirmacion("\nSe encontró una sesión guardada. ¿Desea restaurarla?"))
+    {
+        restaurarSesion();
+        pausarSistema();
+    }
+
     while (continuar)
     {
         try
@@ -47,6 +58,7 @@ void SistemaOptimizacion::ejecutarSistema()
                 if (opcion == 6)
                 {
                     continuar = false;
+                    guardarSesion();
                 }
                 else
                 {
@@ -74,6 +86,12 @@ void SistemaOptimizacion::ejecutarSistema()
 // Mostrar el menú principal
 void SistemaOptimizacion::mostrarMenuPrincipal()
 {
+    TRAZA_AMBITO("menu.mostrar", "menu");
+
+    // Un cálculo que terminó en segundo plano se refleja en el estado
+    recogerResultadoCalculo();
+    recogerCalculoEspeculativo();
+
     limpiarPantalla();
 
     cout << "\n"
@@ -93,7 +111,19 @@ void SistemaOptimizacion::mostrarMenuPrincipal()
     cout << "Estado actual:" << endl;
     cout << "  • Precios: " << (preciosIngresados ? "✓ Configurados" : "✗ No configurados") << endl;
     cout << "  • Restricciones: " << (restriccionesIngresadas ? "✓ Configuradas (" + to_string(restricciones.size()) + ")" : "✗ No configuradas") << endl;
-    cout << "  • Solución: " << (solucion.solucionEncontrada ? "✓ Calculada" : "✗ No calculada") << endl;
+    if (trabajoCalculo)
+    {
+        cout << "  • Solución: ⏳ Calculando en segundo plano ("
+             << trabajoCalculo->getProgreso().iteraciones.load() << " iteraciones)" << endl;
+    }
+    else if (!solucion.solucionEncontrada && haySolucionEspeculativa())
+    {
+        cout << "  • Solución: ✗ No calculada (resultado anticipado listo para la Opción 4)" << endl;
+    }
+    else
+    {
+        cout << "  • Solución: " << (solucion.solucionEncontrada ? "✓ Calculada" : "✗ No calculada") << endl;
+    }
 
     cout << "\n"
          << string(60, '-') << endl;
@@ -103,6 +133,7 @@ void SistemaOptimizacion::mostrarMenuPrincipal()
 // Ejecutar la opción seleccionada
 void SistemaOptimizacion::ejecutarOpcion(int opcion)
 {
+    TRAZA_AMBITO("menu.opcion", "menu");
     switch (opcion)
     {
     case 1:
@@ -157,9 +188,14 @@ void SistemaOptimizacion::ingresarPrecios()
         precioSilla = precioSillaTemp;
         preciosIngresados = true;
 
-        // Resetear solución anterior si existía
+        // Resetear solución anterior si existía (y descartar un cálculo con los precios viejos)
+        cancelarCalculo();
         solucion.solucionEncontrada = false;
 
+        // Empezar a calcular con los precios nuevos mientras el usuario sigue en el menú
+        modeloModificado();
+        iniciarCalculoEspeculativo(false);
+
         // Mostrar confirmación
         cout << "\n"
              << string(50, '-') << endl;
@@ -191,15 +227,32 @@ void SistemaOptimizacion::ingresarRestricciones()
         cin.ignore(numeric_limits<streamsize>::max(), '\n');
 
         restricciones.clear();
+        cancelarCalculo();
+        modeloModificado();
 
         if (opcion == 's' || opcion == 'S')
         {
             // Cargar restricciones predeterminadas del caso Flair
-            restricciones.push_back(Restriccion(4.0, 3.0, 240.0));     // Carpintería: 4x₁ + 3x₂ ≤ 240
-            restricciones.push_back(Restriccion(2.0, 1.0, 100.0));     // Pintura: 2x₁ + x₂ ≤ 100
-            restricciones.push_back(Restriccion(0.0, 1.0, 60.0));      // Límite sillas: x₂ ≤ 60
-            restricciones.push_back(Restriccion(1.0, 0.0, 0.0, ">=")); // No negatividad x₁: x₁ ≥ 0
-            restricciones.push_back(Restriccion(0.0, 1.0, 0.0, ">=")); // No negatividad x₂: x₂ ≥ 0
+            restricciones.push_back(4 * X1 + 3 * X2 <= 240); // Carpintería
+            restricciones.push_back(2 * X1 + X2 <= 100);     // Pintura
+            restricciones.push_back(X2 <= 60);               // Límite sillas
+            restricciones.push_back(X1 >= 0);                // No negatividad x₁
+            restricciones.push_back(X2 >= 0);                // No negatividad x₂
+
+            // Madera: tablones por mueble según el plan de corte de sus piezas
+            cout << "¿Desea limitar la producción por los tablones de madera disponibles? (s/n): ";
+            char opcionMadera;
+            cin >> opcionMadera;
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            if (opcionMadera == 's' || opcionMadera == 'S')
+            {
+                ModeloMadera madera = crearModeloMaderaFlair();
+                madera.tablonesDisponibles = solicitarNumeroReal("Tablones disponibles en el período: ");
+                restricciones.push_back(construirRestriccionMadera(madera));
+            }
+
+            modeloModificado();
+            iniciarCalculoEspeculativo(false);
 
             mostrarMensajeExito("Restricciones del caso Flair Furniture cargadas.");
         }
@@ -233,6 +286,10 @@ void SistemaOptimizacion::ingresarRestricciones()
                 if (validarRestriccion(nuevaRestriccion))
                 {
                     restricciones.push_back(nuevaRestriccion);
+
+                    // Actualizar el resultado anticipado mientras se escribe la siguiente fila
+                    modeloModificado();
+                    iniciarCalculoEspeculativo(true);
                 }
                 else
                 {
@@ -253,6 +310,7 @@ void SistemaOptimizacion::ingresarRestricciones()
     {
         mostrarMensajeError("Error al ingresar restricciones: " + string(e.what()));
         restriccionesIngresadas = false;
+        cancelarCalculo();
     }
 }
 
@@ -292,79 +350,264 @@ void SistemaOptimizacion::mostrarFuncionGanancia()
 // OPCIÓN 4: Calcular solución óptima
 void SistemaOptimizacion::calcularSolucionOptima()
 {
+    TRAZA_AMBITO("calculo.solucionOptima", "calculo");
+
     limpiarPantalla();
     cout << "\n"
          << string(50, '=') << endl;
     cout << "        OPCIÓN 4: CÁLCULO DE SOLUCIÓN ÓPTIMA" << endl;
     cout << string(50, '=') << endl;
 
+    // Si hay un cálculo en segundo plano sin terminar, mostrar su progreso
+    if (trabajoCalculo && !trabajoCalculo->estaTerminado())
+    {
+        mostrarProgresoCalculo();
+
+        if (solicitarConfirmacion("\n¿Desea cancelar el cálculo en curso?"))
+        {
+            trabajoCalculo->cancelar();
+            trabajoCalculo->esperar(chrono::milliseconds(2000));
+            recogerResultadoCalculo();
+            mostrarResultadoCalculo();
+        }
+        return;
+    }
+
+    // Un cálculo que terminó en segundo plano se muestra antes de empezar otro
+    recogerResultadoCalculo();
+    if (resultadoPorMostrar)
+    {
+        mostrarResultadoCalculo();
+        return;
+    }
+
     if (!verificarDatosPrevios())
     {
         return;
     }
 
-    try
+    // Todos los problemas del modelo juntos, antes de lanzar el cálculo
+    DiagnosticoModelo diagnostico = diagnosticarModelo(restricciones, precioMesa, precioSilla);
+    if (!diagnostico.esValido())
+    {
+        mostrarDiagnosticoModelo(diagnostico);
+        return;
+    }
+
+    cout << "\nCalculando solución óptima..." << endl;
+    cout << "Método: Evaluación de puntos extremos" << endl;
+
+    // Usar el resultado anticipado si corresponde a los datos actuales
+    recogerCalculoEspeculativo();
+    if (haySolucionEspeculativa())
     {
-        cout << "\nCalculando solución óptima..." << endl;
-        cout << "Método: Evaluación de puntos extremos" << endl;
+        cout << "(Resultado calculado mientras se ingresaban los datos)" << endl;
+        solucion = solucionEspeculativa;
+        estadoUltimoCalculo = TRABAJO_COMPLETADO;
+        mostrarResultadoCalculo();
+        return;
+    }
 
-        // Encontrar puntos de intersección (vértices del área factible)
-        vector<pair<double, double>> puntosInterseccion = encontrarPuntosInterseccion();
+    if (trabajoEspeculativo && versionTrabajoEspeculativo == versionModelo)
+    {
+        // El cálculo anticipado de estos mismos datos sigue en curso: continuar con él
+        trabajoCalculo = move(trabajoEspeculativo);
+    }
+    else
+    {
+        trabajoEspeculativo.reset();
+        trabajoCalculo.reset(new TrabajoCalculo(obtenerModelo(), limiteTiempoCalculo));
+    }
 
-        if (puntosInterseccion.empty())
+    // Los modelos pequeños terminan casi de inmediato: esperar un momento antes de volver al menú
+    if (!trabajoCalculo->esperar(chrono::milliseconds(300)))
+    {
+        mostrarMensajeInfo("El cálculo continúa en segundo plano.");
+        cout << "Vuelva a la Opción 4 para ver el progreso o cancelarlo." << endl;
+        return;
+    }
+
+    recogerResultadoCalculo();
+    mostrarResultadoCalculo();
+}
+
+// Mostrar el progreso del cálculo en segundo plano
+void SistemaOptimizacion::mostrarProgresoCalculo()
+{
+    const ProgresoCalculo &progreso = trabajoCalculo->getProgreso();
+
+    cout << "\nCálculo en curso (" << formatearNumero(trabajoCalculo->getSegundosTranscurridos(), 1)
+         << " s de " << formatearNumero(limiteTiempoCalculo, 0) << " s permitidos)" << endl;
+    cout << string(40, '-') << endl;
+    cout << "  • Iteraciones: " << progreso.iteraciones.load() << endl;
+
+    double cota = progreso.cotaSuperior.load();
+    cout << "  • Cota superior de la ganancia: "
+         << (isfinite(cota) ? "$" + formatearNumero(cota) : string("sin cota")) << endl;
+    cout << "  • Mejor ganancia encontrada: "
+         << (progreso.hayIncumbente.load() ? "$" + formatearNumero(progreso.incumbente.load()) : string("ninguna todavía"))
+         << endl;
+}
+
+// Copia el resultado de un cálculo terminado y libera su hilo
+void SistemaOptimizacion::recogerResultadoCalculo()
+{
+    if (!trabajoCalculo || !trabajoCalculo->estaTerminado())
+    {
+        return;
+    }
+
+    estadoUltimoCalculo = trabajoCalculo->getEstado();
+    errorUltimoCalculo = trabajoCalculo->getMensajeError();
+    incumbenteUltimoCalculo = trabajoCalculo->getProgreso().hayIncumbente.load()
+                                  ? trabajoCalculo->getProgreso().incumbente.load()
+                                  : numeric_limits<double>::quiet_NaN();
+
+    if (estadoUltimoCalculo == TRABAJO_COMPLETADO)
+    {
+        solucion = trabajoCalculo->getResultado();
+    }
+    else
+    {
+        solucion.solucionEncontrada = false;
+    }
+
+    resultadoPorMostrar = true;
+    trabajoCalculo.reset();
+}
+
+// Mostrar el resultado del último cálculo recogido
+void SistemaOptimizacion::mostrarResultadoCalculo()
+{
+    resultadoPorMostrar = false;
+
+    switch (estadoUltimoCalculo)
+    {
+    case TRABAJO_CANCELADO:
+        mostrarMensajeError("El cálculo fue cancelado.");
+        return;
+    case TRABAJO_TIEMPO_AGOTADO:
+        mostrarMensajeError("Se agotó el límite de tiempo de " + formatearNumero(limiteTiempoCalculo, 0) + " s.");
+        if (!isnan(incumbenteUltimoCalculo))
         {
-            throw runtime_error("No se encontraron puntos factibles. Verifique las restricciones.");
+            cout << "Mejor ganancia encontrada (sin garantía de óptimo): $"
+                 << formatearNumero(incumbenteUltimoCalculo) << " USD" << endl;
         }
+        return;
+    case TRABAJO_FALLIDO:
+        mostrarMensajeError("Error en el cálculo: " + errorUltimoCalculo);
+        return;
+    default:
+        break;
+    }
+
+    if (!solucion.solucionEncontrada)
+    {
+        mostrarMensajeError("Error en el cálculo: No se encontraron puntos factibles. Verifique las restricciones.");
+        return;
+    }
 
-        // Evaluar función objetivo en cada punto factible
-        double mejorGanancia = -numeric_limits<double>::infinity();
-        double mejorX1 = 0, mejorX2 = 0;
+    // Los modelos pequeños muestran todos los puntos evaluados, como en el cálculo manual
+    if (restricciones.size() <= 20)
+    {
+        arenaCalculo.reiniciar();
+        pmr::vector<pair<double, double>> puntosInterseccion = encontrarPuntosInterseccion();
 
-        cout << "\nEvaluando puntos candidatos:" << endl;
-        cout << string(40, '-') << endl;
+        EscritorReporte escritor(cout);
+        escritor.escribir("\nEvaluando puntos candidatos:\n");
+        escritor.escribirRepetido('-', 40);
+        escritor.nuevaLinea();
 
         for (const auto &punto : puntosInterseccion)
         {
-            double x1 = punto.first;
-            double x2 = punto.second;
-
-            if (puntoEsFactible(x1, x2))
+            if (puntoEsFactible(punto.first, punto.second))
             {
-                double ganancia = evaluarFuncionObjetivo(x1, x2);
-
-                cout << "Punto (" << formatearNumero(x1) << ", " << formatearNumero(x2)
-                     << ") → Z = $" << formatearNumero(ganancia) << endl;
-
-                if (ganancia > mejorGanancia)
-                {
-                    mejorGanancia = ganancia;
-                    mejorX1 = x1;
-                    mejorX2 = x2;
-                }
+                escritor.escribir("Punto (");
+                escritor.escribirNumero(punto.first);
+                escritor.escribir(", ");
+                escritor.escribirNumero(punto.second);
+                escritor.escribir(") → Z = $");
+                escritor.escribirNumero(evaluarFuncionObjetivo(punto.first, punto.second));
+                escritor.nuevaLinea();
             }
         }
+    }
 
-        // Guardar solución óptima
-        solucion.x1 = mejorX1;
-        solucion.x2 = mejorX2;
-        solucion.gananciaMaxima = mejorGanancia;
-        solucion.solucionEncontrada = true;
+    // Mostrar resultado
+    cout << "\n"
+         << string(50, '=') << endl;
+    mostrarMensajeExito("SOLUCIÓN ÓPTIMA ENCONTRADA:");
+    cout << string(50, '=') << endl;
+    cout << "  • Número de mesas (x₁): " << formatearNumero(solucion.x1, 0) << " unidades" << endl;
+    cout << "  • Número de sillas (x₂): " << formatearNumero(solucion.x2, 0) << " unidades" << endl;
+    cout << "  • Ganancia máxima: $" << formatearNumero(solucion.gananciaMaxima) << " USD" << endl;
+    cout << string(50, '=') << endl;
+    mostrarPlanesAlternativos(obtenerModelo(), solucion);
+}
 
-        // Mostrar resultado
-        cout << "\n"
-             << string(50, '=') << endl;
-        mostrarMensajeExito("SOLUCIÓN ÓPTIMA ENCONTRADA:");
-        cout << string(50, '=') << endl;
-        cout << "  • Número de mesas (x₁): " << formatearNumero(solucion.x1, 0) << " unidades" << endl;
-        cout << "  • Número de sillas (x₂): " << formatearNumero(solucion.x2, 0) << " unidades" << endl;
-        cout << "  • Ganancia máxima: $" << formatearNumero(solucion.gananciaMaxima) << " USD" << endl;
-        cout << string(50, '=') << endl;
+// Registra un cambio en los datos: los resultados anticipados anteriores quedan obsoletos
+void SistemaOptimizacion::modeloModificado()
+{
+    versionModelo++;
+}
+
+/**
+ * Actualiza el resultado anticipado para la versión actual del modelo.
+ * Si solo se agregó una restricción y el óptimo anterior la cumple, se
+ * actualiza en el momento; si no, se lanza un cálculo en segundo plano.
+ * @param restriccionAgregada true si el único cambio fue agregar la última restricción
+ */
+void SistemaOptimizacion::iniciarCalculoEspeculativo(bool restriccionAgregada)
+{
+    if (!preciosIngresados || restricciones.empty())
+    {
+        return;
     }
-    catch (const exception &e)
+
+    recogerCalculoEspeculativo();
+
+    // Un modelo que la verificación rechaza no vale la pena calcularlo por adelantado
+    if (!diagnosticarModelo(restricciones, precioMesa, precioSilla, true).esValido())
     {
-        mostrarMensajeError("Error en el cálculo: " + string(e.what()));
-        solucion.solucionEncontrada = false;
+        trabajoEspeculativo.reset();
+        return;
     }
+
+    if (restriccionAgregada && versionSolucionEspeculativa == versionModelo - 1 &&
+        actualizarSolucionIncremental(restricciones, precioMesa, precioSilla, solucionEspeculativa))
+    {
+        versionSolucionEspeculativa = versionModelo;
+        trabajoEspeculativo.reset();
+        return;
+    }
+
+    // Un cálculo de una versión anterior ya no sirve: se cancela y se reemplaza
+    trabajoEspeculativo.reset(new TrabajoCalculo(obtenerModelo(), limiteTiempoCalculo));
+    versionTrabajoEspeculativo = versionModelo;
+}
+
+// Guarda el resultado del cálculo anticipado si terminó y sigue vigente
+void SistemaOptimizacion::recogerCalculoEspeculativo()
+{
+    if (!trabajoEspeculativo || !trabajoEspeculativo->estaTerminado())
+    {
+        return;
+    }
+
+    if (versionTrabajoEspeculativo == versionModelo && trabajoEspeculativo->getEstado() == TRABAJO_COMPLETADO)
+    {
+        solucionEspeculativa = trabajoEspeculativo->getResultado();
+        versionSolucionEspeculativa = versionTrabajoEspeculativo;
+    }
+
+    trabajoEspeculativo.reset();
+}
+
+// Descarta el cálculo en curso o pendiente de mostrar (los datos cambiaron)
+void SistemaOptimizacion::cancelarCalculo()
+{
+    trabajoCalculo.reset();
+    resultadoPorMostrar = false;
 }
 
 // OPCIÓN 5: Mostrar solución gráfica (placeholder - se implementará en graficos.cpp)
@@ -398,9 +641,115 @@ void SistemaOptimizacion::mostrarSolucionGrafica()
 }
 
 // Implementación completa de funciones auxiliares para cálculos
-vector<pair<double, double>> SistemaOptimizacion::encontrarPuntosInterseccion()
+pmr::vector<pair<double, double>> SistemaOptimizacion::encontrarPuntosInterseccion()
 {
-    vector<pair<double, double>> puntos;
+    pmr::vector<pair<double, double>> puntos(&arenaCalculo);
+    calcularPuntosCandidatos(restricciones, puntos);
+    return puntos;
+}
+
+pair<double, double> SistemaOptimizacion::interseccionRectas(const Restriccion &r1, const Restriccion &r2)
+{
+    return calcularInterseccion(r1, r2);
+}
+
+ModeloProduccion SistemaOptimizacion::obtenerModelo() const
+{
+    ModeloProduccion modelo;
+    modelo.precioMesa = precioMesa;
+    modelo.precioSilla = precioSilla;
+    modelo.restricciones = restricciones;
+    return modelo;
+}
+
+/**
+ * Guarda precios, restricciones y la última solución en la instantánea de la sesión
+ * @return true si se guardó (o no había nada que guardar)
+ */
+bool SistemaOptimizacion::guardarSesion()
+{
+    if (archivoSesion.empty() || (!preciosIngresados && !restriccionesIngresadas))
+    {
+        return true;
+    }
+
+    uint32_t banderas = 0;
+    if (preciosIngresados)
+        banderas |= INSTANTANEA_PRECIOS;
+    if (restriccionesIngresadas)
+        banderas |= INSTANTANEA_RESTRICCIONES;
+    if (solucion.solucionEncontrada)
+        banderas |= INSTANTANEA_SOLUCION;
+
+    try
+    {
+        guardarInstantanea(archivoSesion, obtenerModelo(), solucion, banderas);
+        mostrarMensajeInfo("Sesión guardada en " + archivoSesion);
+        return true;
+    }
+    catch (const exception &e)
+    {
+        mostrarMensajeError("No se pudo guardar la sesión: " + string(e.what()));
+        return false;
+    }
+}
+
+/**
+ * Restaura el estado guardado por guardarSesion(). Es O(n) en el número de
+ * restricciones: se verifica la suma de todos los registros y se copian a la
+ * sesión, que necesita un vector editable. Los vértices guardados no se leen
+ * aquí; solo los usa --ver-instantanea
+ * @return true si la instantánea era válida y se cargó
+ */
+bool SistemaOptimizacion::restaurarSesion()
+{
+    try
+    {
+        InstantaneaMapeada instantanea(archivoSesion);
+        ModeloProduccion modelo = instantanea.obtenerModelo();
+
+        cancelarCalculo();
+        trabajoEspeculativo.reset();
+        precioMesa = modelo.precioMesa;
+        precioSilla = modelo.precioSilla;
+        restricciones = move(modelo.restricciones);
+        preciosIngresados = instantanea.tiene(INSTANTANEA_PRECIOS);
+        restriccionesIngresadas = instantanea.tiene(INSTANTANEA_RESTRICCIONES) && !restricciones.empty();
+        solucion = instantanea.obtenerSolucion();
+        modeloModificado();
+
+        // La solución guardada sirve como resultado anticipado de la Opción 4
+        if (solucion.solucionEncontrada)
+        {
+            solucionEspeculativa = solucion;
+            versionSolucionEspeculativa = versionModelo;
+        }
+        else
+        {
+            iniciarCalculoEspeculativo(false);
+        }
+
+        mostrarMensajeExito("Sesión restaurada (" + to_string(restricciones.size()) + " restricciones).");
+        if (preciosIngresados && restriccionesIngresadas)
+        {
+            mostrarDiagnosticoModelo(diagnosticarModelo(restricciones, precioMesa, precioSilla));
+        }
+        return true;
+    }
+    catch (const exception &e)
+    {
+        mostrarMensajeError("No se pudo restaurar la sesión: " + string(e.what()));
+        return false;
+    }
+}
+
+// Calcula los puntos candidatos a vértice del área factible.
+// El vector usa la memoria con la que fue creado (normalmente una arena del cálculo).
+void calcularPuntosCandidatos(const vector<Restriccion> &restricciones, pmr::vector<pair<double, double>> &puntos,
+                              const TokenCancelacion *token, ProgresoCalculo *progreso)
+{
+    TRAZA_AMBITO("calculo.puntosCandidatos", "calculo");
+    puntos.clear();
 
     // Agregar punto origen (0,0)
     puntos.push_back(make_pair(0.0, 0.0));
@@ -435,13 +784,22 @@ vector<pair<double, double>> SistemaOptimizacion::encontrarPuntosInterseccion()
     // Encontrar intersecciones entre pares de restricciones
     for (size_t i = 0; i < restricciones.size(); i++)
     {
+        if (token)
+        {
+            token->verificar();
+        }
+        if (progreso)
+        {
+            progreso->iteraciones.fetch_add(restricciones.size() - i - 1, memory_order_relaxed);
+        }
+
         for (size_t j = i + 1; j < restricciones.size(); j++)
         {
             if (restricciones[i].operador == "<=" || restricciones[i].operador == "=")
             {
                 if (restricciones[j].operador == "<=" || restricciones[j].operador == "=")
                 {
-                    pair<double, double> interseccion = interseccionRectas(restricciones[i], restricciones[j]);
+                    pair<double, double> interseccion = calcularInterseccion(restricciones[i], restricciones[j]);
                     if (interseccion.first >= -1e-6 && interseccion.second >= -1e-6)
                     {
                         puntos.push_back(interseccion);
@@ -459,11 +817,9 @@ vector<pair<double, double>> SistemaOptimizacion::encontrarPuntosInterseccion()
                             return abs(a.first - b.first) < 1e-6 && abs(a.second - b.second) < 1e-6;
                         }),
                  puntos.end());
-
-    return puntos;
 }
 
-pair<double, double> SistemaOptimizacion::interseccionRectas(const Restriccion &r1, const Restriccion &r2)
+pair<double, double> calcularInterseccion(const Restriccion &r1, const Restriccion &r2)
 {
     // Resolver sistema: a1*x1 + b1*x2 = c1, a2*x1 + b2*x2 = c2
     double a1 = r1.coeficienteX1, b1 = r1.coeficienteX2, c1 = r1.valorConstante;
@@ -483,6 +839,219 @@ pair<double, double> SistemaOptimizacion::interseccionRectas(const Restriccion &
     return make_pair(x1, x2);
 }
 
+bool esPuntoFactible(const vector<Restriccion> &restricciones, double x1, double x2)
+{
+    for (const auto &restriccion : restricciones)
+    {
+        double valorIzquierdo = restriccion.coeficienteX1 * x1 + restriccion.coeficienteX2 * x2;
+
+        if (restriccion.operador == "<=")
+        {
+            if (valorIzquierdo > restriccion.valorConstante + 1e-6)
+                return false;
+        }
+        else if (restriccion.operador == ">=")
+        {
+            if (valorIzquierdo < restriccion.valorConstante - 1e-6)
+                return false;
+        }
+        else if (restriccion.operador == "=")
+        {
+            if (abs(valorIzquierdo - restriccion.valorConstante) > 1e-6)
+                return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Actualiza una solución cuando se agrega una restricción al final del vector.
+ * Si el óptimo anterior cumple la nueva restricción, sigue siendo el mejor de los
+ * puntos anteriores; solo hace falta evaluar los puntos nuevos que genera la
+ * restricción agregada (O(m²) en lugar de O(m³)).
+ * @return false si el óptimo anterior no cumple la restricción y hay que recalcular
+ */
+bool actualizarSolucionIncremental(const vector<Restriccion> &restricciones,
+                                   double precioMesa, double precioSilla, SolucionOptima &solucion)
+{
+    if (restricciones.empty() || !solucion.solucionEncontrada)
+    {
+        return false;
+    }
+
+    const Restriccion &nueva = restricciones.back();
+    if (!esPuntoFactible(vector<Restriccion>(1, nueva), solucion.x1, solucion.x2))
+    {
+        return false;
+    }
+
+    if (nueva.operador != "<=" && nueva.operador != "=")
+    {
+        return true; // Las restricciones ">=" no generan puntos candidatos nuevos
+    }
+
+    auto evaluarCandidato = [&](double x1, double x2)
+    {
+        if (esPuntoFactible(restricciones, x1, x2))
+        {
+            double ganancia = precioMesa * x1 + precioSilla * x2;
+            if (ganancia > solucion.gananciaMaxima)
+            {
+                solucion.x1 = x1;
+                solucion.x2 = x2;
+                solucion.gananciaMaxima = ganancia;
+            }
+        }
+    };
+
+    // Intersecciones de la nueva restricción con los ejes
+    if (nueva.coeficienteX1 != 0 && nueva.valorConstante / nueva.coeficienteX1 >= 0)
+    {
+        evaluarCandidato(nueva.valorConstante / nueva.coeficienteX1, 0.0);
+    }
+    if (nueva.coeficienteX2 != 0 && nueva.valorConstante / nueva.coeficienteX2 >= 0)
+    {
+        evaluarCandidato(0.0, nueva.valorConstante / nueva.coeficienteX2);
+    }
+
+    // Intersecciones con las restricciones anteriores
+    for (size_t i = 0; i + 1 < restricciones.size(); i++)
+    {
+        if (restricciones[i].operador == "<=" || restricciones[i].operador == "=")
+        {
+            pair<double, double> interseccion = calcularInterseccion(restricciones[i], nueva);
+            if (interseccion.first >= -1e-6 && interseccion.second >= -1e-6)
+            {
+                evaluarCandidato(interseccion.first, interseccion.second);
+            }
+        }
+    }
+
+    return true;
+}
+
+// Cota superior de la ganancia para x₁, x₂ ≥ 0: cada restricción "<=" con ambos
+// coeficientes positivos limita p1·x1 + p2·x2 a c·max(p1/a, p2/b).
+double calcularCotaSuperior(const vector<Restriccion> &restricciones, double precioMesa, double precioSilla)
+{
+    double cota = numeric_limits<double>::infinity();
+    for (const auto &r : restricciones)
+    {
+        if (r.operador != ">=" && r.coeficienteX1 > 0 && r.coeficienteX2 > 0 && r.valorConstante >= 0)
+        {
+            double razon = max(precioMesa / r.coeficienteX1, precioSilla / r.coeficienteX2);
+            cota = min(cota, max(0.0, razon) * r.valorConstante);
+        }
+    }
+    return cota;
+}
+
+// Producto cruz de (b - a) y (c - a): positivo si a, b, c giran en sentido antihorario
+static double giro(const pair<double, double> &a, const pair<double, double> &b, const pair<double, double> &c)
+{
+    return (b.first - a.first) * (c.second - a.second) - (b.second - a.second) * (c.first - a.first);
+}
+
+/**
+ * Calcula el polígono factible como envolvente convexa (cadena monótona) de
+ * los puntos candidatos factibles, en sentido antihorario. Los puntos alineados
+ * se descartan, así cada vértice es un plan distinto.
+ */
+vector<pair<double, double>> calcularPoligonoFactible(const vector<Restriccion> &restricciones)
+{
+    pmr::vector<pair<double, double>> candidatos;
+    calcularPuntosCandidatos(restricciones, candidatos);
+
+    vector<pair<double, double>> puntos;
+    for (const auto &punto : candidatos)
+    {
+        if (esPuntoFactible(restricciones, punto.first, punto.second))
+            puntos.push_back(punto);
+    }
+    sort(puntos.begin(), puntos.end());
+    puntos.erase(unique(puntos.begin(), puntos.end(),
+                        [](const pair<double, double> &a, const pair<double, double> &b)
+                        { return abs(a.first - b.first) < 1e-9 && abs(a.second - b.second) < 1e-9; }),
+                 puntos.end());
+
+    if (puntos.size() < 3)
+    {
+        return puntos;
+    }
+
+    // Cadena inferior y luego superior; el último punto de cada una inicia la otra
+    vector<pair<double, double>> vertices(2 * puntos.size());
+    size_t k = 0;
+    for (size_t i = 0; i < puntos.size(); i++)
+    {
+        while (k >= 2 && giro(vertices[k - 2], vertices[k - 1], puntos[i]) <= 1e-12)
+            k--;
+        vertices[k++] = puntos[i];
+    }
+    for (size_t i = puntos.size() - 1, inferior = k + 1; i > 0; i--)
+    {
+        while (k >= inferior && giro(vertices[k - 2], vertices[k - 1], puntos[i - 1]) <= 1e-12)
+            k--;
+        vertices[k++] = puntos[i - 1];
+    }
+    vertices.resize(k - 1);
+    return vertices;
+}
+
+// Resuelve el modelo por evaluación de puntos extremos sin imprimir nada.
+// Si no hay puntos factibles, la solución se devuelve con solucionEncontrada = false.
+SolucionOptima resolverPuntosExtremos(const vector<Restriccion> &restricciones,
+                                      double precioMesa, double precioSilla,
+                                      pmr::memory_resource *memoria,
+                                      const TokenCancelacion *token, ProgresoCalculo *progreso)
+{
+    TRAZA_AMBITO("calculo.puntosExtremos", "calculo");
+    SolucionOptima resultado;
+    pmr::vector<pair<double, double>> puntos(memoria);
+    puntos.reserve(1 + 2 * restricciones.size() + restricciones.size() * restricciones.size() / 2);
+
+    if (progreso)
+    {
+        progreso->cotaSuperior = calcularCotaSuperior(restricciones, precioMesa, precioSilla);
+    }
+    calcularPuntosCandidatos(restricciones, puntos, token, progreso);
+
+    size_t evaluados = 0;
+    for (const auto &punto : puntos)
+    {
+        // Revisar la cancelación cada cierto número de puntos (consultar el reloj tiene costo)
+        if (token && (++evaluados % 64) == 0)
+        {
+            token->verificar();
+        }
+        if (progreso)
+        {
+            progreso->iteraciones.fetch_add(1, memory_order_relaxed);
+        }
+
+        if (esPuntoFactible(restricciones, punto.first, punto.second))
+        {
+            double ganancia = precioMesa * punto.first + precioSilla * punto.second;
+
+            if (!resultado.solucionEncontrada || ganancia > resultado.gananciaMaxima)
+            {
+                resultado.x1 = punto.first;
+                resultado.x2 = punto.second;
+                resultado.gananciaMaxima = ganancia;
+                resultado.solucionEncontrada = true;
+
+                if (progreso)
+                {
+                    progreso->incumbente = ganancia;
+                    progreso->hayIncumbente = true;
+                }
+            }
+        }
+    }
+
+    return resultado;
+}
+
 // Funciones auxiliares para validación y cálculos
 bool SistemaOptimizacion::validarPrecio(double precio)
 {
@@ -527,31 +1096,15 @@ void SistemaOptimizacion::mostrarRestricciones()
         return;
     }
 
-    cout << "\nRestricciones registradas:" << endl;
+    EscritorReporte escritor(cout);
+    escritor.escribir("\nRestricciones registradas:\n");
     for (size_t i = 0; i < restricciones.size(); i++)
     {
-        const auto &r = restricciones[i];
-        cout << "  " << (i + 1) << ". ";
-
-        if (r.coeficienteX1 != 0)
-        {
-            cout << formatearNumero(r.coeficienteX1) << "x₁";
-        }
-
-        if (r.coeficienteX2 != 0)
-        {
-            if (r.coeficienteX1 != 0)
-            {
-                cout << (r.coeficienteX2 > 0 ? " + " : " - ");
-                cout << formatearNumero(abs(r.coeficienteX2)) << "x₂";
-            }
-            else
-            {
-                cout << formatearNumero(r.coeficienteX2) << "x₂";
-            }
-        }
-
-        cout << " " << r.operador << " " << formatearNumero(r.valorConstante) << endl;
+        escritor.escribir("  ");
+        escritor.escribirEntero(static_cast<long long>(i + 1));
+        escritor.escribir(". ");
+        escribirExpresionRestriccion(escritor, restricciones[i]);
+        escritor.nuevaLinea();
     }
 }
 
@@ -562,27 +1115,7 @@ double SistemaOptimizacion::evaluarFuncionObjetivo(double x1, double x2)
 
 bool SistemaOptimizacion::puntoEsFactible(double x1, double x2)
 {
-    for (const auto &restriccion : restricciones)
-    {
-        double valorIzquierdo = restriccion.coeficienteX1 * x1 + restriccion.coeficienteX2 * x2;
-
-        if (restriccion.operador == "<=")
-        {
-            if (valorIzquierdo > restriccion.valorConstante + 1e-6)
-                return false;
-        }
-        else if (restriccion.operador == ">=")
-        {
-            if (valorIzquierdo < restriccion.valorConstante - 1e-6)
-                return false;
-        }
-        else if (restriccion.operador == "=")
-        {
-            if (abs(valorIzquierdo - restriccion.valorConstante) > 1e-6)
-                return false;
-        }
-    }
-    return true;
+    return esPuntoFactible(restricciones, x1, x2);
 }
 
 // Funciones utilitarias
@@ -604,9 +1137,9 @@ void SistemaOptimizacion::pausarSistema()
 
 string SistemaOptimizacion::formatearNumero(double numero, int decimales)
 {
-    ostringstream stream;
-    stream << fixed << setprecision(decimales) << numero;
-    return stream.str();
+    // to_chars en un buffer local: los números cortos caben en el string sin reservar memoria
+    char buffer[512];
+    return string(buffer, formatearDecimal(buffer, sizeof(buffer), numero, decimales));
 }
 
 bool SistemaOptimizacion::validarEntradaMenu(int &opcion)
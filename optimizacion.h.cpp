@@ -6,6 +6,22 @@
 #include <string>
 #include <iomanip>
 #include <stdexcept>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <unordered_map>
+#include <memory>
+#include <exception>
+#include <memory_resource>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+#include <array>
+#include <type_traits>
 
 // Estructura para representar una restricción lineal
 struct Restriccion
@@ -32,6 +48,137 @@ struct SolucionOptima
     SolucionOptima() : x1(0), x2(0), gananciaMaxima(0), solucionEncontrada(false) {}
 };
 
+// Estructura con los datos de un modelo de producción (sin estado de interfaz)
+struct ModeloProduccion
+{
+    double precioMesa;                      // Precio de venta por mesa (p1)
+    double precioSilla;                     // Precio de venta por silla (p2)
+    std::vector<Restriccion> restricciones; // Restricciones del modelo
+
+    // Constructor
+    ModeloProduccion() : precioMesa(0.0), precioSilla(0.0) {}
+};
+
+// Arena de memoria monótona para los temporales de cada cálculo.
+// Las asignaciones solo avanzan un puntero; liberar no hace nada y
+// reiniciar() deja la arena vacía en O(1) conservando los bloques ya reservados.
+class ArenaMonotona : public std::pmr::memory_resource
+{
+private:
+    struct Bloque
+    {
+        char *datos;
+        size_t capacidad;
+    };
+
+    std::vector<Bloque> bloques;         // Bloques reservados (se conservan entre cálculos)
+    size_t bloqueActual;                 // Bloque donde se está asignando
+    size_t desplazamiento;               // Bytes usados del bloque actual
+    size_t tamanoInicial;                // Tamaño del primer bloque
+    std::pmr::memory_resource *superior; // Recurso del que se obtienen los bloques
+
+protected:
+    void *do_allocate(size_t bytes, size_t alineacion) override;
+    void do_deallocate(void *, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource &otro) const noexcept override { return this == &otro; }
+
+public:
+    // Constructor
+    explicit ArenaMonotona(size_t tamanoInicial = 16 * 1024,
+                           std::pmr::memory_resource *superior = std::pmr::new_delete_resource());
+    ~ArenaMonotona();
+
+    ArenaMonotona(const ArenaMonotona &) = delete;
+    ArenaMonotona &operator=(const ArenaMonotona &) = delete;
+
+    // Descarta todo lo asignado desde el último reinicio (O(1))
+    void reiniciar()
+    {
+        bloqueActual = 0;
+        desplazamiento = 0;
+    }
+
+    size_t getBytesReservados() const;
+};
+
+// Recurso que cuenta las asignaciones que pasan por él y las delega al heap
+// (se pone debajo de una arena o de un contenedor pmr para medirlos)
+class ContadorAsignaciones : public std::pmr::memory_resource
+{
+public:
+    size_t asignaciones = 0;
+
+protected:
+    void *do_allocate(size_t bytes, size_t alineacion) override
+    {
+        asignaciones++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alineacion);
+    }
+    void do_deallocate(void *p, size_t bytes, size_t alineacion) override
+    {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alineacion);
+    }
+    bool do_is_equal(const std::pmr::memory_resource &otro) const noexcept override { return this == &otro; }
+};
+
+// Excepción lanzada cuando un cálculo se detiene antes de terminar
+class CalculoInterrumpido : public std::runtime_error
+{
+private:
+    bool porTiempo; // true si se agotó el límite de tiempo, false si se canceló
+
+public:
+    // Constructor
+    CalculoInterrumpido(const std::string &mensaje, bool porTiempo)
+        : std::runtime_error(mensaje), porTiempo(porTiempo) {}
+    bool fuePorTiempo() const { return porTiempo; }
+};
+
+// Token de cancelación compartido entre el menú y el hilo de cálculo
+class TokenCancelacion
+{
+private:
+    std::atomic<bool> cancelado;                // Se pidió detener el cálculo
+    std::chrono::steady_clock::time_point limite; // Momento máximo de finalización
+    bool tieneLimite;                           // Si hay límite de tiempo
+
+public:
+    // Constructor
+    TokenCancelacion() : cancelado(false), tieneLimite(false) {}
+
+    void cancelar() { cancelado = true; }
+    bool fueCancelado() const { return cancelado.load(); }
+    void establecerLimite(double segundos);
+    bool tiempoAgotado() const;
+
+    // Lanza CalculoInterrumpido si se pidió cancelar o si se agotó el tiempo
+    void verificar() const;
+};
+
+// Progreso de un cálculo; se escribe desde el hilo de cálculo y se lee desde el menú
+struct ProgresoCalculo
+{
+    std::atomic<unsigned long long> iteraciones; // Puntos y pares de restricciones procesados
+    std::atomic<double> cotaSuperior;            // Cota superior conocida de la ganancia
+    std::atomic<double> incumbente;              // Mejor ganancia factible encontrada
+    std::atomic<bool> hayIncumbente;             // Si ya se encontró algún punto factible
+
+    // Constructor
+    ProgresoCalculo();
+};
+
+// Estados de un cálculo en segundo plano
+enum EstadoTrabajo
+{
+    TRABAJO_EN_CURSO,
+    TRABAJO_COMPLETADO,
+    TRABAJO_CANCELADO,
+    TRABAJO_TIEMPO_AGOTADO,
+    TRABAJO_FALLIDO
+};
+
+class TrabajoCalculo;
+
 // Clase principal para el sistema de optimización
 class SistemaOptimizacion
 {
@@ -42,6 +189,19 @@ private:
     SolucionOptima solucion;                // Solución óptima calculada
     bool preciosIngresados;                 // Flag para verificar si se ingresaron precios
     bool restriccionesIngresadas;           // Flag para verificar si se ingresaron restricciones
+    ArenaMonotona arenaCalculo;             // Memoria temporal de cada cálculo
+    std::unique_ptr<TrabajoCalculo> trabajoCalculo; // Cálculo en segundo plano (Opción 4)
+    EstadoTrabajo estadoUltimoCalculo;      // Cómo terminó el último cálculo recogido
+    std::string errorUltimoCalculo;         // Mensaje si el último cálculo falló
+    double incumbenteUltimoCalculo;         // Mejor ganancia hallada si el cálculo se interrumpió
+    bool resultadoPorMostrar;               // Hay un resultado recogido que aún no se mostró
+    double limiteTiempoCalculo;             // Límite de tiempo del cálculo en segundos
+    unsigned long long versionModelo;       // Aumenta con cada cambio de precios o restricciones
+    std::unique_ptr<TrabajoCalculo> trabajoEspeculativo; // Cálculo anticipado mientras se ingresan datos
+    unsigned long long versionTrabajoEspeculativo;       // Versión del modelo que resuelve ese trabajo
+    SolucionOptima solucionEspeculativa;    // Último resultado anticipado
+    unsigned long long versionSolucionEspeculativa;      // Versión del modelo de ese resultado (0 = ninguno)
+    std::string archivoSesion;              // Instantánea que se restaura al iniciar y se guarda al salir
 
 public:
     // Constructor
@@ -68,11 +228,24 @@ public:
     void calcularSolucionOptima();
     bool verificarDatosPrevios();
 
+    // Cálculo en segundo plano de la Opción 4
+    void mostrarProgresoCalculo();
+    void recogerResultadoCalculo();
+    void mostrarResultadoCalculo();
+    void cancelarCalculo();
+    void setLimiteTiempoCalculo(double segundos) { limiteTiempoCalculo = segundos; }
+
+    // Cálculo anticipado mientras se ingresan precios y restricciones
+    void modeloModificado();
+    void iniciarCalculoEspeculativo(bool restriccionAgregada);
+    void recogerCalculoEspeculativo();
+    bool haySolucionEspeculativa() const { return versionSolucionEspeculativa == versionModelo; }
+
     // Opción 5: Mostrar solución gráfica
     void mostrarSolucionGrafica();
 
     // Funciones auxiliares para el cálculo
-    std::vector<std::pair<double, double>> encontrarPuntosInterseccion();
+    std::pmr::vector<std::pair<double, double>> encontrarPuntosInterseccion();
     std::pair<double, double> interseccionRectas(const Restriccion &r1, const Restriccion &r2);
     bool puntoEsFactible(double x1, double x2);
     double evaluarFuncionObjetivo(double x1, double x2);
@@ -91,12 +264,2075 @@ public:
     double getPrecioSilla() const { return precioSilla; }
     const std::vector<Restriccion> &getRestricciones() const { return restricciones; }
     const SolucionOptima &getSolucion() const { return solucion; }
+    ModeloProduccion obtenerModelo() const;
+
+    // Sesión guardada entre ejecuciones (instantánea binaria)
+    void setArchivoSesion(const std::string &ruta) { archivoSesion = ruta; }
+    bool guardarSesion();
+    bool restaurarSesion();
+};
+
+// Funciones del motor de cálculo: no usan estado compartido y son seguras para hilos
+void calcularPuntosCandidatos(const std::vector<Restriccion> &restricciones,
+                              std::pmr::vector<std::pair<double, double>> &puntos,
+                              const TokenCancelacion *token = nullptr,
+                              ProgresoCalculo *progreso = nullptr);
+std::pair<double, double> calcularInterseccion(const Restriccion &r1, const Restriccion &r2);
+bool esPuntoFactible(const std::vector<Restriccion> &restricciones, double x1, double x2);
+double calcularCotaSuperior(const std::vector<Restriccion> &restricciones, double precioMesa, double precioSilla);
+bool actualizarSolucionIncremental(const std::vector<Restriccion> &restricciones,
+                                   double precioMesa, double precioSilla, SolucionOptima &solucion);
+std::vector<std::pair<double, double>> calcularPoligonoFactible(const std::vector<Restriccion> &restricciones);
+SolucionOptima resolverPuntosExtremos(const std::vector<Restriccion> &restricciones,
+                                      double precioMesa, double precioSilla,
+                                      std::pmr::memory_resource *memoria,
+                                      const TokenCancelacion *token = nullptr,
+                                      ProgresoCalculo *progreso = nullptr);
+
+// Cálculo de la solución óptima en un hilo propio, cancelable y con límite de tiempo
+class TrabajoCalculo
+{
+private:
+    ModeloProduccion modelo;  // Copia del modelo: el menú puede seguir modificando el suyo
+    TokenCancelacion token;
+    ProgresoCalculo progreso;
+    std::atomic<int> estado;  // Valor de EstadoTrabajo
+    SolucionOptima resultado; // Válido cuando estado == TRABAJO_COMPLETADO
+    std::string mensajeError; // Válido cuando estado == TRABAJO_FALLIDO
+    std::chrono::steady_clock::time_point inicio;
+    std::mutex mtx;
+    std::condition_variable cvTerminado;
+    std::thread hilo;
+
+    void ejecutar();
+
+public:
+    // Constructor: lanza el cálculo inmediatamente
+    TrabajoCalculo(const ModeloProduccion &modelo, double limiteSegundos);
+    ~TrabajoCalculo();
+
+    TrabajoCalculo(const TrabajoCalculo &) = delete;
+    TrabajoCalculo &operator=(const TrabajoCalculo &) = delete;
+
+    void cancelar() { token.cancelar(); }
+    bool esperar(std::chrono::milliseconds tiempoMaximo); // true si terminó a tiempo
+    EstadoTrabajo getEstado() const { return static_cast<EstadoTrabajo>(estado.load()); }
+    bool estaTerminado() const { return getEstado() != TRABAJO_EN_CURSO; }
+    const ProgresoCalculo &getProgreso() const { return progreso; }
+    double getSegundosTranscurridos() const;
+    const SolucionOptima &getResultado() const { return resultado; }
+    const std::string &getMensajeError() const { return mensajeError; }
+};
+
+// Planificador de tareas con robo de trabajo (work-stealing).
+// Cada hilo tiene su propia cola: toma tareas del final de la suya y,
+// cuando se vacía, roba del inicio de las colas de los demás hilos.
+class PlanificadorRobo
+{
+private:
+    struct ColaHilo
+    {
+        std::mutex mtx;
+        std::deque<size_t> tareas;
+    };
+
+    std::vector<std::thread> hilos;
+    std::vector<std::unique_ptr<ColaHilo>> colas;
+    std::mutex mtxEstado;
+    std::mutex mtxEjecucion;
+    std::condition_variable cvTrabajo;
+    std::condition_variable cvFin;
+    const std::function<void(size_t, unsigned)> *tareaActual;
+    size_t tareasPendientes;
+    unsigned hilosActivos;
+    unsigned long long generacion;
+    bool detener;
+    std::exception_ptr primerError;
+
+    void cicloHilo(unsigned idHilo);
+    bool obtenerTarea(unsigned idHilo, size_t &tarea);
+
+public:
+    // Constructor (0 hilos = usar todos los núcleos disponibles)
+    explicit PlanificadorRobo(unsigned numHilos = 0);
+    ~PlanificadorRobo();
+
+    PlanificadorRobo(const PlanificadorRobo &) = delete;
+    PlanificadorRobo &operator=(const PlanificadorRobo &) = delete;
+
+    // Ejecuta tarea(indice, idHilo) para cada índice en [0, numTareas) y espera a que terminen.
+    // Si alguna tarea lanza una excepción, se relanza la primera en el hilo llamador.
+    // No debe llamarse desde dentro de una tarea del mismo planificador.
+    void ejecutar(size_t numTareas, const std::function<void(size_t, unsigned)> &tarea);
+    unsigned getNumHilos() const { return static_cast<unsigned>(hilos.size()); }
+};
+
+// Ajuste del lado derecho de una restricción del modelo base
+struct AjusteCapacidad
+{
+    size_t indiceRestriccion; // Posición de la restricción en el modelo base
+    double valorConstante;    // Nuevo valor del lado derecho
+
+    // Constructor
+    AjusteCapacidad(size_t indice, double constante) : indiceRestriccion(indice), valorConstante(constante) {}
+};
+
+// Variación de un escenario respecto al modelo base
+struct VariacionEscenario
+{
+    bool cambiaPrecios;                      // Si se reemplazan los precios del modelo base
+    double precioMesa;                       // Nuevo precio por mesa (si cambiaPrecios)
+    double precioSilla;                      // Nuevo precio por silla (si cambiaPrecios)
+    std::vector<AjusteCapacidad> capacidades; // Cambios de capacidad (lado derecho)
+
+    // Constructor
+    VariacionEscenario() : cambiaPrecios(false), precioMesa(0.0), precioSilla(0.0) {}
+};
+
+// Resuelve en paralelo todas las variaciones del modelo base.
+// Los resultados se devuelven en el mismo orden que las variaciones.
+std::vector<SolucionOptima> resolverLoteEscenarios(const ModeloProduccion &base,
+                                                   const std::vector<VariacionEscenario> &variaciones,
+                                                   PlanificadorRobo &planificador);
+
+// Compara el lote en paralelo con la ejecución en serie (orden, resultados y errores)
+void ejecutarBenchmarkLotes(size_t numEscenarios = 200000);
+
+// Resultado de preparar varios cuadros del gráfico
+struct MedicionCuadros
+{
+    size_t asignaciones = 0; // Asignaciones de la geometría y las etiquetas en todos los cuadros
+    double segundos = 0.0;   // Tiempo total
+    size_t control = 0;      // Suma de tamaños (evita que se descarte el cálculo)
+};
+
+// Prepara numCuadros cuadros del gráfico (rectas, área factible y etiquetas) con
+// la arena y snprintf, o con vectores del heap y ostringstream como antes (graficos.cpp)
+MedicionCuadros medirCuadrosGrafico(size_t numCuadros, bool conArena);
+
+// Mide las asignaciones de memoria por cálculo con y sin arena
+void ejecutarBenchmarkArena(size_t numCalculos = 200000);
+
+// Trazas de ejecución en formato Chrome trace-event (chrome://tracing, Perfetto).
+// Los intervalos se registran solo si la traza fue activada (opción --traza).
+void activarTraza(const std::string &archivo);
+bool trazaActiva();
+void guardarTraza();
+
+// Intervalo de traza: mide desde su creación hasta el final del ámbito
+class IntervaloTraza
+{
+private:
+    const char *nombre;    // Nombre del intervalo (debe ser un literal)
+    const char *categoria; // Categoría para filtrar en el visor
+    long long inicioNs;    // Marca de tiempo de inicio
+    bool activo;           // Si la traza estaba activa al crearlo
+
+public:
+    // Constructor
+    explicit IntervaloTraza(const char *nombre, const char *categoria = "general");
+    ~IntervaloTraza();
+
+    IntervaloTraza(const IntervaloTraza &) = delete;
+    IntervaloTraza &operator=(const IntervaloTraza &) = delete;
+};
+
+#define TRAZA_UNIR_(a, b) a##b
+#define TRAZA_UNIR(a, b) TRAZA_UNIR_(a, b)
+#define TRAZA_AMBITO(nombre, categoria) IntervaloTraza TRAZA_UNIR(intervaloTraza, __LINE__)(nombre, categoria)
+
+// ===== MOTOR DE PROGRAMACIÓN LINEAL GENERAL =====
+// Modelos con cualquier número de variables, resueltos con el método símplex
+// revisado con cotas. Se usa en los modos avanzados (multiperíodo, etc.).
+
+const double INFINITO_LP = std::numeric_limits<double>::infinity();
+
+// Resultado de resolver un modelo lineal
+enum EstadoLP
+{
+    LP_SIN_RESOLVER,
+    LP_OPTIMO,
+    LP_INFACTIBLE,
+    LP_NO_ACOTADO,
+    LP_LIMITE_ITERACIONES
+};
+
+// Función lineal por tramos definida por sus quiebres (x_k, f(x_k)).
+// Fuera de [x_0, x_K] no está definida: la variable queda dentro de ese rango.
+struct FuncionPorTramos
+{
+    std::vector<double> puntos;  // Abscisas de los quiebres, estrictamente crecientes
+    std::vector<double> valores; // Valor de la función en cada quiebre
+
+    int getNumTramos() const { return static_cast<int>(puntos.size()) - 1; }
+    double pendiente(int tramo) const { return (valores[tramo + 1] - valores[tramo]) / (puntos[tramo + 1] - puntos[tramo]); }
+    double evaluar(double x) const;
+    bool esConvexa() const;
+};
+
+// Costo escalonado que parte de 0: precios[k] por unidad entre limites[k-1] y limites[k]
+FuncionPorTramos construirCostoEscalonado(const std::vector<double> &limites, const std::vector<double> &precios);
+
+// Costo por tramos que se resta del objetivo al nivel de una variable
+struct CostoPorTramos
+{
+    int variable;
+    FuncionPorTramos funcion;
+};
+
+// Modelo lineal general: maximizar c·x - Σ f_j(x_j) sujeto a filaInferior <= A·x <= filaSuperior
+// y cotaInferior <= x <= cotaSuperior. Los costos f_j convexos los resuelve el
+// símplex directamente; los no convexos requieren el modo entero (SOS2).
+struct ModeloLineal
+{
+    std::vector<double> objetivo;                           // Coeficientes de la función objetivo
+    std::vector<double> cotaInferior;                       // Cota inferior de cada variable
+    std::vector<double> cotaSuperior;                       // Cota superior de cada variable
+    std::vector<std::vector<std::pair<int, double>>> filas; // Coeficientes no nulos de cada fila
+    std::vector<double> filaInferior;                       // Cota inferior de cada fila
+    std::vector<double> filaSuperior;                       // Cota superior de cada fila
+    std::vector<CostoPorTramos> costosPorTramos;            // A lo sumo uno por variable
+
+    int agregarVariable(double costo, double inferior = 0.0, double superior = INFINITO_LP);
+    int agregarFila(std::vector<std::pair<int, double>> coeficientes, const std::string &operador, double valor);
+    void agregarCostoPorTramos(int variable, const FuncionPorTramos &funcion);
+    int getNumVariables() const { return static_cast<int>(objetivo.size()); }
+    int getNumFilas() const { return static_cast<int>(filas.size()); }
+};
+
+// Convierte el modelo de dos variables (x₁, x₂ >= 0) al formato general
+ModeloLineal construirModeloLineal(const ModeloProduccion &modelo);
+
+// ===== FACTORIZACIÓN DISPERSA =====
+
+// Matriz dispersa guardada dos veces: por filas (CSR) y por columnas (CSC).
+// Cada vista tiene el inicio de cada fila (o columna), los índices y los
+// valores en arreglos contiguos; los coeficientes repetidos se suman y los
+// ceros no se guardan
+class MatrizDispersa
+{
+private:
+    int numFilas;
+    int numColumnas;
+    std::vector<int> inicioFila;      // numFilas + 1 posiciones
+    std::vector<int> columnaFila;     // Columna de cada elemento de la vista por filas
+    std::vector<double> valorFila;
+    std::vector<int> inicioColumna;   // numColumnas + 1 posiciones
+    std::vector<int> filaColumna;     // Fila de cada elemento de la vista por columnas
+    std::vector<double> valorColumna;
+
+    void armarColumnas(); // Vista por columnas a partir de la vista por filas
+    void armarFilas();    // Vista por filas a partir de la vista por columnas
+
+public:
+    // Constructor
+    MatrizDispersa();
+
+    void cargar(int filas, int columnas, const std::vector<std::vector<std::pair<int, double>>> &coeficientesPorFila);
+    void agregarColumna(const std::vector<std::pair<int, double>> &columna);
+    void agregarFila(const std::vector<std::pair<int, double>> &fila);
+    void quitarFilas(const std::vector<int> &nuevoIndice, int restantes); // nuevoIndice -1 = se quita
+
+    int getNumFilas() const { return numFilas; }
+    int getNumColumnas() const { return numColumnas; }
+    int getNoNulos() const { return static_cast<int>(valorFila.size()); }
+    int getLargoFila(int i) const { return inicioFila[i + 1] - inicioFila[i]; }
+    const int *getColumnasFila(int i) const { return columnaFila.data() + inicioFila[i]; }
+    const double *getValoresFila(int i) const { return valorFila.data() + inicioFila[i]; }
+    int getLargoColumna(int j) const { return inicioColumna[j + 1] - inicioColumna[j]; }
+    const int *getFilasColumna(int j) const { return filaColumna.data() + inicioColumna[j]; }
+    const double *getValoresColumna(int j) const { return valorColumna.data() + inicioColumna[j]; }
 };
 
+// Vector de dimensión fija con la lista de sus posiciones no nulas, para que
+// los recorridos cuesten lo que sus no nulos y no lo que su dimensión
+struct VectorDisperso
+{
+    std::vector<double> valores; // Valor de cada posición
+    std::vector<int> indices;    // Posiciones listadas, sin repetir (alguna puede haber quedado en cero)
+    std::vector<char> marcas;    // 1 si la posición está en indices
+
+    void reiniciar(int dimension); // Todo en cero (solo recorre indices si la dimensión no cambia)
+    void reconstruirIndices();     // Vuelve a listar recorriendo todas las posiciones
+    void depurar(double tolerancia); // Quita los valores de magnitud menor a la tolerancia
+    void sumar(int i, double valor)
+    {
+        if (!marcas[i])
+        {
+            marcas[i] = 1;
+            indices.push_back(i);
+        }
+        valores[i] += valor;
+    }
+};
+
+// Factorización de la base B (m × m) del símplex revisado. Las posiciones son
+// las columnas de B; la columna de una variable lógica es -e_fila.
+// La versión dispersa elige los pivotes con el criterio de Markowitz con
+// umbral (pocos elementos nuevos y pivote no menor que una fracción del mayor
+// de su columna), guarda L como columnas eta y U por filas y por columnas, y
+// aplica cada cambio de base con Forrest-Tomlin: la columna que entra reemplaza
+// a la que sale en U, su fila pivote pasa al final del orden y se elimina con
+// una fila eta (R). FTRAN y BTRAN con un lado derecho hiperdisperso recorren
+// solo las filas alcanzables desde sus no nulos, en orden topológico.
+// La versión densa guarda B⁻¹ explícita con actualizaciones en forma producto.
+class FactorizacionLU
+{
+private:
+    // Sucesión de etas: cada una tiene una fila pivote y una lista (índice, valor)
+    struct ListaEtas
+    {
+        std::vector<int> pivote;
+        std::vector<int> inicio; // Cantidad de etas + 1
+        std::vector<int> indice;
+        std::vector<double> valor;
+
+        void limpiar();
+        void abrir(int fila);
+        int cantidad() const { return static_cast<int>(pivote.size()); }
+    };
+
+    bool densa;
+    bool hiperdispersa;
+    int m;
+    int actualizaciones;
+    long noNulosFactorizacion; // Elementos de L y U al factorizar
+    long noNulosAgregados;     // Elementos que agregaron después las actualizaciones
+    std::vector<double> inversa; // B⁻¹ por filas (versión densa)
+
+    ListaEtas etasL;                                       // L⁻¹ = E_k ··· E_1, en orden de eliminación
+    ListaEtas transpuestaL;                                // Los mismos multiplicadores agrupados por fila
+    std::vector<int> etaDeFila;                            // Eta de L con esa fila pivote o -1
+    ListaEtas etasR;                                       // Filas eta de Forrest-Tomlin
+    std::vector<std::vector<std::pair<int, double>>> filasU;    // Por fila: (posición, valor) fuera de la diagonal
+    std::vector<std::vector<std::pair<int, double>>> columnasU; // Por posición: (fila, valor) fuera de la diagonal
+    std::vector<double> diagonal;                          // Pivote de cada fila
+    std::vector<int> columnaDeFila;                        // Posición pivote de cada fila
+    std::vector<int> filaDeColumna;                        // Fila pivote de cada posición
+    std::vector<int> orden;                                // Filas en orden de pivoteo (-1: pasó al final)
+    std::vector<int> lugarEnOrden;                         // Índice de cada fila en orden
+    VectorDisperso espiga;                                 // L⁻¹·a_q de la última columna que puede entrar
+    bool espigaValida;
+
+    // Fracción media de no nulos de los resultados de FTRAN y BTRAN (decide si
+    // conviene el recorrido por alcanzables)
+    mutable double densidadFtran;
+    mutable double densidadBtran;
+
+    // Submatriz activa de la eliminación y listas de líneas por cantidad de
+    // elementos; se conservan entre factorizaciones para no volver a pedir memoria
+    struct EspacioEliminacion
+    {
+        std::vector<std::vector<std::pair<int, double>>> columnas; // (fila, valor)
+        std::vector<std::vector<int>> filas;                       // Posiciones
+        std::vector<std::vector<int>> columnasPorConteo;
+        std::vector<std::vector<int>> filasPorConteo;
+        std::vector<char> columnaHecha;
+        std::vector<char> filaHecha;
+        std::vector<int> lugarEnColumna;
+        std::vector<std::pair<int, double>> multiplicadores;
+    };
+    EspacioEliminacion eliminacion;
+
+    // Espacio de trabajo de FTRAN y BTRAN
+    mutable VectorDisperso auxiliar;
+    mutable std::vector<int> recorrido;
+    mutable std::vector<int> pila;
+    mutable std::vector<int> siguiente;
+    mutable std::vector<char> visitado;
+
+    bool factorizarDensa(const std::vector<int> &base, int n, const MatrizDispersa &matriz);
+    void dimensionarTrabajo();
+    bool usarHiperdispersa(const VectorDisperso &x, double densidadEsperada) const;
+    void registrarDensidad(const VectorDisperso &x, double &densidad) const;
+    void resolverU(VectorDisperso &x, double densidadEsperada) const;
+    void resolverUTranspuesta(VectorDisperso &x, double densidadEsperada) const;
+
+public:
+    // Constructor
+    FactorizacionLU();
+
+    void setDensa(bool nuevaDensa) { densa = nuevaDensa; }
+    void setHiperdispersa(bool nuevaHiperdispersa) { hiperdispersa = nuevaHiperdispersa; }
+    bool esDensa() const { return densa; }
+
+    bool factorizar(const std::vector<int> &base, int n, const MatrizDispersa &matriz); // false si B es singular
+    void ftran(VectorDisperso &x, bool guardarEspiga = false); // x := B⁻¹·x (de filas a posiciones)
+    void btran(VectorDisperso &x) const;                        // x := xᵀ·B⁻¹ (de posiciones a filas)
+    bool actualizar(int posicion, const VectorDisperso &alfa);  // false si conviene refactorizar
+    void agregarFila(const std::vector<std::pair<int, double>> &coeficientesBase); // Nueva fila con su lógica básica
+    int getActualizaciones() const { return actualizaciones; }
+    long getNoNulos() const; // Elementos guardados de L, U y R (o m² en la versión densa)
+};
+
+void ejecutarBenchmarkFactorizacion();
+
+// Reglas del símplex. Por defecto: precios Devex (costo reducido² / peso de
+// referencia); en modelos con muchas más columnas que filas, sobre un segmento
+// de columnas, con una lista de candidatas que se vuelven a evaluar antes de
+// otro segmento; y prueba de razón dual con saltos de cota (las variables
+// acotadas que se cruzan pasan a su otra cota en lugar de entrar a la base).
+// Los núcleos densos usan SSE2 si está disponible. La base se guarda como LU
+// dispersa con actualizaciones de Forrest-Tomlin.
+struct OpcionesSimplex
+{
+    bool devex;            // false = Dantzig (mayor costo reducido)
+    bool preciosParciales; // Segmentos de columnas y lista de candidatas (en modelos anchos)
+    bool saltosDeCota;     // Prueba de razón dual con saltos de cota
+    bool vectorial;        // Núcleos SSE2 (false = versión escalar)
+    bool factorizacionDispersa; // LU dispersa (false = B⁻¹ densa explícita)
+    bool hiperdispersa;         // FTRAN/BTRAN por alcanzables con lados derechos muy dispersos
+
+    // Constructor
+    OpcionesSimplex()
+        : devex(true), preciosParciales(true), saltosDeCota(true), vectorial(true), factorizacionDispersa(true),
+          hiperdispersa(true) {}
+};
+
+// Método símplex revisado con cotas en las variables.
+// Conserva la base entre llamadas: después de cambiar costos, cotas o agregar
+// filas o columnas, resolver() continúa desde la base anterior (arranque en caliente)
+// con el símplex primal o el dual según corresponda.
+// Una variable con costo por tramos convexo se mueve dentro de un tramo a la vez:
+// las cotas y el costo de la variable son los del tramo vigente, y el quiebre se
+// cruza en la prueba de razón sin agregar columnas.
+class ResolvedorSimplex
+{
+private:
+    // Estado de una variable con costo por tramos convexo
+    struct TramosVariable
+    {
+        FuncionPorTramos funcion;
+        double costoLineal; // Coeficiente de la variable en c·x
+        double inferior;    // Cotas propias de la variable (sin los quiebres)
+        double superior;
+        int tramo;          // Tramo vigente
+    };
+
+    int n; // Variables estructurales
+    int m; // Filas (cada una tiene una variable lógica r_i = a_i·x)
+
+    std::vector<double> costo;                                // Costos de las n + m variables
+    std::vector<double> inferior;                             // Cotas inferiores de las n + m variables
+    std::vector<double> superior;                             // Cotas superiores de las n + m variables
+    MatrizDispersa matriz;                                    // Coeficientes de A por filas y por columnas
+    std::vector<double> valores;                              // Valor actual de las n + m variables
+    std::vector<int> base;                                    // Variable básica de cada posición
+    std::vector<int> posicionBase;                            // Posición en la base o -1 si no es básica
+    FactorizacionLU factorizacion;                            // Factorización de B
+    std::vector<double> duales;                               // y = c_B·B⁻¹
+    std::vector<int> indiceTramos;                            // Posición en tramosVariables o -1 (tamaño n)
+    std::vector<TramosVariable> tramosVariables;
+    int actualizacionesDesdeRefactorizacion;
+    EstadoLP estado;
+    long iteraciones;
+    long limiteIteraciones;
+    OpcionesSimplex opciones;
+    std::vector<double> pesosDevex; // Peso de referencia de cada una de las n + m variables
+    std::vector<int> candidatas;    // Entrantes pendientes de la última búsqueda por segmentos
+    int inicioSegmento;             // Primera columna del próximo segmento de precios
+
+    // Vectores de trabajo de los núcleos de precios y de razón (n + m valores)
+    struct EspacioNucleos
+    {
+        std::vector<double> atractivo; // Mejora por unidad de cada posible entrante
+        std::vector<double> puntajes;  // atractivo² / peso
+        std::vector<double> fila;      // Fila pivote de B⁻¹·[A  -I]
+        std::vector<double> reducidos; // |costo reducido|
+        std::vector<double> sube;      // 1 si la variable puede subir
+        std::vector<double> baja;      // 1 si la variable puede bajar
+        std::vector<double> razones;   // Razón dual o infinito
+        std::vector<std::pair<double, int>> monticulo; // Razones finitas de la prueba con saltos de cota
+    };
+    EspacioNucleos espacio;
+    VectorDisperso columnaBase; // Trabajo de FTRAN (m valores)
+    VectorDisperso filaBase;    // Trabajo de BTRAN (m valores)
+
+    bool usarInversaDensa() const;
+    void refactorizar();
+    void reiniciarBaseLogica();
+    void calcularValoresBasicos();
+    void calcularDuales(const std::vector<double> &costosBase);
+    double productoColumna(const std::vector<double> &fila, int k) const;
+    void productoFila(const VectorDisperso &rho, double *fila) const; // ρ·[A  -I] en las no básicas
+    void filaInversa(int posicion, VectorDisperso &rho) const;        // Fila de B⁻¹
+    void columnaTransformada(int k, VectorDisperso &alfa);
+    void pivotear(int fila, int entrante, const VectorDisperso &alfa);
+    bool esPrimalFactible() const;
+    bool esDualFactible();
+    double pruebaRazon(int entrante, double direccion, const VectorDisperso &alfa, bool fase1, bool bland,
+                       int &filaSaliente, double &cotaSaliente) const;
+    void moverEntrante(int entrante, double direccion, double paso, const VectorDisperso &alfa);
+    double atractivoEntrante(int k, bool fase1, double &direccion) const;
+    int elegirEntrante(bool fase1, bool bland, double &direccion);
+    void actualizarPesosDevex(int fila, int entrante, double pivote);
+    int pruebaRazonDual(int fila, bool debajo, std::vector<int> &saltos);
+    EstadoLP simplexPrimal(bool fase1, const TokenCancelacion *token);
+    EstadoLP simplexDual(const TokenCancelacion *token);
+    void colocarEnCota(int k);
+    void fijarTramo(int j, int tramo);
+    void ubicarTramo(int j);
+    void ubicarTramosBasicos();
+    bool puedeCruzar(int j, double direccion) const;
+
+public:
+    // Constructor
+    ResolvedorSimplex();
+
+    void cargar(const ModeloLineal &modelo);
+    EstadoLP resolver(const TokenCancelacion *token = nullptr);
+
+    // Cambios que conservan la base para re-optimizar
+    void cambiarObjetivo(int j, double nuevoCosto);
+    void cambiarCotasVariable(int j, double nuevaInferior, double nuevaSuperior);
+    void cambiarCotasFila(int i, double nuevaInferior, double nuevaSuperior);
+    int agregarVariable(double nuevoCosto, double nuevaInferior, double nuevaSuperior,
+                        const std::vector<std::pair<int, double>> &columna);
+    int agregarFila(const std::vector<std::pair<int, double>> &coeficientes, double nuevaInferior, double nuevaSuperior);
+    void quitarFilas(const std::vector<int> &filasQuitadas); // Solo filas con la variable lógica básica
+
+    // Base actual (para separar cortes)
+    int getBasica(int posicion) const { return base[posicion]; }
+    bool esBasica(int k) const { return posicionBase[k] >= 0; }
+    void filaTransformada(int posicion, std::vector<double> &fila) const; // Fila de B⁻¹·[A  -I], n + m valores
+
+    // Resultados
+    EstadoLP getEstado() const { return estado; }
+    double getValorObjetivo() const;
+    double getValor(int j) const { return valores[j]; }
+    std::vector<double> getValores() const;
+    double getActividadFila(int i) const { return valores[n + i]; }
+    double getDual(int i) const { return duales[i]; } // Variación del objetivo por unidad de la fila i
+    double getCostoReducido(int j) const;
+    long getIteraciones() const { return iteraciones; }
+    int getNumVariables() const { return n; }
+    int getNumFilas() const { return m; }
+    void setLimiteIteraciones(long limite) { limiteIteraciones = limite; }
+    void setOpciones(const OpcionesSimplex &nuevas) { opciones = nuevas; }
+};
+
+void ejecutarBenchmarkSimplex();
+
+// ===== MODELADO CON PLANTILLAS DE EXPRESIÓN =====
+// Las restricciones se escriben como en papel, por ejemplo
+//     modelo.restricciones.push_back(4 * X1 + 3 * X2 <= 240);
+// y el compilador reduce la expresión a sus coeficientes: los nodos de la
+// expresión viven en la pila y no hay asignaciones de memoria intermedias.
+// Los productos entre variables y las comparaciones estrictas no compilan.
+
+enum class OperadorLineal
+{
+    MenorIgual,
+    MayorIgual,
+    Igual
+};
+
+constexpr const char *textoOperador(OperadorLineal operador)
+{
+    return operador == OperadorLineal::MenorIgual ? "<=" : (operador == OperadorLineal::MayorIgual ? ">=" : "=");
+}
+
+// Operador de la misma relación con los dos lados intercambiados
+constexpr OperadorLineal operadorOpuesto(OperadorLineal operador)
+{
+    return operador == OperadorLineal::MenorIgual
+               ? OperadorLineal::MayorIgual
+               : (operador == OperadorLineal::MayorIgual ? OperadorLineal::MenorIgual : OperadorLineal::Igual);
+}
+
+// Forma canónica "a·x <= c" / ">= c": una fila con todos los coeficientes no
+// positivos se multiplica por -1 (así "-4x₁ - 3x₂ >= -240" queda "4x₁ + 3x₂ <= 240")
+inline bool filaNoPositiva(const double *coeficientes, size_t cantidad)
+{
+    bool negativo = false;
+    for (size_t k = 0; k < cantidad; k++)
+    {
+        if (coeficientes[k] > 0)
+            return false;
+        negativo = negativo || coeficientes[k] < 0;
+    }
+    return negativo;
+}
+
+// Índice máximo de una expresión con variables que solo se conocen al ejecutar
+constexpr int INDICE_DINAMICO = std::numeric_limits<int>::max();
+
+// Base de todas las expresiones lineales (cada nodo se pasa a sí mismo como E)
+template <class E>
+struct ExpresionLineal
+{
+    constexpr const E &derivada() const { return static_cast<const E &>(*this); }
+};
+
+// Variable con índice fijo al compilar
+template <int I>
+struct VariableFija : ExpresionLineal<VariableFija<I>>
+{
+    static constexpr int MAXIMO_INDICE = I;
+    static constexpr size_t TERMINOS = 1;
+
+    template <class F>
+    void recorrer(double factor, F &visitar) const { visitar(I, factor); }
+    constexpr double constante() const { return 0.0; }
+};
+
+// Variables del modelo de producción: X1 = mesas, X2 = sillas
+constexpr VariableFija<0> X1{};
+constexpr VariableFija<1> X2{};
+
+// Variable de un ModeloLineal (índice devuelto por agregarVariable)
+struct VariableLineal : ExpresionLineal<VariableLineal>
+{
+    static constexpr int MAXIMO_INDICE = INDICE_DINAMICO;
+    static constexpr size_t TERMINOS = 1;
+    int indice;
+
+    // Constructor
+    explicit constexpr VariableLineal(int j) : indice(j) {}
+
+    template <class F>
+    void recorrer(double factor, F &visitar) const { visitar(indice, factor); }
+    constexpr double constante() const { return 0.0; }
+};
+
+struct ConstanteLineal : ExpresionLineal<ConstanteLineal>
+{
+    static constexpr int MAXIMO_INDICE = -1;
+    static constexpr size_t TERMINOS = 0;
+    double valor;
+
+    // Constructor
+    explicit constexpr ConstanteLineal(double v) : valor(v) {}
+
+    template <class F>
+    void recorrer(double, F &) const {}
+    constexpr double constante() const { return valor; }
+};
+
+template <class E>
+struct TerminoEscalado : ExpresionLineal<TerminoEscalado<E>>
+{
+    static constexpr int MAXIMO_INDICE = E::MAXIMO_INDICE;
+    static constexpr size_t TERMINOS = E::TERMINOS;
+    E expresion;
+    double factor;
+
+    // Constructor
+    constexpr TerminoEscalado(const E &e, double k) : expresion(e), factor(k) {}
+
+    template <class F>
+    void recorrer(double externo, F &visitar) const { expresion.recorrer(externo * factor, visitar); }
+    constexpr double constante() const { return factor * expresion.constante(); }
+};
+
+template <class A, class B>
+struct SumaLineal : ExpresionLineal<SumaLineal<A, B>>
+{
+    static constexpr int MAXIMO_INDICE = A::MAXIMO_INDICE > B::MAXIMO_INDICE ? A::MAXIMO_INDICE : B::MAXIMO_INDICE;
+    static constexpr size_t TERMINOS = A::TERMINOS + B::TERMINOS;
+    A izquierda;
+    B derecha;
+
+    // Constructor
+    constexpr SumaLineal(const A &a, const B &b) : izquierda(a), derecha(b) {}
+
+    template <class F>
+    void recorrer(double factor, F &visitar) const
+    {
+        izquierda.recorrer(factor, visitar);
+        derecha.recorrer(factor, visitar);
+    }
+    constexpr double constante() const { return izquierda.constante() + derecha.constante(); }
+};
+
+// Restricción "expresion (operador) 0"; el lado derecho ya se pasó a la izquierda.
+// El lado derecho se calcula como 0 - constante para no producir -0, y la fila se
+// guarda en forma canónica (ver filaNoPositiva).
+template <class E, OperadorLineal Op>
+struct RelacionLineal
+{
+    E expresion;
+
+    // Constructor
+    explicit constexpr RelacionLineal(const E &e) : expresion(e) {}
+
+    // Solo las expresiones en X1 y X2 caben en una Restriccion
+    operator Restriccion() const
+    {
+        static_assert(E::MAXIMO_INDICE <= 1,
+                      "Una Restriccion solo admite X1 y X2; use agregarRestriccion con un ModeloLineal");
+        double coeficientes[2] = {0.0, 0.0};
+        auto acumular = [&coeficientes](int j, double a) { coeficientes[j] += a; };
+        expresion.recorrer(1.0, acumular);
+        if (filaNoPositiva(coeficientes, 2))
+            return Restriccion(0.0 - coeficientes[0], 0.0 - coeficientes[1], expresion.constante() + 0.0,
+                               textoOperador(operadorOpuesto(Op)));
+        return Restriccion(coeficientes[0], coeficientes[1], 0.0 - expresion.constante(), textoOperador(Op));
+    }
+};
+
+// Agrega la restricción como fila del modelo; devuelve el índice de la fila
+template <class E, OperadorLineal Op>
+int agregarRestriccion(ModeloLineal &modelo, const RelacionLineal<E, Op> &relacion)
+{
+    // El número de términos se conoce al compilar: se acumulan en la pila y la
+    // única reserva es la fila que guarda el modelo
+    std::array<std::pair<int, double>, E::TERMINOS> terminos;
+    size_t usados = 0;
+    auto acumular = [&terminos, &usados](int j, double a) { terminos[usados++] = std::make_pair(j, a); };
+    relacion.expresion.recorrer(1.0, acumular);
+
+    // Una variable que aparece varias veces suma sus coeficientes
+    auto porIndice = [](const std::pair<int, double> &a, const std::pair<int, double> &b) { return a.first < b.first; };
+    if (!std::is_sorted(terminos.begin(), terminos.begin() + usados, porIndice))
+        std::sort(terminos.begin(), terminos.begin() + usados, porIndice);
+    size_t distintos = 0;
+    for (size_t k = 0; k < usados; k++)
+    {
+        if (distintos > 0 && terminos[distintos - 1].first == terminos[k].first)
+            terminos[distintos - 1].second += terminos[k].second;
+        else
+            terminos[distintos++] = terminos[k];
+    }
+    std::vector<std::pair<int, double>> coeficientes(terminos.begin(), terminos.begin() + distintos);
+
+    bool invertir = !coeficientes.empty();
+    bool negativo = false;
+    for (const auto &termino : coeficientes)
+    {
+        invertir = invertir && termino.second <= 0;
+        negativo = negativo || termino.second < 0;
+    }
+    if (invertir && negativo)
+    {
+        for (auto &termino : coeficientes)
+            termino.second = 0.0 - termino.second;
+        return modelo.agregarFila(std::move(coeficientes), textoOperador(operadorOpuesto(Op)),
+                                  relacion.expresion.constante() + 0.0);
+    }
+    return modelo.agregarFila(std::move(coeficientes), textoOperador(Op), 0.0 - relacion.expresion.constante());
+}
+
+// Aritmética: suma, resta, negación y escalado por constantes
+template <class A, class B>
+constexpr SumaLineal<A, B> operator+(const ExpresionLineal<A> &a, const ExpresionLineal<B> &b)
+{
+    return SumaLineal<A, B>(a.derivada(), b.derivada());
+}
+
+template <class A>
+constexpr SumaLineal<A, ConstanteLineal> operator+(const ExpresionLineal<A> &a, double b)
+{
+    return SumaLineal<A, ConstanteLineal>(a.derivada(), ConstanteLineal(b));
+}
+
+template <class B>
+constexpr SumaLineal<B, ConstanteLineal> operator+(double a, const ExpresionLineal<B> &b)
+{
+    return SumaLineal<B, ConstanteLineal>(b.derivada(), ConstanteLineal(a));
+}
+
+template <class A>
+constexpr TerminoEscalado<A> operator*(double k, const ExpresionLineal<A> &a)
+{
+    return TerminoEscalado<A>(a.derivada(), k);
+}
+
+template <class A>
+constexpr TerminoEscalado<A> operator*(const ExpresionLineal<A> &a, double k)
+{
+    return TerminoEscalado<A>(a.derivada(), k);
+}
+
+template <class A>
+constexpr TerminoEscalado<A> operator/(const ExpresionLineal<A> &a, double k)
+{
+    return TerminoEscalado<A>(a.derivada(), 1.0 / k);
+}
+
+template <class A>
+constexpr TerminoEscalado<A> operator-(const ExpresionLineal<A> &a)
+{
+    return TerminoEscalado<A>(a.derivada(), -1.0);
+}
+
+template <class A, class B>
+constexpr SumaLineal<A, TerminoEscalado<B>> operator-(const ExpresionLineal<A> &a, const ExpresionLineal<B> &b)
+{
+    return SumaLineal<A, TerminoEscalado<B>>(a.derivada(), TerminoEscalado<B>(b.derivada(), -1.0));
+}
+
+template <class A>
+constexpr SumaLineal<A, ConstanteLineal> operator-(const ExpresionLineal<A> &a, double b)
+{
+    return SumaLineal<A, ConstanteLineal>(a.derivada(), ConstanteLineal(-b));
+}
+
+template <class B>
+constexpr SumaLineal<TerminoEscalado<B>, ConstanteLineal> operator-(double a, const ExpresionLineal<B> &b)
+{
+    return SumaLineal<TerminoEscalado<B>, ConstanteLineal>(TerminoEscalado<B>(b.derivada(), -1.0), ConstanteLineal(a));
+}
+
+// Comparaciones: "a op b" se guarda como "a - b op 0"; con la constante a la
+// izquierda, "c op b" se guarda como "b - c (opuesto) 0"
+#define RELACION_LINEAL(simbolo, operador, opuesto)                                                         \
+    template <class A, class B>                                                                             \
+    constexpr RelacionLineal<SumaLineal<A, TerminoEscalado<B>>, operador> operator simbolo(                 \
+        const ExpresionLineal<A> &a, const ExpresionLineal<B> &b)                                           \
+    {                                                                                                       \
+        return RelacionLineal<SumaLineal<A, TerminoEscalado<B>>, operador>(a - b);                          \
+    }                                                                                                       \
+    template <class A>                                                                                      \
+    constexpr RelacionLineal<SumaLineal<A, ConstanteLineal>, operador> operator simbolo(                    \
+        const ExpresionLineal<A> &a, double b)                                                              \
+    {                                                                                                       \
+        return RelacionLineal<SumaLineal<A, ConstanteLineal>, operador>(a - b);                             \
+    }                                                                                                       \
+    template <class B>                                                                                      \
+    constexpr RelacionLineal<SumaLineal<B, ConstanteLineal>, opuesto> operator simbolo(                     \
+        double a, const ExpresionLineal<B> &b)                                                              \
+    {                                                                                                       \
+        return RelacionLineal<SumaLineal<B, ConstanteLineal>, opuesto>(b - a);                              \
+    }
+
+RELACION_LINEAL(<=, OperadorLineal::MenorIgual, OperadorLineal::MayorIgual)
+RELACION_LINEAL(>=, OperadorLineal::MayorIgual, OperadorLineal::MenorIgual)
+RELACION_LINEAL(==, OperadorLineal::Igual, OperadorLineal::Igual)
+#undef RELACION_LINEAL
+
+// Lo que no es lineal o no se puede modelar se rechaza al compilar
+template <class T>
+struct siempreFalso : std::false_type
+{
+};
+
+template <class A, class B>
+void operator*(const ExpresionLineal<A> &, const ExpresionLineal<B> &)
+{
+    static_assert(siempreFalso<A>::value, "El producto de dos expresiones no es lineal");
+}
+
+template <class A, class B>
+void operator/(const ExpresionLineal<A> &, const ExpresionLineal<B> &)
+{
+    static_assert(siempreFalso<A>::value, "El cociente de dos expresiones no es lineal");
+}
+
+template <class A, class B>
+void operator<(const ExpresionLineal<A> &, const B &)
+{
+    static_assert(siempreFalso<A>::value, "Las desigualdades estrictas no se pueden modelar; use <=");
+}
+
+template <class A, class B>
+void operator>(const ExpresionLineal<A> &, const B &)
+{
+    static_assert(siempreFalso<A>::value, "Las desigualdades estrictas no se pueden modelar; use >=");
+}
+
+// Compara la construcción con cadenas de operador y con expresiones
+void ejecutarBenchmarkModelado(size_t restricciones = 1000000);
+
+// ===== PROGRAMACIÓN CUADRÁTICA (ELASTICIDAD DEL PRECIO) =====
+// Con precios que bajan al vender más, el ingreso es cóncavo. El modelo es
+// maximizar c·x - ½·xᵀQx (Q simétrica semidefinida positiva) sujeto a filas
+// a·x (<=, >=, =) b. Los modelos pequeños se resuelven con conjunto activo y
+// los grandes con punto interior; ambos parten de la solución lineal.
+
+struct ModeloCuadratico
+{
+    int numVariables;
+    std::vector<double> lineal;                 // c
+    std::vector<double> cuadratica;             // Q, numVariables × numVariables por filas
+    std::vector<double> coeficientes;           // Filas densas, numVariables valores por fila
+    std::vector<double> ladoDerecho;
+    std::vector<OperadorLineal> operadores;
+
+    // Constructor
+    explicit ModeloCuadratico(int n = 0) : numVariables(n), lineal(n, 0.0), cuadratica(static_cast<size_t>(n) * n, 0.0) {}
+
+    int agregarFila(const std::vector<double> &a, OperadorLineal operador, double b);
+    int getNumFilas() const { return static_cast<int>(ladoDerecho.size()); }
+    double evaluar(const std::vector<double> &x) const;
+};
+
+// Precio de venta = precio base - pendiente · unidades propias - cruzada · unidades del otro producto
+struct ElasticidadPrecio
+{
+    double pendienteMesa;
+    double pendienteSilla;
+    double cruzada;  // Productos sustitutos (> 0); requiere cruzada² <= pendienteMesa · pendienteSilla
+
+    // Constructor
+    ElasticidadPrecio(double mesa = 0.0, double silla = 0.0, double c = 0.0) : pendienteMesa(mesa), pendienteSilla(silla), cruzada(c) {}
+};
+
+enum MetodoCuadratico
+{
+    QP_AUTOMATICO,
+    QP_CONJUNTO_ACTIVO,
+    QP_PUNTO_INTERIOR
+};
+
+// Variables a partir de las cuales QP_AUTOMATICO usa punto interior. Con pocas
+// variables el conjunto activo cambia pocas filas desde el vértice lineal y
+// gana aunque el modelo tenga cientos de miles de filas.
+const int VARIABLES_PUNTO_INTERIOR = 50;
+
+struct ResultadoCuadratico
+{
+    std::vector<double> x;
+    double valorObjetivo;
+    EstadoLP estado;
+    MetodoCuadratico metodo;  // Método que se usó realmente
+    int iteraciones;
+
+    // Constructor
+    ResultadoCuadratico() : valorObjetivo(0.0), estado(LP_SIN_RESOLVER), metodo(QP_AUTOMATICO), iteraciones(0) {}
+};
+
+// Modelo de producción con ingresos cóncavos (x₁, x₂ >= 0 como filas explícitas)
+ModeloCuadratico construirModeloElasticidad(const ModeloProduccion &modelo, const ElasticidadPrecio &elasticidad);
+
+// Conjunto activo primal desde un punto factible
+ResultadoCuadratico resolverConjuntoActivo(const ModeloCuadratico &modelo, const std::vector<double> &inicio,
+                                           const TokenCancelacion *token = nullptr);
+
+// Punto interior primal-dual (predictor-corrector de Mehrotra), iniciado cerca de 'inicio'
+ResultadoCuadratico resolverPuntoInterior(const ModeloCuadratico &modelo, const std::vector<double> &inicio,
+                                          const TokenCancelacion *token = nullptr);
+
+// Resuelve primero la parte lineal (mismo conjunto factible) y la usa como arranque
+ResultadoCuadratico resolverCuadratico(const ModeloCuadratico &modelo, MetodoCuadratico metodo = QP_AUTOMATICO,
+                                       const TokenCancelacion *token = nullptr);
+
+SolucionOptima resolverProduccionConElasticidad(const ModeloProduccion &modelo, const ElasticidadPrecio &elasticidad,
+                                                MetodoCuadratico metodo = QP_AUTOMATICO);
+
+void ejecutarBenchmarkCuadratica();
+
+// ===== PLANIFICACIÓN MULTIPERÍODO =====
+
+// Datos de un período (semana) del plan
+struct PeriodoPlan
+{
+    double precioMesa;        // Precio de venta por mesa en el período
+    double precioSilla;       // Precio de venta por silla en el período
+    double demandaMesas;      // Máximo de mesas que se pueden vender
+    double demandaSillas;     // Máximo de sillas que se pueden vender
+    double factorCapacidad;   // Multiplica el lado derecho de las restricciones "<=" (feriados, turnos)
+
+    // Constructor
+    PeriodoPlan(double pMesa, double pSilla, double dMesas, double dSillas, double factor = 1.0)
+        : precioMesa(pMesa), precioSilla(pSilla), demandaMesas(dMesas), demandaSillas(dSillas), factorCapacidad(factor) {}
+};
+
+// Modelo de varios períodos: cada uno usa una copia de las restricciones de producción
+// y se enlazan por el balance de inventario: I(t-1) + producción(t) - ventas(t) = I(t)
+struct ModeloMultiperiodo
+{
+    std::vector<Restriccion> restricciones; // Restricciones de producción de cada período
+    std::vector<PeriodoPlan> periodos;      // Datos de cada período
+    double costoInventarioMesa;             // Costo de guardar una mesa un período
+    double costoInventarioSilla;            // Costo de guardar una silla un período
+    double inventarioInicialMesas;
+    double inventarioInicialSillas;
+
+    // Constructor
+    ModeloMultiperiodo()
+        : costoInventarioMesa(0.0), costoInventarioSilla(0.0), inventarioInicialMesas(0.0), inventarioInicialSillas(0.0) {}
+};
+
+// Plan resultante para cada período
+struct PlanPeriodo
+{
+    double mesas, sillas;                       // Producción
+    double ventasMesas, ventasSillas;           // Ventas
+    double inventarioMesas, inventarioSillas;   // Inventario al final del período
+};
+
+struct PlanMultiperiodo
+{
+    std::vector<PlanPeriodo> periodos;
+    double gananciaTotal;
+    bool solucionEncontrada;
+    int iteracionesDescomposicion; // Rondas de generación de columnas (0 en el modelo monolítico)
+
+    // Constructor
+    PlanMultiperiodo() : gananciaTotal(0.0), solucionEncontrada(false), iteracionesDescomposicion(0) {}
+};
+
+// Resuelve el plan como un único modelo lineal
+PlanMultiperiodo resolverMultiperiodoMonolitico(const ModeloMultiperiodo &modelo);
+
+// Resuelve el plan por descomposición de Dantzig-Wolfe: cada subproblema es un
+// bloque de períodos consecutivos (un trimestre por defecto), el maestro enlaza
+// los bloques por inventario y los subproblemas se resuelven en paralelo
+PlanMultiperiodo resolverMultiperiodoDescomposicion(const ModeloMultiperiodo &modelo, PlanificadorRobo &planificador,
+                                                    int periodosPorBloque = 13);
+
+// Compara ambos métodos con un horizonte de 52 semanas
+void ejecutarBenchmarkMultiperiodo(unsigned semanas = 52);
+
+// ===== RESTRICCIONES PEREZOSAS =====
+// Para familias enormes o implícitas de restricciones: se resuelve con un
+// conjunto activo pequeño y una rutina de separación agrega las filas que el
+// punto actual viola, re-optimizando desde la base anterior.
+
+// Rutina de separación: agrega a 'violadas' hasta 'maximo' restricciones que
+// el punto (x1, x2) no cumple. Si no agrega ninguna, el punto es factible.
+using SeparadorRestricciones = std::function<void(double x1, double x2, std::vector<Restriccion> &violadas, size_t maximo)>;
+
+// Separador que recorre una familia de filas generadas una por una (sin
+// guardarlas) y devuelve las más violadas
+SeparadorRestricciones crearSeparadorPorEnumeracion(size_t numFilas, std::function<Restriccion(size_t)> generador);
+
+struct ResultadoPerezoso
+{
+    SolucionOptima solucion;
+    EstadoLP estado;
+    size_t restriccionesActivas; // Filas agregadas por la separación
+    size_t rondas;               // Llamadas al separador
+    long iteracionesSimplex;
+
+    // Constructor
+    ResultadoPerezoso() : estado(LP_SIN_RESOLVER), restriccionesActivas(0), rondas(0), iteracionesSimplex(0) {}
+};
+
+// Resuelve el modelo base más las filas que vaya encontrando el separador
+ResultadoPerezoso resolverConRestriccionesPerezosas(const ModeloProduccion &base,
+                                                    const SeparadorRestricciones &separador,
+                                                    size_t maximoPorRonda = 32,
+                                                    const TokenCancelacion *token = nullptr);
+
+// Resuelve una familia de millones de filas de capacidad (máquina × turno × mezcla)
+void ejecutarBenchmarkPerezosas(size_t filas = 2000000);
+
+// ===== REDES DE DISTRIBUCIÓN =====
+
+const long long CAPACIDAD_ILIMITADA = std::numeric_limits<long long>::max();
+
+struct ArcoRed
+{
+    int origen;
+    int destino;
+    double costo;         // Costo por unidad enviada
+    long long capacidad;  // Máximo de unidades (CAPACIDAD_ILIMITADA si no hay límite)
+};
+
+// Red de flujo de costo mínimo: oferta > 0 en nodos que envían, < 0 en los que reciben
+class RedFlujo
+{
+private:
+    std::vector<long long> oferta;
+    std::vector<ArcoRed> arcos;
+
+public:
+    int agregarNodo(long long ofertaNodo = 0);
+    int agregarArco(int origen, int destino, double costo, long long capacidad = CAPACIDAD_ILIMITADA);
+    void setOferta(int nodo, long long valor) { oferta.at(nodo) = valor; }
+
+    int getNumNodos() const { return static_cast<int>(oferta.size()); }
+    int getNumArcos() const { return static_cast<int>(arcos.size()); }
+    long long getOferta(int nodo) const { return oferta[nodo]; }
+    const ArcoRed &getArco(int arco) const { return arcos[arco]; }
+};
+
+// Símplex de redes: base de árbol generador fuertemente factible y elección
+// de la variable entrante por bloques
+class SimplexRedes
+{
+private:
+    // Arcos de la red seguidos de un arco artificial por nodo hacia la raíz
+    std::vector<int> origen, destino;
+    std::vector<double> costo;
+    std::vector<long long> capacidad, flujo;
+    std::vector<signed char> estadoArco; // 1: en cota inferior, -1: en cota superior, 0: en el árbol
+
+    // Árbol: padre, arco al padre y su sentido (1: hacia el padre, -1: desde el padre)
+    std::vector<int> padre, arcoPadre, primerHijo, siguienteHermano, anteriorHermano, profundidad;
+    std::vector<signed char> sentido;
+    std::vector<double> potencial;
+    std::vector<int> pila; // Recorrido de subárboles, reutilizada entre pivoteos
+
+    int numNodos, numArcos, raiz;
+    double tolerancia; // Costo reducido mínimo para entrar a la base
+    int siguienteArcoBusqueda, tamanoBloque;
+    long pivoteos;
+    EstadoLP estado;
+
+    int buscarArcoEntrante();
+    bool pivotear(int arcoEntrante);
+    void desengancharHijo(int nodo);
+    void engancharHijo(int nodo, int nuevoPadre);
+    void recalcularSubarbol(int nodo);
+
+public:
+    // Constructor
+    SimplexRedes();
+
+    EstadoLP resolver(const RedFlujo &red);
+
+    EstadoLP getEstado() const { return estado; }
+    long long getFlujo(int arco) const { return flujo[arco]; }
+    double getPotencial(int nodo) const { return potencial[nodo]; }
+    double getCostoTotal() const;
+    long getPivoteos() const { return pivoteos; }
+};
+
+// Transporte de muebles desde las plantas a las tiendas
+struct RutaEnvio
+{
+    int planta;
+    int tienda;
+    double costoMesa;   // Costo por mesa enviada
+    double costoSilla;  // Costo por silla enviada
+    long long capacidadMesas;
+    long long capacidadSillas;
+};
+
+struct ModeloDistribucion
+{
+    int numPlantas;
+    std::vector<long long> demandaMesas;  // Una entrada por tienda
+    std::vector<long long> demandaSillas;
+    std::vector<RutaEnvio> rutas;
+    double penalizacionFaltante;          // Costo por unidad de demanda no atendida
+
+    // Constructor
+    ModeloDistribucion() : numPlantas(0), penalizacionFaltante(1000.0) {}
+};
+
+struct PlanDistribucion
+{
+    std::vector<long long> enviosMesas;   // Unidades por ruta (mismo orden que rutas)
+    std::vector<long long> enviosSillas;
+    long long faltanteMesas, faltanteSillas;  // Demanda no atendida
+    long long sobranteMesas, sobranteSillas;  // Producción que no se envía
+    double costoEnvio;                        // Sin contar penalizaciones
+    bool solucionEncontrada;
+
+    // Constructor
+    PlanDistribucion()
+        : faltanteMesas(0), faltanteSillas(0), sobranteMesas(0), sobranteSillas(0), costoEnvio(0.0), solucionEncontrada(false) {}
+};
+
+// Distribuye la producción de cada planta (la solución de su modelo de producción)
+PlanDistribucion planificarDistribucion(const ModeloDistribucion &modelo, const std::vector<SolucionOptima> &produccionPorPlanta);
+
+// Instancia de 100 plantas × 1000 tiendas (10⁵ rutas por producto)
+void ejecutarBenchmarkRedes(int plantas = 100, int tiendas = 1000);
+
+// ===== CORTE DE MADERA =====
+// Piezas de mesas y sillas cortadas de tablones de largo fijo. Se resuelve por
+// generación de columnas: el maestro lineal elige cuántos tablones cortar con
+// cada patrón y una mochila propone el siguiente patrón con los duales.
+
+// Pieza de madera que lleva cada mueble
+struct PiezaMadera
+{
+    std::string nombre;
+    double largo;  // Largo de la pieza (mm)
+    int porMesa;   // Piezas por mesa
+    int porSilla;  // Piezas por silla
+
+    // Constructor
+    PiezaMadera(const std::string &n, double l, int mesa, int silla) : nombre(n), largo(l), porMesa(mesa), porSilla(silla) {}
+};
+
+struct ModeloMadera
+{
+    double largoTablon;          // Largo del tablón de stock (mm)
+    double anchoCorte;           // Material que se pierde en cada corte de sierra (mm)
+    double tablonesDisponibles;  // Tablones en bodega para el período
+    std::vector<PiezaMadera> piezas;
+
+    // Constructor
+    ModeloMadera() : largoTablon(2440.0), anchoCorte(3.0), tablonesDisponibles(0.0) {}
+};
+
+// Forma de cortar un tablón
+struct PatronCorte
+{
+    std::vector<int> cantidades;  // Piezas de cada tipo que salen del tablón
+    double desperdicio;           // Largo sobrante del tablón (mm)
+};
+
+struct ResultadoCorte
+{
+    std::vector<PatronCorte> patrones;
+    std::vector<double> usoRelajado;   // Tablones por patrón en la relajación lineal
+    std::vector<long long> usoEntero;  // Tablones por patrón en el plan de corte
+    double cotaInferior;               // Tablones de la relajación lineal
+    long long tablones;                // Tablones del plan de corte
+    int columnasGeneradas;             // Patrones agregados por la mochila
+    int rondas;
+    EstadoLP estado;
+
+    // Constructor
+    ResultadoCorte() : cotaInferior(0.0), tablones(0), columnasGeneradas(0), rondas(0), estado(LP_SIN_RESOLVER) {}
+};
+
+// Plan de corte que cubre la demanda de cada largo con el menor número de tablones
+ResultadoCorte resolverCorteMadera(double largoTablon, double anchoCorte, const std::vector<double> &largos,
+                                   const std::vector<long long> &demandas, const TokenCancelacion *token = nullptr);
+
+// Restricción "tablones por mesa · x₁ + tablones por silla · x₂ <= disponibles"
+// calculada con el plan de corte de un lote de referencia de cada mueble
+Restriccion construirRestriccionMadera(const ModeloMadera &modelo, long long loteReferencia = 100);
+
+// Piezas de una mesa y una silla del caso Flair (sin tablones disponibles)
+ModeloMadera crearModeloMaderaFlair();
+
+void ejecutarBenchmarkCorte();
+
+// ===== PLANOS DE CORTE =====
+// Desigualdades que cumple toda solución entera y que la relajación lineal
+// viola: Gomory entero-mixto sobre filas del tableau, redondeo entero-mixto
+// (MIR) sobre las filas del modelo y cubiertas de mochila sobre filas de
+// variables binarias. Se derivan con las cotas globales de las variables, de
+// modo que valen en todo el árbol y en cualquier modelo con las mismas filas y
+// cotas aunque cambie el objetivo (por ejemplo, escenarios de precios).
+
+enum TipoCorte
+{
+    CORTE_GOMORY,
+    CORTE_MIR,
+    CORTE_CUBIERTA
+};
+
+// coeficientes·x <= lado, sobre las variables estructurales
+struct Corte
+{
+    std::vector<std::pair<int, double>> coeficientes; // Ordenados por variable, máximo |coeficiente| = 1
+    double lado;
+    TipoCorte tipo;
+    int edad;                                         // Consultas seguidas del pool sin que el corte se use
+    uint64_t firma;                                   // Huella de los coeficientes (sin el lado)
+
+    // Constructor
+    Corte() : lado(0.0), tipo(CORTE_GOMORY), edad(0), firma(0) {}
+};
+
+// Pool global de cortes compartido entre hilos. Un corte repetido (mismos
+// coeficientes) solo se guarda una vez, con el lado más ajustado; los que
+// pasan edadMaxima consultas sin usarse se descartan.
+class PoolCortes
+{
+private:
+    mutable std::mutex mtx;
+    std::vector<Corte> cortes;
+    std::unordered_map<uint64_t, size_t> indice; // Firma -> posición en cortes
+    uint64_t firmaModelo;                        // Filas y cotas de donde salen los cortes (0 = sin asignar)
+    size_t capacidad;
+    int edadMaxima;
+    long agregados;
+    long repetidos;
+    long descartados;
+
+public:
+    // Constructor
+    explicit PoolCortes(size_t capacidad = 10000, int edadMaxima = 2000);
+
+    // Asocia el pool a un modelo; lanza invalid_argument si ya tiene cortes de otro
+    void vincularModelo(uint64_t firma);
+
+    bool agregar(Corte corte); // false si ya estaba (se conserva el lado más ajustado)
+
+    // Cortes violados por x en más de tolerancia (los más violados primero);
+    // los entregados rejuvenecen y los demás envejecen
+    std::vector<Corte> separar(const std::vector<double> &x, double tolerancia, size_t maximo);
+
+    size_t getTamano() const;
+    long getAgregados() const;
+    long getRepetidos() const;
+    long getDescartados() const;
+    std::vector<Corte> getCortes() const; // Copia de los cortes guardados
+};
+
+struct ParametrosCortes
+{
+    int rondasRaiz;      // Rondas de separación en la raíz (0 = sin cortes)
+    int cortesPorRonda;  // Máximo de cortes agregados al LP por ronda de la raíz
+    int cortesPorNodo;   // Máximo de cortes del pool agregados en cada nodo
+    bool gomory;
+    bool mir;
+    bool cubiertas;
+    bool poolEnNodos;    // Buscar en el pool cortes violados en cada nodo
+    int edadEnLP;        // Nodos seguidos con holgura antes de quitar el corte del LP
+
+    // Constructor
+    ParametrosCortes()
+        : rondasRaiz(20), cortesPorRonda(50), cortesPorNodo(10), gomory(true), mir(true), cubiertas(true),
+          poolEnNodos(true), edadEnLP(10) {}
+};
+
+// Huella de las filas, cotas e integralidad de un modelo (el objetivo no cuenta)
+uint64_t calcularFirmaFactible(const ModeloLineal &modelo, const std::vector<int> &variablesEnteras);
+
+// Separa cortes en la solución actual del símplex. Las cotas son las globales
+// (las del modelo), no las del nodo, para que los cortes valgan en todo el árbol.
+std::vector<Corte> separarCortes(const ResolvedorSimplex &lp, const ModeloLineal &modelo,
+                                 const std::vector<bool> &esEntera, const ParametrosCortes &parametros);
+
+void ejecutarBenchmarkCortes();
+
+// ===== MODO ENTERO (RAMIFICACIÓN Y ACOTAMIENTO) =====
+// Variables enteras y conjuntos SOS2 sobre el símplex con arranque en caliente.
+// Los costos por tramos convexos se quedan en el símplex; los no convexos
+// (descuentos por volumen) se reescriben con pesos λ de un conjunto SOS2, sin
+// variables binarias, y se ramifica sobre el conjunto.
+
+// Cota de una variable impuesta al bajar de la raíz a un nodo
+struct CambioCota
+{
+    int variable;
+    double inferior;
+    double superior;
+};
+
+// Nodo pendiente del árbol, descrito por sus cambios respecto a la raíz
+struct NodoRamificacion
+{
+    double cota;                     // Valor de la relajación del nodo padre
+    int profundidad;
+    std::vector<CambioCota> cambios; // El último cambio de cada variable es el vigente
+};
+
+// A lo sumo dos variables no nulas, y consecutivas, en el orden de los pesos
+struct ConjuntoSOS2
+{
+    std::vector<int> variables;
+    std::vector<double> pesos; // Abscisa de cada variable (quiebres de la función)
+};
+
+struct ModeloEntero
+{
+    ModeloLineal lineal;
+    std::vector<int> variablesEnteras;
+    std::vector<ConjuntoSOS2> conjuntosSOS2;
+};
+
+struct ResultadoEntero
+{
+    EstadoLP estado;             // LP_LIMITE_ITERACIONES si se agotaron los nodos
+    std::vector<double> valores; // Mejor solución entera (variables del modelo original)
+    double valorObjetivo;
+    double cotaSuperior;         // Ninguna solución entera supera este valor
+    long nodos;
+    long iteracionesSimplex;
+    double cotaRaizInicial;      // Relajación de la raíz antes de los cortes
+    double cotaRaiz;             // Relajación de la raíz después de los cortes
+    long cortes;                 // Cortes agregados al LP (raíz y nodos)
+    long desbordes;              // Veces que los nodos abiertos pasaron a disco
+    long recargas;               // Veces que volvieron a memoria
+    bool reanudado;              // Se partió de un punto de control
+
+    // Constructor
+    ResultadoEntero()
+        : estado(LP_SIN_RESOLVER), valorObjetivo(0.0), cotaSuperior(0.0), nodos(0), iteracionesSimplex(0),
+          cotaRaizInicial(0.0), cotaRaiz(0.0), cortes(0), desbordes(0), recargas(0), reanudado(false) {}
+};
+
+// Cola de nodos abiertos (el de mayor cota primero) con un presupuesto de
+// memoria. Al pasarlo, los nodos de peor cota se escriben en el archivo de
+// desborde como un tramo ordenado, con un solo cambio de cota por variable.
+// Cuando el disco guarda un nodo mejor que el primero en memoria, se traen
+// los mejores nodos de cada tramo (mezcla) hasta llenar tres cuartos del
+// presupuesto: solo se lee lo que vuelve a memoria.
+class ColaNodos
+{
+private:
+    // Nodos consecutivos del archivo, de mayor a menor cota
+    struct TramoDisco
+    {
+        uint64_t inicio; // Primer byte sin leer
+        uint64_t fin;
+        size_t nodos;    // Nodos sin leer
+        double cotaPrimero;
+    };
+
+    std::vector<NodoRamificacion> monticulo;
+    size_t bytesEnMemoria;
+    size_t presupuesto;      // 0 = sin límite
+    std::string rutaDesborde;
+    std::vector<TramoDisco> tramos;
+    uint64_t tamanoArchivo;
+    size_t nodosEnDisco;
+    double umbralPoda;       // Los nodos con cota <= umbral ya no se guardan
+    long desbordes;
+    long recargas;
+
+    static size_t bytesNodo(const NodoRamificacion &nodo);
+    void desbordar();
+    void recargar();
+    void compactarArchivo();
+    double getMejorCotaEnDisco() const;
+
+public:
+    // Constructor
+    explicit ColaNodos(size_t presupuestoBytes = 0, const std::string &rutaDesborde = "");
+    ~ColaNodos();
+
+    ColaNodos(const ColaNodos &) = delete;
+    ColaNodos &operator=(const ColaNodos &) = delete;
+
+    void agregar(NodoRamificacion nodo);
+    bool extraer(NodoRamificacion &nodo); // El de mayor cota; false si no queda ninguno
+    bool vacia() const { return monticulo.empty() && nodosEnDisco == 0; }
+    size_t getTamano() const { return monticulo.size() + nodosEnDisco; } // Con los podados que siguen en disco
+    double getMejorCota() const; // -INFINITO_LP si está vacía
+    void podar(double valor);    // Descarta (al desbordar o recargar) los nodos que no superan valor
+    std::vector<NodoRamificacion> copiarNodos() const; // Todos los no podados, incluidos los del disco
+
+    size_t getBytesEnMemoria() const { return bytesEnMemoria; }
+    size_t getNodosEnDisco() const { return nodosEnDisco; }
+    long getDesbordes() const { return desbordes; }
+    long getRecargas() const { return recargas; }
+};
+
+// Memoria y puntos de control de una búsqueda larga
+struct OpcionesAlmacenamiento
+{
+    size_t presupuestoMemoria;       // Bytes de nodos abiertos en memoria (0 = sin límite)
+    std::string archivoDesborde;     // "" = archivo del punto de control con ".nodos"
+    std::string archivoPuntoControl; // "" = sin puntos de control
+    double segundosEntrePuntos;      // Frecuencia de los puntos de control
+    bool reanudar;                   // Seguir desde el punto de control si es del mismo modelo
+
+    // Constructor
+    OpcionesAlmacenamiento() : presupuestoMemoria(0), segundosEntrePuntos(60.0), reanudar(true) {}
+};
+
+// Estado completo de una búsqueda, tal como se guarda en un punto de control
+struct EstadoBusqueda
+{
+    uint64_t firmaModelo; // Filas, cotas, integralidad y objetivo
+    double mejorValor;
+    std::vector<double> valores; // Incumbente (vacío si no hay)
+    long nodos;
+    long iteracionesSimplex;
+    long cortes;
+    double cotaRaizInicial;
+    double cotaRaiz;
+    std::vector<NodoRamificacion> abiertos;
+    std::vector<Corte> pool;
+
+    // Constructor
+    EstadoBusqueda()
+        : firmaModelo(0), mejorValor(-INFINITO_LP), nodos(0), iteracionesSimplex(0), cortes(0), cotaRaizInicial(0.0),
+          cotaRaiz(0.0) {}
+};
+
+// Huella de un modelo entero completo (la factible más el objetivo y los costos por tramos)
+uint64_t calcularFirmaModeloEntero(const ModeloEntero &modelo);
+
+// Escribe el punto de control en un temporal y lo renombra al terminar
+void guardarPuntoControl(const std::string &ruta, const EstadoBusqueda &estado);
+
+// false si el archivo no existe; runtime_error si está dañado
+bool cargarPuntoControl(const std::string &ruta, EstadoBusqueda &estado);
+
+// Cambia cada costo por tramos no convexo por sus pesos λ y un conjunto SOS2
+ModeloEntero reformularTramosNoConvexos(const ModeloEntero &modelo);
+
+// Sin pool, los cortes de la búsqueda se guardan en uno propio
+ResultadoEntero resolverModeloEntero(const ModeloEntero &modelo, const TokenCancelacion *token = nullptr,
+                                     long limiteNodos = 100000,
+                                     const ParametrosCortes &parametros = ParametrosCortes(),
+                                     PoolCortes *pool = nullptr,
+                                     const OpcionesAlmacenamiento &almacenamiento = OpcionesAlmacenamiento());
+
+// Planta de lotes enteros con preparación binaria (semilla fija = mismas filas y cotas)
+ModeloEntero construirPlantaLotes(int productos, int maquinas, unsigned semilla,
+                                  const std::vector<double> &factoresPrecio = {});
+
+void ejecutarBenchmarkTramos();
+void ejecutarBenchmarkPuntosControl();
+
+// ===== ÓPTIMOS ALTERNATIVOS =====
+// Cuando la ganancia es paralela a una restricción activa, todo un lado (o una
+// cara) de la región factible es óptimo. La cara se recorre vértice a vértice
+// con búsqueda inversa (Avis y Fukuda) con perturbación lexicográfica: cada
+// vértice se entrega una sola vez y la memoria no depende de cuántos haya.
+
+class EnumeradorOptimos
+{
+private:
+    int n;                                // Variables del modelo original
+    int d;                                // Dimensión después de quitar las igualdades
+    int m;                                // Desigualdades G·y <= h de la cara
+    std::vector<double> origen;           // x = origen + Z·y
+    std::vector<double> direcciones;      // Z, n × d por filas
+    std::vector<double> matriz;           // Diccionario: m filas × d columnas
+    std::vector<double> lado;             // Valor de cada variable básica
+    std::vector<double> costos;           // Costos reducidos del objetivo auxiliar
+    std::vector<int> basicas;             // Holgura básica de cada fila (las d últimas filas son y)
+    std::vector<int> cobase;              // Holgura no básica de cada columna
+    std::vector<int> posicionCobase;      // Columna de cada holgura o -1
+    int profundidad;
+    int candidato;                        // Próxima holgura a probar en el nivel actual
+    bool iniciado;
+    bool terminado;
+    bool noAcotada;                       // Alguna arista de la cara no tiene fin
+    size_t limite;
+    size_t entregados;
+    std::vector<std::vector<double>> adelantados; // Vértices encontrados y todavía no entregados
+
+    double elemento(int fila, int columna) const { return matriz[static_cast<size_t>(fila) * d + columna]; }
+    double coeficienteLexico(int fila, int holgura) const;
+    int filaSaliente(int columna) const;
+    bool tienePositivo(int columna) const;
+    bool esHijo(int columna, int fila) const;
+    void pivotear(int fila, int columna);
+    bool esLexicoMinimo() const;
+    bool avanzar();
+    bool buscar(std::vector<double> &x);
+    void verticeActual(std::vector<double> &x) const;
+
+public:
+    // Prepara la cara óptima del modelo a partir de un vértice óptimo
+    EnumeradorOptimos(const ModeloLineal &modelo, const std::vector<double> &optimo, size_t limiteVertices = 1000);
+
+    // Entrega el siguiente vértice óptimo; false al terminar o al llegar al límite
+    bool siguiente(std::vector<double> &x);
+
+    bool hayOptimosAlternativos(); // Hay más de un vértice o una arista sin fin
+    bool esNoAcotada() const { return noAcotada; }
+    bool alcanzoLimite() const { return entregados >= limite && !terminado; }
+    size_t getEntregados() const { return entregados; }
+    int getDimension() const { return d; }
+};
+
+// Muestra los demás planes con la misma ganancia que la solución, si los hay
+void mostrarPlanesAlternativos(const ModeloProduccion &modelo, const SolucionOptima &solucion, size_t limite = 10);
+
+void ejecutarBenchmarkAlternativos();
+
+// ===== INSTANTÁNEAS BINARIAS DE LA SESIÓN =====
+// Archivo con el estado completo de una sesión (modelo, vértices del área
+// factible y última solución). Los registros tienen tamaño fijo y alineación
+// natural, de modo que el archivo se puede mapear en memoria y leer sin copias.
+//
+// Distribución: CabeceraInstantanea | RestriccionBinaria[n] | VerticeBinario[m]
+
+const char FIRMA_INSTANTANEA[8] = {'F', 'L', 'A', 'I', 'R', 'S', 'N', 'P'};
+const uint32_t VERSION_INSTANTANEA = 1;
+const uint32_t MARCA_ORDEN_BYTES = 0x01020304; // Detecta archivos escritos con otro orden de bytes
+
+// Bits de CabeceraInstantanea::banderas
+const uint32_t INSTANTANEA_PRECIOS = 1u << 0;
+const uint32_t INSTANTANEA_RESTRICCIONES = 1u << 1;
+const uint32_t INSTANTANEA_SOLUCION = 1u << 2;
+
+struct CabeceraInstantanea
+{
+    char firma[8];             // FIRMA_INSTANTANEA
+    uint32_t version;          // VERSION_INSTANTANEA con la que se escribió
+    uint32_t marcaOrden;       // MARCA_ORDEN_BYTES
+    uint64_t tamanoArchivo;    // Bytes totales, cabecera incluida
+    uint64_t sumaDatos;        // FNV-1a de todo lo que sigue a la cabecera
+    uint64_t sumaCabecera;     // FNV-1a de la cabecera con este campo en 0
+    uint32_t numRestricciones;
+    uint32_t numVertices;
+    uint32_t banderas;         // INSTANTANEA_*
+    uint32_t reservado;
+    double precioMesa;
+    double precioSilla;
+    double solucionX1;
+    double solucionX2;
+    double solucionGanancia;
+};
+
+struct RestriccionBinaria
+{
+    double coeficienteX1;
+    double coeficienteX2;
+    double valorConstante;
+    uint32_t operador; // 0: "<=", 1: ">=", 2: "="
+    uint32_t reservado;
+};
+
+struct VerticeBinario
+{
+    double x1;
+    double x2;
+};
+
+static_assert(sizeof(CabeceraInstantanea) == 96, "La cabecera de la instantánea debe medir 96 bytes");
+static_assert(sizeof(RestriccionBinaria) == 32, "Cada restricción binaria debe medir 32 bytes");
+static_assert(sizeof(VerticeBinario) == 16, "Cada vértice binario debe medir 16 bytes");
+
+// Escribe la instantánea de forma atómica (archivo temporal y renombrado)
+void guardarInstantanea(const std::string &ruta, const ModeloProduccion &modelo,
+                        const SolucionOptima &solucion, uint32_t banderas);
+
+// Vista de solo lectura sobre una instantánea mapeada en memoria.
+// getRestricciones() y getVertices() leen directamente del archivo mapeado;
+// obtenerModelo() copia las n restricciones a un ModeloProduccion editable.
+// Validar la cabecera es O(1); la suma de los registros y la copia son O(n).
+class InstantaneaMapeada
+{
+private:
+    const char *datos;
+    size_t tamano;
+
+public:
+    // Constructor: mapea y valida el archivo (lanza runtime_error si no es válido).
+    // verificarDatos = false omite la suma de los registros y valida solo la cabecera.
+    explicit InstantaneaMapeada(const std::string &ruta, bool verificarDatos = true);
+    ~InstantaneaMapeada();
+    InstantaneaMapeada(const InstantaneaMapeada &) = delete;
+    InstantaneaMapeada &operator=(const InstantaneaMapeada &) = delete;
+
+    const CabeceraInstantanea &getCabecera() const { return *reinterpret_cast<const CabeceraInstantanea *>(datos); }
+    const RestriccionBinaria *getRestricciones() const;
+    const VerticeBinario *getVertices() const;
+    size_t getNumRestricciones() const { return getCabecera().numRestricciones; }
+    size_t getNumVertices() const { return getCabecera().numVertices; }
+    bool tiene(uint32_t bandera) const { return (getCabecera().banderas & bandera) != 0; }
+
+    Restriccion getRestriccion(size_t i) const;
+    ModeloProduccion obtenerModelo() const;
+    SolucionOptima obtenerSolucion() const;
+};
+
+// Muestra el contenido de una instantánea sin cargarla en una sesión
+void mostrarInstantanea(const std::string &ruta);
+
+void ejecutarBenchmarkInstantanea(size_t repeticiones = 200);
+
+// ===== FLUJO DE PRECIOS =====
+// Reoptimización continua del modelo de Flair ante cambios de precio: las
+// restricciones no cambian, así que el polígono factible se calcula una sola vez
+// y cada precio nuevo solo recorre sus vértices vecinos.
+
+// Histograma de latencias en nanosegundos con cubetas logarítmicas
+// (16 subdivisiones por potencia de dos: error relativo menor al 6.25%).
+class HistogramaLatencia
+{
+private:
+    static const int SUBDIVISIONES = 16;
+    static const int OCTAVAS = 40;
+    std::vector<unsigned long long> cubetas;
+    unsigned long long cantidad;
+    unsigned long long maximo;
+    long double suma;
+
+    static int cubeta(unsigned long long nanosegundos);
+    static unsigned long long limiteSuperior(int indice);
+
+public:
+    // Constructor
+    HistogramaLatencia();
+
+    void registrar(unsigned long long nanosegundos);
+    // Latencia bajo la cual queda la fracción dada de las muestras (0 < fraccion <= 1)
+    unsigned long long percentil(double fraccion) const;
+    unsigned long long getCantidad() const { return cantidad; }
+    unsigned long long getMaximo() const { return maximo; }
+    double getPromedio() const { return cantidad ? static_cast<double>(suma / cantidad) : 0.0; }
+};
+
+// Mantiene el plan óptimo de un conjunto fijo de restricciones mientras cambian los precios.
+// Los vértices del polígono factible se guardan en orden antihorario; la ganancia
+// sobre ellos es unimodal, así que basta avanzar hacia el vecino que mejora.
+class ReoptimizadorPrecios
+{
+private:
+    std::vector<std::pair<double, double>> vertices; // Envolvente de los puntos factibles
+    size_t actual;                                   // Vértice óptimo vigente
+    bool conPrecios;                                 // false hasta el primer precio
+    double precioMesa;
+    double precioSilla;
+
+    double ganancia(size_t vertice) const
+    {
+        return precioMesa * vertices[vertice].first + precioSilla * vertices[vertice].second;
+    }
+
+public:
+    // Constructor: calcula el polígono factible de las restricciones
+    explicit ReoptimizadorPrecios(const std::vector<Restriccion> &restricciones);
+
+    // Cambia los precios y reoptimiza; devuelve true si cambió el plan óptimo
+    bool actualizarPrecios(double nuevoPrecioMesa, double nuevoPrecioSilla);
+    SolucionOptima getSolucion() const;
+    bool esFactible() const { return !vertices.empty(); }
+    size_t getNumVertices() const { return vertices.size(); }
+};
+
+// Lee precios "precioMesa precioSilla" por línea (archivo o "-" para la entrada
+// estándar), escribe el plan cada vez que cambia y al final las latencias por precio
+void procesarFlujoPrecios(const std::string &archivoSesion, const std::string &archivoPrecios);
+
+// Compara la reoptimización incremental con resolver de nuevo en cada precio
+void ejecutarBenchmarkPrecios(size_t precios = 1000000);
+
+// ===== FRONTERA DE PARETO =====
+// Varios objetivos lineales sobre el mismo polígono factible (por ejemplo,
+// ganancia contra horas de trabajo y consumo de pintura). En dos variables
+// los planes eficientes son vértices y lados del polígono (o el polígono
+// entero): cada uno se prueba con un subproblema de pesos independiente.
+
+// Objetivo lineal sobre mesas y sillas
+struct ObjetivoProduccion
+{
+    std::string nombre;   // Nombre para los reportes
+    double coeficienteX1; // Por mesa
+    double coeficienteX2; // Por silla
+    bool maximizar;       // false = minimizar
+
+    // Constructor
+    ObjetivoProduccion(const std::string &nombre, double x1, double x2, bool maximizar = true)
+        : nombre(nombre), coeficienteX1(x1), coeficienteX2(x2), maximizar(maximizar) {}
+
+    double evaluar(double x1, double x2) const { return coeficienteX1 * x1 + coeficienteX2 * x2; }
+};
+
+// Cara eficiente del polígono: un vértice, un lado o el polígono completo
+struct CaraPareto
+{
+    int dimension;                                 // 0 = vértice, 1 = lado, 2 = polígono
+    size_t indice;                                 // Primer vértice en el orden del polígono
+    std::vector<std::pair<double, double>> puntos; // Vértices de la cara
+    std::vector<double> valores;                   // Objetivos en cada vértice, uno tras otro
+    std::vector<double> pesos;                     // Pesos > 0 con los que la cara es óptima
+};
+
+// Frontera completa: caras ordenadas por dimensión y por posición en el polígono
+struct FronteraPareto
+{
+    std::vector<std::pair<double, double>> poligono; // Vértices factibles en sentido antihorario
+    std::vector<CaraPareto> caras;
+    size_t subproblemas; // Subproblemas de pesos resueltos
+
+    // Constructor
+    FronteraPareto() : subproblemas(0) {}
+};
+
+/**
+ * Calcula la frontera de Pareto exacta para 2 o 3 objetivos. Los
+ * subproblemas se reparten en el planificador y cada cara eficiente se
+ * entrega a alDescubrir apenas se confirma (en el orden en que terminan,
+ * de a una por vez).
+ */
+FronteraPareto calcularFronteraPareto(const std::vector<Restriccion> &restricciones,
+                                      const std::vector<ObjetivoProduccion> &objetivos,
+                                      PlanificadorRobo &planificador,
+                                      const std::function<void(const CaraPareto &)> &alDescubrir = nullptr);
+
+// Frontera de la sesión guardada: ganancia contra el uso de sus dos primeras restricciones "<="
+void mostrarFronteraSesion(const std::string &archivoSesion);
+
+void ejecutarBenchmarkPareto();
+
+// ===== OBJETIVOS JERÁRQUICOS Y METAS =====
+// Varios objetivos en orden de prioridad: primero la mayor ganancia, luego
+// las menores horas extra entre los planes de ganancia máxima, etc. Cada
+// etapa fija el óptimo de la anterior como fila y sigue desde la misma base.
+
+// Objetivo de una etapa sobre las variables de un ModeloLineal
+struct ObjetivoJerarquico
+{
+    std::string nombre;
+    std::vector<std::pair<int, double>> coeficientes; // (variable, coeficiente)
+    bool maximizar;                                   // false = minimizar
+    double holgura; // Pérdida relativa que se admite al fijar este óptimo (0 = exacto)
+
+    // Constructor
+    ObjetivoJerarquico(const std::string &nombre, const std::vector<std::pair<int, double>> &coeficientes,
+                       bool maximizar = true, double holgura = 0.0)
+        : nombre(nombre), coeficientes(coeficientes), maximizar(maximizar), holgura(holgura) {}
+};
+
+// Meta con variables de desviación: a·x - exceso + defecto = valor
+struct MetaLineal
+{
+    std::string nombre;
+    std::vector<std::pair<int, double>> coeficientes;
+    std::string operador; // "<=" penaliza el exceso, ">=" el defecto, "=" ambos
+    double valor;         // Nivel de la meta
+    int prioridad;        // 1 = la más importante; las de igual prioridad se suman
+    double peso;          // Peso dentro de su prioridad
+
+    // Constructor
+    MetaLineal(const std::string &nombre, const std::vector<std::pair<int, double>> &coeficientes,
+               const std::string &operador, double valor, int prioridad = 1, double peso = 1.0)
+        : nombre(nombre), coeficientes(coeficientes), operador(operador), valor(valor), prioridad(prioridad),
+          peso(peso) {}
+};
+
+// Resultado de una etapa
+struct EtapaLexicografica
+{
+    std::string nombre;
+    EstadoLP estado;
+    double valor;     // Valor óptimo del objetivo de la etapa
+    long iteraciones; // Iteraciones del símplex en la etapa
+    double segundos;
+};
+
+struct ResultadoLexicografico
+{
+    EstadoLP estado;                        // LP_OPTIMO si todas las etapas lo fueron
+    std::vector<EtapaLexicografica> etapas; // Hasta la primera que no fue óptima
+    std::vector<double> valores;            // Variables del modelo en la última etapa resuelta
+    long iteraciones;
+
+    // Constructor
+    ResultadoLexicografico() : estado(LP_SIN_RESOLVER), iteraciones(0) {}
+};
+
+// Agrega al modelo las variables de desviación y las filas de las metas.
+// Devuelve un objetivo por prioridad (de la más importante a la menos):
+// minimizar la suma ponderada de las desviaciones penalizadas.
+std::vector<ObjetivoJerarquico> agregarMetas(ModeloLineal &modelo, const std::vector<MetaLineal> &metas);
+
+// Resuelve los objetivos en orden; el objetivo propio del modelo se ignora
+ResultadoLexicografico resolverLexicografico(const ModeloLineal &modelo,
+                                             const std::vector<ObjetivoJerarquico> &objetivos,
+                                             const OpcionesSimplex &opciones = OpcionesSimplex(),
+                                             const TokenCancelacion *token = nullptr);
+
+void ejecutarBenchmarkLexicografico();
+
+// ===== OPTIMIZACIÓN ROBUSTA =====
+// Los coeficientes de las filas (horas por mesa, por silla, ...) son
+// estimaciones. La contraparte robusta exige que cada fila se cumpla para
+// cualquier desviación dentro del conjunto de incertidumbre, reformulada
+// como un modelo lineal compacto (sin enumerar escenarios).
+
+// Incertidumbre de una fila: cada a_j puede moverse en [a_j - â_j, a_j + â_j]
+// y a lo sumo "presupuesto" coeficientes a la vez (Bertsimas-Sim). Un
+// presupuesto mayor o igual a la cantidad de coeficientes inciertos es la caja.
+struct IncertidumbreFila
+{
+    int fila;
+    std::vector<std::pair<int, double>> desviaciones; // (variable, â_j >= 0)
+    double presupuesto;                               // Γ (INFINITO_LP = caja)
+
+    // Constructor
+    IncertidumbreFila(int fila, const std::vector<std::pair<int, double>> &desviaciones,
+                      double presupuesto = INFINITO_LP)
+        : fila(fila), desviaciones(desviaciones), presupuesto(presupuesto) {}
+};
+
+// Modelo robusto equivalente: las variables originales conservan sus índices
+// (los primeros valores de la solución son el plan) y se agregan las auxiliares
+// de la forma dual de cada presupuesto.
+ModeloLineal construirContraparteRobusta(const ModeloLineal &modelo,
+                                         const std::vector<IncertidumbreFila> &incertidumbre);
+
+struct ResultadoRobusto
+{
+    EstadoLP estado;
+    std::vector<double> valores; // Plan (variables del modelo original)
+    double objetivo;             // Valor del objetivo lineal del modelo en el plan
+    long iteraciones;
+    int rondas;                  // Resoluciones hasta que ningún lado incumple su peor caso
+    size_t filasProteccion;      // Cortes s + Σ u_j·â_j·σ_j·x_j <= b que hicieron falta
+    size_t filasPosibles;        // Filas de protección de la contraparte completa
+
+    // Constructor
+    ResultadoRobusto()
+        : estado(LP_SIN_RESOLVER), objetivo(0.0), iteraciones(0), rondas(0), filasProteccion(0), filasPosibles(0) {}
+};
+
+// Resuelve la misma contraparte con cortes del peor caso sobre el modelo
+// original, agregados solo cuando la solución los incumple (arranque en caliente)
+ResultadoRobusto resolverRobusto(const ModeloLineal &modelo, const std::vector<IncertidumbreFila> &incertidumbre,
+                                 const OpcionesSimplex &opciones = OpcionesSimplex(),
+                                 const TokenCancelacion *token = nullptr);
+
+// Cada coeficiente no nulo de cada fila varía ±fraccion de su valor
+std::vector<IncertidumbreFila> incertidumbreRelativa(const ModeloLineal &modelo, double fraccion,
+                                                     double presupuesto = INFINITO_LP);
+
+void ejecutarBenchmarkRobusto();
+
+// ===== DEMANDA ESTOCÁSTICA (DOS ETAPAS) =====
+// La producción de mesas y sillas se decide antes de conocer la demanda
+// (primera etapa); las ventas se deciden en cada escenario de demanda
+// (segunda etapa). Lo que no se vende se rescata a menor valor y la demanda
+// que no se atiende tiene una penalización.
+
+struct EscenarioDemanda
+{
+    double probabilidad;
+    double demandaMesas;
+    double demandaSillas;
+
+    // Constructor
+    EscenarioDemanda(double probabilidad, double demandaMesas, double demandaSillas)
+        : probabilidad(probabilidad), demandaMesas(demandaMesas), demandaSillas(demandaSillas) {}
+};
+
+// Los precios de 'produccion' son por unidad vendida
+struct ModeloEstocastico
+{
+    ModeloProduccion produccion;
+    double costoMesa, costoSilla;               // Costo por unidad producida
+    double rescateMesa, rescateSilla;           // Valor de cada unidad no vendida
+    double penalizacionMesa, penalizacionSilla; // Costo por unidad de demanda no atendida
+    std::vector<EscenarioDemanda> escenarios;   // Probabilidades que suman 1
+
+    // Constructor
+    ModeloEstocastico()
+        : costoMesa(0.0), costoSilla(0.0), rescateMesa(0.0), rescateSilla(0.0), penalizacionMesa(0.0),
+          penalizacionSilla(0.0) {}
+};
+
+struct OpcionesCoberturaProgresiva
+{
+    double multiplicadorRho; // ρ_j = multiplicador · |costo marginal de x_j| / rango inicial de x_j
+    double tolerancia;       // Σ p_s·|x_s - x̄| relativo a |x̄| para terminar
+    int maxIteraciones;
+
+    // Constructor
+    OpcionesCoberturaProgresiva() : multiplicadorRho(3.0), tolerancia(1e-5), maxIteraciones(1000) {}
+};
+
+struct PlanEstocastico
+{
+    SolucionOptima produccion; // Plan de primera etapa; gananciaMaxima = ganancia esperada
+    double cotaEsperaVer;      // Σ p_s · óptimo con la demanda conocida (cota superior)
+    double residuo;            // Σ p_s·|x_s - x̄| relativo al terminar
+    int iteraciones;
+    bool convergio;
+
+    // Constructor
+    PlanEstocastico() : cotaEsperaVer(0.0), residuo(0.0), iteraciones(0), convergio(false) {}
+};
+
+// Ganancia esperada de una producción fija con las mejores ventas de cada escenario
+double evaluarPlanEstocastico(const ModeloEstocastico &modelo, double mesas, double sillas);
+
+// Equivalente determinista: un único modelo lineal con las ventas de todos los escenarios
+PlanEstocastico resolverEquivalenteDeterminista(const ModeloEstocastico &modelo);
+
+// Cobertura progresiva (Rockafellar-Wets): cada escenario se resuelve por
+// separado, en paralelo, con un precio w_s y un término ρ/2·|x - x̄|² que
+// acercan su producción al promedio x̄. Cada subproblema arranca desde su
+// solución de la iteración anterior.
+PlanEstocastico resolverCoberturaProgresiva(const ModeloEstocastico &modelo, PlanificadorRobo &planificador,
+                                            const OpcionesCoberturaProgresiva &opciones = OpcionesCoberturaProgresiva(),
+                                            const TokenCancelacion *token = nullptr);
+
+void ejecutarBenchmarkEstocastico(size_t escenarios = 5000);
+
+// ===== VERIFICACIÓN DEL MODELO COMPLETO =====
+// Revisa todas las filas de una vez antes de resolver: números no finitos,
+// filas vacías u operadores inválidos, pares de filas paralelas que se
+// contradicen y, con propagación de cotas sobre x₁, x₂ >= 0, modelos que
+// no pueden tener puntos factibles. Informa todos los problemas juntos.
+
+enum TipoProblemaModelo
+{
+    PROBLEMA_PRECIO,                // Precio no positivo o no finito
+    PROBLEMA_VALOR_NO_FINITO,       // NaN o infinito en una restricción
+    PROBLEMA_COEFICIENTES_NULOS,    // Ambos coeficientes en cero
+    PROBLEMA_OPERADOR,              // Operador distinto de <=, >=, =
+    PROBLEMA_FILAS_CONTRADICTORIAS, // Dos filas paralelas sin puntos en común
+    PROBLEMA_INFACTIBLE             // Las cotas deducidas de x₁ o x₂ se cruzan
+};
+
+struct ProblemaModelo
+{
+    TipoProblemaModelo tipo;
+    int fila;                // Posición de la restricción (-1 para los precios)
+    int otraFila;            // Segunda restricción involucrada o -1
+    std::string descripcion; // Mensaje para el usuario (filas numeradas desde 1)
+};
+
+struct DiagnosticoModelo
+{
+    std::vector<ProblemaModelo> problemas;
+    double inferiorX1, superiorX1; // Cotas deducidas por la propagación
+    double inferiorX2, superiorX2;
+    int pasadas;                   // Pasadas de propagación sobre todas las filas
+
+    // Constructor
+    DiagnosticoModelo()
+        : inferiorX1(0.0), superiorX1(INFINITO_LP), inferiorX2(0.0), superiorX2(INFINITO_LP), pasadas(0) {}
+
+    bool esValido() const { return problemas.empty(); }
+};
+
+// detenerEnPrimero corta en el primer problema (para rechazar rápido en los lotes)
+DiagnosticoModelo diagnosticarModelo(const std::vector<Restriccion> &restricciones, double precioMesa,
+                                     double precioSilla, bool detenerEnPrimero = false);
+void mostrarDiagnosticoModelo(const DiagnosticoModelo &diagnostico);
+
+void ejecutarBenchmarkVerificacion(size_t modelos = 2000);
+
+// ===== REPORTES =====
+
+enum FormatoReporte
+{
+    REPORTE_TEXTO,
+    REPORTE_CSV,
+    REPORTE_JSON
+};
+
+// Escritor de reportes con buffer propio: los números se formatean con
+// std::to_chars directamente en el buffer y el texto llega al destino en
+// bloques grandes, sin vaciar el flujo en cada línea.
+class EscritorReporte
+{
+private:
+    std::ostream &destino;
+    std::vector<char> buffer;
+    size_t usado;
+    unsigned long long bytesEscritos;
+
+    void asegurarEspacio(size_t bytes);
+
+public:
+    // Constructor
+    explicit EscritorReporte(std::ostream &destino, size_t capacidad = 64 * 1024);
+    // Destructor: envía lo que quede en el buffer
+    ~EscritorReporte();
+    EscritorReporte(const EscritorReporte &) = delete;
+    EscritorReporte &operator=(const EscritorReporte &) = delete;
+
+    void escribir(const char *texto);
+    void escribir(const std::string &texto);
+    void escribirCaracter(char c);
+    void escribirRepetido(char c, size_t veces);
+    void escribirNumero(double numero, int decimales = 2);
+    void escribirEntero(long long numero);
+    void escribirCadenaJson(const std::string &texto); // Entre comillas y con escapes
+    void nuevaLinea() { escribirCaracter('\n'); }
+    void vaciar();
+
+    unsigned long long getBytesEscritos() const { return bytesEscritos + usado; }
+};
+
+// Formatea con decimales fijos en destino (sin terminador); devuelve la longitud
+size_t formatearDecimal(char *destino, size_t capacidad, double numero, int decimales);
+
+// Restricción como texto: "4.00x₁ + 3.00x₂ <= 240.00"
+void escribirExpresionRestriccion(EscritorReporte &escritor, const Restriccion &restriccion);
+
+// Reporte de restricciones con su actividad y holgura en el punto de la solución
+void escribirReporteRestricciones(EscritorReporte &escritor, const std::vector<Restriccion> &restricciones,
+                                  const SolucionOptima &solucion, FormatoReporte formato);
+FormatoReporte interpretarFormatoReporte(const std::string &nombre);
+
+// Genera el reporte de la sesión guardada en una instantánea
+void exportarReporteSesion(const std::string &archivoSesion, const std::string &formato, const std::string &archivoSalida);
+
+// Mide la velocidad de escritura de un reporte grande en cada formato
+void ejecutarBenchmarkReporte(size_t filas = 1000000);
+
 // Funciones globales para manejo de entrada
 double solicitarNumeroReal(const std::string &mensaje);
 int solicitarNumeroEntero(const std::string &mensaje);
 void mostrarMensajeError(const std::string &mensaje);
 void mostrarMensajeExito(const std::string &mensaje);
+void mostrarMensajeInfo(const std::string &mensaje);
+bool solicitarConfirmacion(const std::string &mensaje);
 
 #endif // OPTIMIZACION_H
\ No newline at end of file
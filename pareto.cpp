@@ -0,0 +1,478 @@
+/**
+ * MÓDULO DE FRONTERA DE PARETO
+ * Calcula los planes eficientes cuando hay dos o tres objetivos lineales
+ * (ganancia, horas de trabajo, consumo de pintura, ...). Con dos variables
+ * de decisión, las caras eficientes son vértices y lados del polígono
+ * factible, o el polígono entero; cada cara se prueba con un subproblema
+ * de pesos independiente que resuelve el método símplex
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <mutex>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+static const double TOL_PESO = 1e-9;       // Peso mínimo para considerar eficiente una cara
+static const double TOL_DIRECCION = 1e-12; // Direcciones que no cambian ningún objetivo
+
+// Subproblema de una cara: direcciones hacia las que ningún peso debe mejorar
+struct PruebaCara
+{
+    int dimension;
+    size_t indice;
+    vector<pair<double, double>> puntos;
+    vector<pair<double, double>> sinMejora; // Σ w·c·d <= 0
+    vector<pair<double, double>> sinCambio; // Σ w·c·d = 0
+};
+
+/**
+ * Busca pesos w > 0 con Σw = 1 tales que la cara sea óptima para Σ w_k·f_k
+ * (los objetivos a minimizar entran con signo opuesto). Maximiza el menor
+ * peso t: la cara es eficiente si y solo si t > 0 (teorema de Isermann).
+ * @return true si la cara es eficiente; en pesos quedan los encontrados
+ */
+static bool probarCara(const PruebaCara &prueba, const vector<ObjetivoProduccion> &objetivos, vector<double> &pesos)
+{
+    int k = static_cast<int>(objetivos.size());
+    ModeloLineal modelo;
+    for (int o = 0; o < k; o++)
+        modelo.agregarVariable(0.0, 0.0, 1.0);
+    int menor = modelo.agregarVariable(1.0, 0.0, 1.0);
+
+    vector<pair<int, double>> fila;
+    for (int o = 0; o < k; o++)
+    {
+        fila.assign({make_pair(o, 1.0), make_pair(menor, -1.0)});
+        modelo.agregarFila(fila, ">=", 0.0);
+    }
+    fila.clear();
+    for (int o = 0; o < k; o++)
+        fila.push_back(make_pair(o, 1.0));
+    modelo.agregarFila(fila, "=", 1.0);
+
+    // Cada dirección se escala por su mayor coeficiente
+    auto agregarDireccion = [&](const pair<double, double> &d, const char *operador)
+    {
+        fila.clear();
+        double escala = 0.0;
+        for (int o = 0; o < k; o++)
+        {
+            double cambio = objetivos[o].evaluar(d.first, d.second) * (objetivos[o].maximizar ? 1.0 : -1.0);
+            fila.push_back(make_pair(o, cambio));
+            escala = max(escala, abs(cambio));
+        }
+        if (escala < TOL_DIRECCION)
+            return;
+        for (auto &coeficiente : fila)
+            coeficiente.second /= escala;
+        modelo.agregarFila(fila, operador, 0.0);
+    };
+    for (const auto &d : prueba.sinMejora)
+        agregarDireccion(d, "<=");
+    for (const auto &d : prueba.sinCambio)
+        agregarDireccion(d, "=");
+
+    ResolvedorSimplex simplex;
+    simplex.cargar(modelo);
+    if (simplex.resolver() != LP_OPTIMO || simplex.getValorObjetivo() <= TOL_PESO)
+        return false;
+
+    pesos.assign(k, 0.0);
+    for (int o = 0; o < k; o++)
+        pesos[o] = simplex.getValor(o);
+    return true;
+}
+
+static pair<double, double> diferencia(const pair<double, double> &a, const pair<double, double> &b)
+{
+    return make_pair(a.first - b.first, a.second - b.second);
+}
+
+/**
+ * Arma un subproblema por vértice, por lado y otro para el polígono entero,
+ * y los resuelve en paralelo. El polígono es convexo, así que una cara es
+ * óptima para unos pesos si ninguna arista que sale de ella mejora el objetivo
+ * ponderado.
+ */
+FronteraPareto calcularFronteraPareto(const vector<Restriccion> &restricciones,
+                                      const vector<ObjetivoProduccion> &objetivos, PlanificadorRobo &planificador,
+                                      const function<void(const CaraPareto &)> &alDescubrir)
+{
+    TRAZA_AMBITO("pareto.frontera", "calculo");
+    if (objetivos.size() < 2 || objetivos.size() > 3)
+    {
+        throw invalid_argument("La frontera de Pareto admite 2 o 3 objetivos, no " + to_string(objetivos.size()));
+    }
+
+    FronteraPareto frontera;
+    frontera.poligono = calcularPoligonoFactible(restricciones);
+    const vector<pair<double, double>> &v = frontera.poligono;
+    size_t n = v.size();
+    if (n == 0)
+    {
+        return frontera;
+    }
+
+    vector<PruebaCara> pruebas;
+    for (size_t i = 0; i < n; i++)
+    {
+        PruebaCara vertice;
+        vertice.dimension = 0;
+        vertice.indice = i;
+        vertice.puntos.push_back(v[i]);
+        if (n >= 2)
+            vertice.sinMejora.push_back(diferencia(v[(i + 1) % n], v[i]));
+        if (n >= 3)
+            vertice.sinMejora.push_back(diferencia(v[(i + n - 1) % n], v[i]));
+        pruebas.push_back(vertice);
+    }
+    size_t numLados = n >= 3 ? n : n - 1;
+    for (size_t i = 0; i < numLados; i++)
+    {
+        size_t j = (i + 1) % n;
+        PruebaCara lado;
+        lado.dimension = 1;
+        lado.indice = i;
+        lado.puntos.push_back(v[i]);
+        lado.puntos.push_back(v[j]);
+        lado.sinCambio.push_back(diferencia(v[j], v[i]));
+        if (n >= 3)
+        {
+            lado.sinMejora.push_back(diferencia(v[(i + n - 1) % n], v[i]));
+            lado.sinMejora.push_back(diferencia(v[(j + 1) % n], v[j]));
+        }
+        pruebas.push_back(lado);
+    }
+    if (n >= 3)
+    {
+        PruebaCara poligono;
+        poligono.dimension = 2;
+        poligono.indice = 0;
+        poligono.puntos = v;
+        poligono.sinCambio.push_back(make_pair(1.0, 0.0));
+        poligono.sinCambio.push_back(make_pair(0.0, 1.0));
+        pruebas.push_back(poligono);
+    }
+
+    vector<CaraPareto> caras(pruebas.size());
+    vector<char> eficiente(pruebas.size(), 0);
+    mutex mtxEntrega;
+
+    planificador.ejecutar(pruebas.size(), [&](size_t t, unsigned)
+                          {
+        const PruebaCara &prueba = pruebas[t];
+        CaraPareto &cara = caras[t];
+        if (!probarCara(prueba, objetivos, cara.pesos))
+            return;
+
+        cara.dimension = prueba.dimension;
+        cara.indice = prueba.indice;
+        cara.puntos = prueba.puntos;
+        for (const auto &punto : cara.puntos)
+        {
+            for (const auto &objetivo : objetivos)
+                cara.valores.push_back(objetivo.evaluar(punto.first, punto.second));
+        }
+        eficiente[t] = 1;
+
+        if (alDescubrir)
+        {
+            lock_guard<mutex> bloqueo(mtxEntrega);
+            alDescubrir(cara);
+        } });
+
+    // Las pruebas ya están en orden: vértices, lados y el polígono
+    frontera.subproblemas = pruebas.size();
+    for (size_t t = 0; t < pruebas.size(); t++)
+    {
+        if (eficiente[t])
+            frontera.caras.push_back(move(caras[t]));
+    }
+    return frontera;
+}
+
+// "Ganancia 4100.00, Uso de carpintería 240.00" para el vértice p de la cara
+static string describirValores(const CaraPareto &cara, size_t p, const vector<ObjetivoProduccion> &objetivos)
+{
+    ostringstream texto;
+    texto << fixed << setprecision(2);
+    for (size_t o = 0; o < objetivos.size(); o++)
+    {
+        texto << (o ? ", " : "") << objetivos[o].nombre << " " << cara.valores[p * objetivos.size() + o];
+    }
+    return texto.str();
+}
+
+static string describirCara(const CaraPareto &cara, const vector<ObjetivoProduccion> &objetivos)
+{
+    ostringstream texto;
+    texto << fixed << setprecision(2);
+    if (cara.dimension == 0)
+    {
+        texto << "Vértice (" << cara.puntos[0].first << ", " << cara.puntos[0].second
+              << "): " << describirValores(cara, 0, objetivos);
+    }
+    else if (cara.dimension == 1)
+    {
+        texto << "Lado (" << cara.puntos[0].first << ", " << cara.puntos[0].second << ") - ("
+              << cara.puntos[1].first << ", " << cara.puntos[1].second << ")";
+    }
+    else
+    {
+        texto << "Todo el polígono factible (" << cara.puntos.size() << " vértices)";
+    }
+
+    texto << setprecision(3) << " [pesos";
+    for (double peso : cara.pesos)
+        texto << " " << peso;
+    texto << "]";
+    return texto.str();
+}
+
+/**
+ * Muestra la frontera de la sesión guardada: ganancia (a maximizar) contra el
+ * uso de las dos primeras restricciones "<=" (a minimizar), por ejemplo horas
+ * de carpintería y de pintura. Las caras se muestran a medida que se confirman.
+ * @param archivoSesion Instantánea con el modelo
+ */
+void mostrarFronteraSesion(const string &archivoSesion)
+{
+    ModeloProduccion modelo;
+    {
+        InstantaneaMapeada instantanea(archivoSesion);
+        modelo = instantanea.obtenerModelo();
+    }
+
+    vector<ObjetivoProduccion> objetivos;
+    objetivos.push_back(ObjetivoProduccion("Ganancia", modelo.precioMesa, modelo.precioSilla));
+    for (size_t i = 0; i < modelo.restricciones.size() && objetivos.size() < 3; i++)
+    {
+        const Restriccion &r = modelo.restricciones[i];
+        if (r.operador == "<=")
+        {
+            objetivos.push_back(
+                ObjetivoProduccion("Uso de la restricción " + to_string(i + 1), r.coeficienteX1, r.coeficienteX2, false));
+        }
+    }
+    if (objetivos.size() < 2)
+    {
+        throw runtime_error("La sesión no tiene restricciones \"<=\" para comparar con la ganancia");
+    }
+
+    cout << "\nObjetivos: ";
+    for (size_t o = 0; o < objetivos.size(); o++)
+        cout << (o ? ", " : "") << objetivos[o].nombre << (objetivos[o].maximizar ? " (máx)" : " (mín)");
+    cout << "\nCaras eficientes a medida que se confirman:" << endl;
+
+    PlanificadorRobo planificador;
+    FronteraPareto frontera = calcularFronteraPareto(modelo.restricciones, objetivos, planificador,
+                                                     [&](const CaraPareto &cara)
+                                                     { cout << "  + " << describirCara(cara, objetivos) << endl; });
+
+    if (frontera.caras.empty())
+    {
+        mostrarMensajeError("El modelo no tiene puntos factibles.");
+        return;
+    }
+
+    cout << "\nFrontera de Pareto (" << frontera.caras.size() << " caras de " << frontera.subproblemas
+         << " probadas):" << endl;
+    for (const auto &cara : frontera.caras)
+    {
+        if (cara.dimension == 0)
+            cout << "  • " << describirCara(cara, objetivos) << endl;
+    }
+    for (const auto &cara : frontera.caras)
+    {
+        if (cara.dimension > 0)
+            cout << "  • " << describirCara(cara, objetivos) << endl;
+    }
+}
+
+// true si a es al menos tan bueno como b en todo y mejor en algo
+static bool domina(const vector<double> &a, const vector<double> &b, const vector<ObjetivoProduccion> &objetivos)
+{
+    bool mejorEnAlgo = false;
+    for (size_t o = 0; o < objetivos.size(); o++)
+    {
+        double ventaja = (a[o] - b[o]) * (objetivos[o].maximizar ? 1.0 : -1.0);
+        double tolerancia = 1e-7 * max(1.0, abs(b[o]));
+        if (ventaja < -tolerancia)
+            return false;
+        if (ventaja > tolerancia)
+            mejorEnAlgo = true;
+    }
+    return mejorEnAlgo;
+}
+
+/**
+ * Verifica la frontera contra los vértices del polígono: ningún vértice
+ * eficiente está dominado, y el óptimo de cualquier peso positivo es eficiente.
+ * @return Cantidad de inconsistencias
+ */
+static size_t verificarFrontera(const FronteraPareto &frontera, const vector<ObjetivoProduccion> &objetivos,
+                                size_t muestras)
+{
+    const auto &v = frontera.poligono;
+    vector<vector<double>> valores(v.size());
+    for (size_t i = 0; i < v.size(); i++)
+    {
+        for (const auto &objetivo : objetivos)
+            valores[i].push_back(objetivo.evaluar(v[i].first, v[i].second));
+    }
+    vector<char> eficiente(v.size(), 0);
+    bool todoEficiente = false;
+    for (const auto &cara : frontera.caras)
+    {
+        if (cara.dimension == 0)
+            eficiente[cara.indice] = 1;
+        if (cara.dimension == 2)
+            todoEficiente = true;
+    }
+
+    size_t errores = 0;
+    for (size_t i = 0; i < v.size(); i++)
+    {
+        for (size_t j = 0; j < v.size() && eficiente[i]; j++)
+        {
+            if (domina(valores[j], valores[i], objetivos))
+            {
+                errores++;
+                break;
+            }
+        }
+        if (todoEficiente && !eficiente[i])
+            errores++;
+    }
+
+    mt19937 generador(5);
+    uniform_real_distribution<double> peso(0.01, 1.0);
+    for (size_t s = 0; s < muestras; s++)
+    {
+        vector<double> w(objetivos.size());
+        for (double &p : w)
+            p = peso(generador);
+        size_t mejor = 0;
+        double mejorValor = -numeric_limits<double>::infinity();
+        for (size_t i = 0; i < v.size(); i++)
+        {
+            double valor = 0.0;
+            for (size_t o = 0; o < objetivos.size(); o++)
+                valor += w[o] * valores[i][o] * (objetivos[o].maximizar ? 1.0 : -1.0);
+            if (valor > mejorValor)
+            {
+                mejorValor = valor;
+                mejor = i;
+            }
+        }
+        if (!eficiente[mejor])
+            errores++;
+    }
+    return errores;
+}
+
+/**
+ * Calcula fronteras de 2 y 3 objetivos, compara un hilo contra el
+ * planificador completo y verifica el resultado con pesos al azar
+ */
+void ejecutarBenchmarkPareto()
+{
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: FRONTERA DE PARETO" << endl;
+    cout << string(60, '=') << endl;
+
+    vector<Restriccion> flair;
+    flair.push_back(4 * X1 + 3 * X2 <= 240);
+    flair.push_back(2 * X1 + X2 <= 100);
+    flair.push_back(X2 <= 60);
+
+    // Capacidad curva aproximada por tangentes
+    vector<Restriccion> curva;
+    const int tangentes = 400;
+    const double pi = acos(-1.0);
+    for (int k = 0; k < tangentes; k++)
+    {
+        double angulo = (k + 0.5) * pi / (2 * tangentes);
+        curva.push_back(Restriccion(cos(angulo), sin(angulo), 100.0));
+    }
+
+    struct Caso
+    {
+        const char *nombre;
+        const vector<Restriccion> *restricciones;
+        vector<ObjetivoProduccion> objetivos;
+    };
+    vector<Caso> casos;
+    casos.push_back({"Flair: ganancia, horas de trabajo y pintura", &flair,
+                     {ObjetivoProduccion("Ganancia", 70, 50), ObjetivoProduccion("Horas", 6, 4, false),
+                      ObjetivoProduccion("Pintura", 1.5, 0.5, false)}});
+    casos.push_back({"Flair: ganancia y horas de trabajo", &flair,
+                     {ObjetivoProduccion("Ganancia", 70, 50), ObjetivoProduccion("Horas", 6, 4, false)}});
+    casos.push_back({"Capacidad curva (400 restricciones): mesas y sillas", &curva,
+                     {ObjetivoProduccion("Mesas", 1, 0), ObjetivoProduccion("Sillas", 0, 1)}});
+    casos.push_back({"Capacidad curva: mesas, sillas y costo", &curva,
+                     {ObjetivoProduccion("Mesas", 1, 0), ObjetivoProduccion("Sillas", 0, 1),
+                      ObjetivoProduccion("Costo", 1, 1, false)}});
+
+    PlanificadorRobo secuencial(1);
+    PlanificadorRobo paralelo;
+
+    for (const Caso &caso : casos)
+    {
+        auto inicio = chrono::steady_clock::now();
+        calcularPoligonoFactible(*caso.restricciones);
+        double segundosPoligono = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+        inicio = chrono::steady_clock::now();
+        FronteraPareto unHilo = calcularFronteraPareto(*caso.restricciones, caso.objetivos, secuencial);
+        double segundosUnHilo = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+        size_t entregadas = 0;
+        double primeraEntrega = -1.0;
+        inicio = chrono::steady_clock::now();
+        FronteraPareto frontera = calcularFronteraPareto(*caso.restricciones, caso.objetivos, paralelo,
+                                                         [&](const CaraPareto &)
+                                                         {
+                                                             if (entregadas++ == 0)
+                                                                 primeraEntrega = chrono::duration<double>(
+                                                                                      chrono::steady_clock::now() - inicio)
+                                                                                      .count();
+                                                         });
+        double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+        size_t porDimension[3] = {0, 0, 0};
+        for (const auto &cara : frontera.caras)
+            porDimension[cara.dimension]++;
+
+        cout << "\n"
+             << caso.nombre << ":" << endl;
+        cout << "  • Polígono de " << frontera.poligono.size() << " vértices (" << segundosPoligono * 1000
+             << " ms), " << frontera.subproblemas << " subproblemas" << endl;
+        cout << "  • Eficientes: " << porDimension[0] << " vértices, " << porDimension[1] << " lados"
+             << (porDimension[2] ? ", todo el polígono" : "") << endl;
+        cout << "  • Un hilo: " << segundosUnHilo * 1000 << " ms; " << paralelo.getNumHilos()
+             << " hilos: " << segundos * 1000 << " ms (primera cara a los " << primeraEntrega * 1000 << " ms)"
+             << endl;
+
+        size_t errores = verificarFrontera(frontera, caso.objetivos, 20000);
+        bool iguales = unHilo.caras.size() == frontera.caras.size();
+        for (size_t c = 0; iguales && c < frontera.caras.size(); c++)
+        {
+            iguales = unHilo.caras[c].dimension == frontera.caras[c].dimension &&
+                      unHilo.caras[c].indice == frontera.caras[c].indice;
+        }
+        if (errores > 0 || !iguales || entregadas != frontera.caras.size())
+        {
+            mostrarMensajeError("La frontera no es consistente (" + to_string(errores) + " errores).");
+        }
+    }
+}
@@ -0,0 +1,256 @@
+/**
+ * MÓDULO DE RESTRICCIONES PEREZOSAS
+ * Resuelve modelos con familias enormes de restricciones agregando solo
+ * las que el punto actual viola; cada ronda continúa desde la base
+ * anterior con el símplex dual
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+#include <queue>
+
+using namespace std;
+
+// Cota provisional de las variables mientras ninguna fila limita el modelo
+static const double COTA_ARTIFICIAL = 1e7;
+
+// Violación de una restricción en (x1, x2), escalada por el tamaño de sus coeficientes
+static double medirViolacion(const Restriccion &r, double x1, double x2)
+{
+    double actividad = r.coeficienteX1 * x1 + r.coeficienteX2 * x2;
+    double exceso;
+    if (r.operador == "<=")
+        exceso = actividad - r.valorConstante;
+    else if (r.operador == ">=")
+        exceso = r.valorConstante - actividad;
+    else
+        exceso = abs(actividad - r.valorConstante);
+
+    double tolerancia = 1e-7 * (1.0 + abs(r.valorConstante));
+    if (exceso <= tolerancia)
+    {
+        return 0.0;
+    }
+    return exceso / max(1.0, abs(r.coeficienteX1) + abs(r.coeficienteX2));
+}
+
+/**
+ * Crea un separador que evalúa las filas de una familia generada
+ * @param numFilas Tamaño de la familia
+ * @param generador Devuelve la fila i (debe ser determinista)
+ * @return Separador que devuelve las filas más violadas; solo guarda los
+ *         índices de las candidatas, nunca la familia completa
+ */
+SeparadorRestricciones crearSeparadorPorEnumeracion(size_t numFilas, function<Restriccion(size_t)> generador)
+{
+    return [numFilas, generador](double x1, double x2, vector<Restriccion> &violadas, size_t maximo)
+    {
+        TRAZA_AMBITO("perezosas.separar", "calculo");
+
+        // Montículo de mínimos con las 'maximo' filas más violadas vistas hasta ahora
+        typedef pair<double, size_t> Candidata;
+        priority_queue<Candidata, vector<Candidata>, greater<Candidata>> mejores;
+
+        for (size_t i = 0; i < numFilas; i++)
+        {
+            double violacion = medirViolacion(generador(i), x1, x2);
+            if (violacion <= 0)
+                continue;
+
+            if (mejores.size() < maximo)
+            {
+                mejores.push(make_pair(violacion, i));
+            }
+            else if (violacion > mejores.top().first)
+            {
+                mejores.pop();
+                mejores.push(make_pair(violacion, i));
+            }
+        }
+
+        while (!mejores.empty())
+        {
+            violadas.push_back(generador(mejores.top().second));
+            mejores.pop();
+        }
+    };
+}
+
+/**
+ * Resuelve el modelo base agregando filas perezosas hasta que el separador
+ * no encuentre ninguna violada
+ * @param base Precios y restricciones que siempre están en el modelo
+ * @param separador Rutina que encuentra filas violadas
+ * @param maximoPorRonda Filas que se piden al separador en cada ronda
+ * @param token Cancelación o límite de tiempo (opcional)
+ * @return Solución, estado y estadísticas del proceso
+ */
+ResultadoPerezoso resolverConRestriccionesPerezosas(const ModeloProduccion &base,
+                                                    const SeparadorRestricciones &separador,
+                                                    size_t maximoPorRonda,
+                                                    const TokenCancelacion *token)
+{
+    TRAZA_AMBITO("perezosas.resolver", "calculo");
+
+    if (maximoPorRonda == 0)
+    {
+        throw invalid_argument("El separador debe poder devolver al menos una fila por ronda.");
+    }
+
+    ResultadoPerezoso resultado;
+    ResolvedorSimplex resolvedor;
+    resolvedor.cargar(construirModeloLineal(base));
+
+    // Sin filas que lo limiten el modelo no está acotado y no hay punto que separar
+    resolvedor.cambiarCotasVariable(0, 0.0, COTA_ARTIFICIAL);
+    resolvedor.cambiarCotasVariable(1, 0.0, COTA_ARTIFICIAL);
+
+    vector<Restriccion> violadas;
+    violadas.reserve(maximoPorRonda);
+
+    while (true)
+    {
+        resultado.estado = resolvedor.resolver(token);
+        resultado.iteracionesSimplex += resolvedor.getIteraciones();
+        if (resultado.estado != LP_OPTIMO)
+        {
+            return resultado;
+        }
+
+        double x1 = resolvedor.getValor(0);
+        double x2 = resolvedor.getValor(1);
+
+        violadas.clear();
+        separador(x1, x2, violadas, maximoPorRonda);
+        resultado.rondas++;
+
+        if (violadas.empty())
+        {
+            break;
+        }
+
+        for (const auto &r : violadas)
+        {
+            vector<pair<int, double>> coeficientes = {{0, r.coeficienteX1}, {1, r.coeficienteX2}};
+            double inferior = r.operador == "<=" ? -INFINITO_LP : r.valorConstante;
+            double superior = r.operador == ">=" ? INFINITO_LP : r.valorConstante;
+            resolvedor.agregarFila(coeficientes, inferior, superior);
+        }
+        resultado.restriccionesActivas += violadas.size();
+
+        if (token)
+        {
+            token->verificar();
+        }
+    }
+
+    double x1 = resolvedor.getValor(0);
+    double x2 = resolvedor.getValor(1);
+    if (x1 >= COTA_ARTIFICIAL * (1 - 1e-9) || x2 >= COTA_ARTIFICIAL * (1 - 1e-9))
+    {
+        // Solo lo limita la cota provisional: el modelo real no está acotado
+        resultado.estado = LP_NO_ACOTADO;
+        return resultado;
+    }
+
+    resultado.solucion.x1 = x1;
+    resultado.solucion.x2 = x2;
+    resultado.solucion.gananciaMaxima = resolvedor.getValorObjetivo();
+    resultado.solucion.solucionEncontrada = true;
+    return resultado;
+}
+
+// Coeficiente pseudoaleatorio reproducible en [0, 1)
+static double valorMezclado(size_t semilla)
+{
+    unsigned long long h = semilla * 0x9E3779B97F4A7C15ULL;
+    h ^= h >> 29;
+    h *= 0xBF58476D1CE4E5B9ULL;
+    h ^= h >> 32;
+    return static_cast<double>(h >> 11) / 9007199254740992.0;
+}
+
+/**
+ * Capacidades de una planta: una fila por máquina, turno y mezcla de productos.
+ * La fila i limita las horas de la máquina en ese turno según cuánto usa de
+ * ella cada mesa y cada silla con esa mezcla.
+ */
+static Restriccion filaCapacidad(size_t i)
+{
+    const size_t maquinas = 500;
+    const size_t turnos = 21;
+    size_t maquina = i % maquinas;
+    size_t turno = (i / maquinas) % turnos;
+    size_t mezcla = i / (maquinas * turnos);
+
+    double horasMesa = 1.0 + 4.0 * valorMezclado(maquina) + 0.01 * (mezcla % 50);
+    double horasSilla = 0.5 + 3.0 * valorMezclado(maquina + 7919) + 0.01 * (mezcla % 37);
+    double horasTurno = (turno % 3 == 2 ? 200.0 : 240.0) * (1.0 + valorMezclado(maquina * 31 + turno));
+    return Restriccion(horasMesa, horasSilla, horasTurno);
+}
+
+/**
+ * Compara el modo perezoso con el modelo completo en una familia pequeña
+ * y luego lo ejecuta con millones de filas que no se guardan en memoria
+ * @param filas Tamaño de la familia grande
+ */
+void ejecutarBenchmarkPerezosas(size_t filas)
+{
+    ModeloProduccion base;
+    base.precioMesa = 70.0;
+    base.precioSilla = 50.0;
+
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: RESTRICCIONES PEREZOSAS" << endl;
+    cout << string(60, '=') << endl;
+
+    // Verificación: familia pequeña resuelta también con todas las filas cargadas
+    const size_t filasVerificacion = 2000;
+    ModeloProduccion completo = base;
+    for (size_t i = 0; i < filasVerificacion; i++)
+    {
+        completo.restricciones.push_back(filaCapacidad(i));
+    }
+    auto inicio = chrono::steady_clock::now();
+    ResolvedorSimplex resolvedorCompleto;
+    resolvedorCompleto.cargar(construirModeloLineal(completo));
+    resolvedorCompleto.resolver();
+    double segundosCompleto = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    inicio = chrono::steady_clock::now();
+    ResultadoPerezoso pequeno = resolverConRestriccionesPerezosas(base, crearSeparadorPorEnumeracion(filasVerificacion, filaCapacidad));
+    double segundosPequeno = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    cout << "Familia de " << filasVerificacion << " filas:" << endl;
+    cout << "  • Modelo completo: Z = $" << resolvedorCompleto.getValorObjetivo() << " en "
+         << segundosCompleto * 1000 << " ms" << endl;
+    cout << "  • Perezoso: Z = $" << pequeno.solucion.gananciaMaxima << " en " << segundosPequeno * 1000 << " ms ("
+         << pequeno.restriccionesActivas << " filas activas, " << pequeno.rondas << " rondas)" << endl;
+    if (abs(resolvedorCompleto.getValorObjetivo() - pequeno.solucion.gananciaMaxima) >
+        1e-6 * (1.0 + abs(pequeno.solucion.gananciaMaxima)))
+    {
+        mostrarMensajeError("El modo perezoso no coincide con el modelo completo.");
+    }
+
+    // Familia grande: las filas se generan al separar y nunca se guardan
+    inicio = chrono::steady_clock::now();
+    ResultadoPerezoso grande = resolverConRestriccionesPerezosas(base, crearSeparadorPorEnumeracion(filas, filaCapacidad));
+    double segundosGrande = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    cout << "\nFamilia de " << filas << " filas:" << endl;
+    if (grande.solucion.solucionEncontrada)
+    {
+        cout << "  • Solución: " << grande.solucion.x1 << " mesas, " << grande.solucion.x2 << " sillas, Z = $"
+             << grande.solucion.gananciaMaxima << endl;
+    }
+    else
+    {
+        mostrarMensajeError("No se encontró solución.");
+    }
+    cout << "  • Filas activas: " << grande.restriccionesActivas << " de " << filas << endl;
+    cout << "  • Rondas de separación: " << grande.rondas << ", iteraciones símplex: " << grande.iteracionesSimplex << endl;
+    cout << "  • Tiempo: " << segundosGrande * 1000 << " ms" << endl;
+}
@@ -0,0 +1,482 @@
+/**
+ * MÓDULO DE PLANIFICACIÓN MULTIPERÍODO
+ * Plan semanal de producción y ventas con inventario entre períodos.
+ * Se resuelve como un único modelo lineal o por descomposición de
+ * Dantzig-Wolfe, con los subproblemas de cada bloque de períodos en paralelo
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+static const double TOL_DESCOMPOSICION = 1e-6;
+static const int MAX_RONDAS_DESCOMPOSICION = 1000;
+
+// Valida los datos del modelo antes de construir cualquier formulación
+static void validarModeloMultiperiodo(const ModeloMultiperiodo &modelo)
+{
+    if (modelo.periodos.empty())
+    {
+        throw invalid_argument("El plan multiperíodo no tiene períodos.");
+    }
+    if (modelo.costoInventarioMesa < 0 || modelo.costoInventarioSilla < 0 ||
+        modelo.inventarioInicialMesas < 0 || modelo.inventarioInicialSillas < 0)
+    {
+        throw invalid_argument("Los costos e inventarios iniciales no pueden ser negativos.");
+    }
+    for (const auto &periodo : modelo.periodos)
+    {
+        if (periodo.demandaMesas < 0 || periodo.demandaSillas < 0 || periodo.factorCapacidad < 0)
+        {
+            throw invalid_argument("Las demandas y factores de capacidad no pueden ser negativos.");
+        }
+    }
+}
+
+// Lado derecho de una restricción en un período ("<=" se escala por la capacidad del período)
+static double ladoDerechoPeriodo(const Restriccion &r, const PeriodoPlan &periodo)
+{
+    return r.operador == "<=" ? r.valorConstante * periodo.factorCapacidad : r.valorConstante;
+}
+
+// Agrega las restricciones de producción de un período sobre las variables (mesas, sillas)
+static void agregarRestriccionesPeriodo(ModeloLineal &lineal, const vector<Restriccion> &restricciones,
+                                        const PeriodoPlan &periodo, int varMesas, int varSillas)
+{
+    for (const auto &r : restricciones)
+    {
+        vector<pair<int, double>> coeficientes;
+        if (r.coeficienteX1 != 0)
+            coeficientes.push_back(make_pair(varMesas, r.coeficienteX1));
+        if (r.coeficienteX2 != 0)
+            coeficientes.push_back(make_pair(varSillas, r.coeficienteX2));
+        lineal.agregarFila(coeficientes, r.operador, ladoDerechoPeriodo(r, periodo));
+    }
+}
+
+// Variables de un bloque de períodos [inicio, fin): 0 y 1 son el inventario con
+// el que entra el bloque (mesas, sillas); luego 6 por período: producción,
+// ventas e inventario final de cada producto
+static int variableBloque(int inicio, int t, int k)
+{
+    return 2 + 6 * (t - inicio) + k;
+}
+
+// Modelo lineal de los períodos [inicio, fin) con el inventario de entrada
+// fijo en cero (cada llamador ajusta sus cotas)
+static ModeloLineal construirBloque(const ModeloMultiperiodo &modelo, int inicio, int fin)
+{
+    ModeloLineal lineal;
+    lineal.agregarVariable(0.0, 0.0, 0.0);
+    lineal.agregarVariable(0.0, 0.0, 0.0);
+    for (int t = inicio; t < fin; t++)
+    {
+        const PeriodoPlan &periodo = modelo.periodos[t];
+        lineal.agregarVariable(0.0);
+        lineal.agregarVariable(0.0);
+        lineal.agregarVariable(periodo.precioMesa, 0.0, periodo.demandaMesas);
+        lineal.agregarVariable(periodo.precioSilla, 0.0, periodo.demandaSillas);
+        lineal.agregarVariable(-modelo.costoInventarioMesa);
+        lineal.agregarVariable(-modelo.costoInventarioSilla);
+    }
+
+    for (int t = inicio; t < fin; t++)
+    {
+        int v = variableBloque(inicio, t, 0);
+        agregarRestriccionesPeriodo(lineal, modelo.restricciones, modelo.periodos[t], v, v + 1);
+
+        // Balance de inventario: I(t-1) + producción - ventas - I(t) = 0
+        int anteriorMesas = t == inicio ? 0 : v - 2;
+        int anteriorSillas = t == inicio ? 1 : v - 1;
+        lineal.agregarFila({{anteriorMesas, 1.0}, {v, 1.0}, {v + 2, -1.0}, {v + 4, -1.0}}, "=", 0.0);
+        lineal.agregarFila({{anteriorSillas, 1.0}, {v + 1, 1.0}, {v + 3, -1.0}, {v + 5, -1.0}}, "=", 0.0);
+    }
+    return lineal;
+}
+
+// Copia la solución de un bloque (desde los valores de sus variables) al plan
+static void copiarBloque(const vector<double> &valores, int inicio, int fin, double peso, PlanMultiperiodo &plan)
+{
+    for (int t = inicio; t < fin; t++)
+    {
+        int v = variableBloque(inicio, t, 0);
+        PlanPeriodo &periodo = plan.periodos[t];
+        periodo.mesas += peso * valores[v];
+        periodo.sillas += peso * valores[v + 1];
+        periodo.ventasMesas += peso * valores[v + 2];
+        periodo.ventasSillas += peso * valores[v + 3];
+        periodo.inventarioMesas += peso * valores[v + 4];
+        periodo.inventarioSillas += peso * valores[v + 5];
+    }
+}
+
+static vector<double> valoresResolvedor(const ResolvedorSimplex &resolvedor, int numVariables)
+{
+    vector<double> valores(numVariables);
+    for (int j = 0; j < numVariables; j++)
+    {
+        valores[j] = resolvedor.getValor(j);
+    }
+    return valores;
+}
+
+/**
+ * Resuelve el plan como un único modelo lineal.
+ * Variables por período: producción, ventas e inventario final de cada producto.
+ * @param modelo Datos del plan
+ * @return Plan óptimo (solucionEncontrada = false si no es factible)
+ */
+PlanMultiperiodo resolverMultiperiodoMonolitico(const ModeloMultiperiodo &modelo)
+{
+    TRAZA_AMBITO("multiperiodo.monolitico", "calculo");
+    validarModeloMultiperiodo(modelo);
+
+    const int T = static_cast<int>(modelo.periodos.size());
+    ModeloLineal lineal = construirBloque(modelo, 0, T);
+    lineal.cotaInferior[0] = lineal.cotaSuperior[0] = modelo.inventarioInicialMesas;
+    lineal.cotaInferior[1] = lineal.cotaSuperior[1] = modelo.inventarioInicialSillas;
+
+    ResolvedorSimplex resolvedor;
+    resolvedor.cargar(lineal);
+    EstadoLP estado = resolvedor.resolver();
+
+    PlanMultiperiodo plan;
+    if (estado == LP_NO_ACOTADO)
+    {
+        throw runtime_error("El plan multiperíodo no está acotado.");
+    }
+    if (estado != LP_OPTIMO)
+    {
+        return plan;
+    }
+
+    plan.periodos.assign(T, PlanPeriodo{0.0, 0.0, 0.0, 0.0, 0.0, 0.0});
+    copiarBloque(valoresResolvedor(resolvedor, lineal.getNumVariables()), 0, T, 1.0, plan);
+    plan.gananciaTotal = resolvedor.getValorObjetivo();
+    plan.solucionEncontrada = true;
+    return plan;
+}
+
+// Máxima producción de cada producto en un período, tomada de las filas
+// "<=" o "=" con coeficientes no negativos (a₁·x₁ <= b - a₂·x₂ <= b)
+static void produccionMaximaPeriodo(const vector<Restriccion> &restricciones, const PeriodoPlan &periodo, double maximo[2])
+{
+    maximo[0] = maximo[1] = INFINITO_LP;
+    for (const auto &r : restricciones)
+    {
+        if ((r.operador != "<=" && r.operador != "=") || r.coeficienteX1 < 0 || r.coeficienteX2 < 0)
+        {
+            continue;
+        }
+        double b = ladoDerechoPeriodo(r, periodo);
+        if (r.coeficienteX1 > 0)
+            maximo[0] = min(maximo[0], b / r.coeficienteX1);
+        if (r.coeficienteX2 > 0)
+            maximo[1] = min(maximo[1], b / r.coeficienteX2);
+    }
+}
+
+/**
+ * Resuelve el plan por descomposición de Dantzig-Wolfe con bloques de
+ * períodos consecutivos.
+ *
+ * Subproblema del bloque k: el modelo completo de sus períodos (producción,
+ * ventas e inventario) con el inventario de entrada como variable. Cada
+ * columna del maestro es un plan del bloque; se resume en su ganancia, su
+ * inventario de entrada y su inventario de salida.
+ *
+ * Maestro: una variable λ por columna. Filas: enlace entre bloques
+ * consecutivos (salida del bloque k-1 = entrada del bloque k, 2 por frontera)
+ * y convexidad Σλ = 1 (1 por bloque). Con bloques de un trimestre el maestro
+ * tiene unas pocas filas y casi todo el trabajo queda en los subproblemas,
+ * que se resuelven en paralelo y conservan su base entre rondas.
+ *
+ * @param modelo Datos del plan
+ * @param planificador Hilos para resolver los subproblemas
+ * @param periodosPorBloque Períodos consecutivos de cada subproblema
+ * @return Plan óptimo (solucionEncontrada = false si no es factible)
+ */
+PlanMultiperiodo resolverMultiperiodoDescomposicion(const ModeloMultiperiodo &modelo, PlanificadorRobo &planificador,
+                                                    int periodosPorBloque)
+{
+    TRAZA_AMBITO("multiperiodo.descomposicion", "calculo");
+    validarModeloMultiperiodo(modelo);
+    if (periodosPorBloque < 1)
+    {
+        throw invalid_argument("Cada bloque de la descomposición necesita al menos un período.");
+    }
+
+    const int T = static_cast<int>(modelo.periodos.size());
+    const int B = (T + periodosPorBloque - 1) / periodosPorBloque;
+    PlanMultiperiodo plan;
+
+    auto inicioBloque = [&](int k)
+    { return k * periodosPorBloque; };
+    auto finBloque = [&](int k)
+    { return min(T, (k + 1) * periodosPorBloque); };
+
+    // El inventario de entrada de un bloque no puede superar el inicial más toda
+    // la producción posible hasta ese momento (cota que mantiene acotado al subproblema)
+    vector<double> cotaEntrada(2 * B);
+    double acumulado[2] = {modelo.inventarioInicialMesas, modelo.inventarioInicialSillas};
+    for (int k = 0; k < B; k++)
+    {
+        cotaEntrada[2 * k] = acumulado[0];
+        cotaEntrada[2 * k + 1] = acumulado[1];
+        for (int t = inicioBloque(k); t < finBloque(k); t++)
+        {
+            double maximo[2];
+            produccionMaximaPeriodo(modelo.restricciones, modelo.periodos[t], maximo);
+            if (maximo[0] >= INFINITO_LP || maximo[1] >= INFINITO_LP)
+            {
+                throw runtime_error("La producción del período " + to_string(t + 1) +
+                                    " no está acotada; la descomposición requiere regiones acotadas.");
+            }
+            acumulado[0] += maximo[0];
+            acumulado[1] += maximo[1];
+        }
+    }
+
+    vector<ResolvedorSimplex> subproblemas(B);
+    vector<int> numVariables(B);
+    vector<EstadoLP> estadosSub(B);
+    for (int k = 0; k < B; k++)
+    {
+        ModeloLineal lineal = construirBloque(modelo, inicioBloque(k), finBloque(k));
+        numVariables[k] = lineal.getNumVariables();
+        subproblemas[k].cargar(lineal);
+    }
+
+    // Columnas λ: bloque, plan completo del bloque y su ganancia
+    vector<int> bloqueColumna;
+    vector<vector<double>> valoresColumna;
+    auto salidaBloque = [&](int k, const vector<double> &valores, int producto)
+    { return valores[variableBloque(inicioBloque(k), finBloque(k) - 1, 4 + producto)]; };
+    auto gananciaBloque = [&](int k, const vector<double> &valores)
+    {
+        double ganancia = 0.0;
+        for (int t = inicioBloque(k); t < finBloque(k); t++)
+        {
+            int v = variableBloque(inicioBloque(k), t, 0);
+            ganancia += modelo.periodos[t].precioMesa * valores[v + 2] + modelo.periodos[t].precioSilla * valores[v + 3] -
+                        modelo.costoInventarioMesa * valores[v + 4] - modelo.costoInventarioSilla * valores[v + 5];
+        }
+        return ganancia;
+    };
+
+    // Plan inicial factible: cada bloque recibe el inventario que deja el anterior
+    vector<vector<double>> iniciales(B);
+    for (int k = 0; k < B; k++)
+    {
+        double entrada[2] = {modelo.inventarioInicialMesas, modelo.inventarioInicialSillas};
+        if (k > 0)
+        {
+            entrada[0] = salidaBloque(k - 1, iniciales[k - 1], 0);
+            entrada[1] = salidaBloque(k - 1, iniciales[k - 1], 1);
+        }
+        subproblemas[k].cambiarCotasVariable(0, entrada[0], entrada[0]);
+        subproblemas[k].cambiarCotasVariable(1, entrada[1], entrada[1]);
+        EstadoLP estado = subproblemas[k].resolver();
+        if (estado == LP_INFACTIBLE)
+        {
+            return plan;
+        }
+        if (estado != LP_OPTIMO)
+        {
+            throw runtime_error("El bloque " + to_string(k + 1) + " de la descomposición no terminó correctamente.");
+        }
+        iniciales[k] = valoresResolvedor(subproblemas[k], numVariables[k]);
+        if (k > 0)
+        {
+            subproblemas[k].cambiarCotasVariable(0, 0.0, cotaEntrada[2 * k]);
+            subproblemas[k].cambiarCotasVariable(1, 0.0, cotaEntrada[2 * k + 1]);
+        }
+    }
+
+    // Maestro: filas 2(k-1) y 2(k-1)+1 enlazan los bloques k-1 y k; filas 2(B-1) + k, convexidad
+    ModeloLineal lineal;
+    for (int k = 1; k < B; k++)
+    {
+        lineal.agregarFila({}, "=", 0.0);
+        lineal.agregarFila({}, "=", 0.0);
+    }
+    for (int k = 0; k < B; k++)
+    {
+        lineal.agregarFila({}, "=", 1.0);
+    }
+    ResolvedorSimplex maestro;
+    maestro.cargar(lineal);
+
+    auto agregarColumna = [&](int k, vector<double> valores)
+    {
+        vector<pair<int, double>> columna = {{2 * (B - 1) + k, 1.0}};
+        for (int producto = 0; producto < 2; producto++)
+        {
+            if (k > 0)
+                columna.push_back(make_pair(2 * (k - 1) + producto, -valores[producto]));
+            if (k + 1 < B)
+                columna.push_back(make_pair(2 * k + producto, salidaBloque(k, valores, producto)));
+        }
+        maestro.agregarVariable(gananciaBloque(k, valores), 0.0, INFINITO_LP, columna);
+        bloqueColumna.push_back(k);
+        valoresColumna.push_back(move(valores));
+    };
+
+    for (int k = 0; k < B; k++)
+    {
+        agregarColumna(k, move(iniciales[k]));
+    }
+
+    vector<double> costoReducido(B);
+    vector<vector<double>> propuestas(B);
+    int rondas = 0;
+
+    while (true)
+    {
+        EstadoLP estadoMaestro = maestro.resolver();
+        if (estadoMaestro != LP_OPTIMO)
+        {
+            throw runtime_error("El maestro de la descomposición no terminó correctamente.");
+        }
+
+        double cotaInferior = maestro.getValorObjetivo();
+        if (++rondas > MAX_RONDAS_DESCOMPOSICION)
+        {
+            throw runtime_error("La descomposición no convergió en " + to_string(MAX_RONDAS_DESCOMPOSICION) + " rondas.");
+        }
+
+        // Precios del enlace: el inventario que entra al bloque k vale dual(k) y el que sale, -dual(k+1)
+        vector<double> duales(maestro.getNumFilas());
+        for (int i = 0; i < maestro.getNumFilas(); i++)
+        {
+            duales[i] = maestro.getDual(i);
+        }
+
+        // Subproblemas en paralelo: cada tarea usa solo el resolvedor de su bloque
+        planificador.ejecutar(B, [&](size_t indice, unsigned)
+                              {
+            int k = static_cast<int>(indice);
+            ResolvedorSimplex &sub = subproblemas[k];
+            const double costoInventario[2] = {modelo.costoInventarioMesa, modelo.costoInventarioSilla};
+            for (int producto = 0; producto < 2; producto++)
+            {
+                if (k > 0)
+                    sub.cambiarObjetivo(producto, duales[2 * (k - 1) + producto]);
+                if (k + 1 < B)
+                    sub.cambiarObjetivo(variableBloque(inicioBloque(k), finBloque(k) - 1, 4 + producto),
+                                        -costoInventario[producto] - duales[2 * k + producto]);
+            }
+            estadosSub[k] = sub.resolver();
+            if (estadosSub[k] == LP_OPTIMO)
+            {
+                costoReducido[k] = sub.getValorObjetivo() - duales[2 * (B - 1) + k];
+                propuestas[k] = valoresResolvedor(sub, numVariables[k]);
+            } });
+
+        // Cota superior lagrangiana: maestro + mejoras posibles de cada bloque
+        double cotaSuperior = cotaInferior;
+        int columnasNuevas = 0;
+        for (int k = 0; k < B; k++)
+        {
+            if (estadosSub[k] != LP_OPTIMO)
+            {
+                throw runtime_error("El subproblema del bloque " + to_string(k + 1) + " no terminó correctamente.");
+            }
+            if (costoReducido[k] > 0)
+            {
+                cotaSuperior += costoReducido[k];
+            }
+            if (costoReducido[k] > TOL_DESCOMPOSICION * (1.0 + abs(cotaInferior)))
+            {
+                agregarColumna(k, move(propuestas[k]));
+                columnasNuevas++;
+            }
+        }
+
+        if (columnasNuevas == 0 || cotaSuperior - cotaInferior <= TOL_DESCOMPOSICION * (1.0 + abs(cotaInferior)))
+        {
+            break;
+        }
+    }
+
+    // Cada bloque es la combinación convexa de sus columnas
+    plan.periodos.assign(T, PlanPeriodo{0.0, 0.0, 0.0, 0.0, 0.0, 0.0});
+    for (size_t j = 0; j < bloqueColumna.size(); j++)
+    {
+        int k = bloqueColumna[j];
+        double lambda = maestro.getValor(static_cast<int>(j));
+        if (lambda > 0)
+        {
+            copiarBloque(valoresColumna[j], inicioBloque(k), finBloque(k), lambda, plan);
+        }
+    }
+
+    plan.gananciaTotal = maestro.getValorObjetivo();
+    plan.solucionEncontrada = true;
+    plan.iteracionesDescomposicion = rondas;
+    return plan;
+}
+
+/**
+ * Compara el modelo monolítico con la descomposición en un horizonte semanal
+ * basado en el caso Flair Furniture (precios y demanda de temporada, semanas
+ * con capacidad reducida y costo de inventario)
+ * @param semanas Número de períodos del horizonte
+ */
+void ejecutarBenchmarkMultiperiodo(unsigned semanas)
+{
+    ModeloMultiperiodo modelo;
+    modelo.restricciones.push_back(Restriccion(4.0, 3.0, 240.0));
+    modelo.restricciones.push_back(Restriccion(2.0, 1.0, 100.0));
+    modelo.restricciones.push_back(Restriccion(0.0, 1.0, 60.0));
+    modelo.restricciones.push_back(Restriccion(1.0, 2.0, 150.0));
+    modelo.restricciones.push_back(Restriccion(3.0, 1.0, 135.0));
+    modelo.costoInventarioMesa = 1.5;
+    modelo.costoInventarioSilla = 0.8;
+    modelo.inventarioInicialMesas = 5.0;
+
+    for (unsigned t = 0; t < semanas; t++)
+    {
+        double temporada = sin(2.0 * 3.14159265358979 * t / 52.0);
+        double factor = (t % 13 == 12) ? 0.6 : 1.0; // Semana de mantenimiento cada trimestre
+        modelo.periodos.push_back(PeriodoPlan(70.0 + 8.0 * temporada, 50.0 - 4.0 * temporada,
+                                              25.0 + 15.0 * temporada + (t % 4), 35.0 - 10.0 * temporada + (t % 3) * 2,
+                                              factor));
+    }
+
+    auto inicio = chrono::steady_clock::now();
+    PlanMultiperiodo monolitico = resolverMultiperiodoMonolitico(modelo);
+    double segundosMonolitico = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    PlanificadorRobo planificador;
+    inicio = chrono::steady_clock::now();
+    PlanMultiperiodo descomposicion = resolverMultiperiodoDescomposicion(modelo, planificador);
+    double segundosDescomposicion = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: PLANIFICACIÓN MULTIPERÍODO" << endl;
+    cout << string(60, '=') << endl;
+    cout << "Períodos: " << semanas << " (" << modelo.restricciones.size() << " restricciones por período)" << endl;
+    cout << "Hilos para subproblemas: " << planificador.getNumHilos() << endl;
+    cout << "\nModelo monolítico:" << endl;
+    cout << "  • Ganancia total: $" << monolitico.gananciaTotal << endl;
+    cout << "  • Tiempo: " << segundosMonolitico * 1000 << " ms" << endl;
+    cout << "\nDescomposición de Dantzig-Wolfe:" << endl;
+    cout << "  • Ganancia total: $" << descomposicion.gananciaTotal << endl;
+    cout << "  • Rondas: " << descomposicion.iteracionesDescomposicion << endl;
+    cout << "  • Tiempo: " << segundosDescomposicion * 1000 << " ms" << endl;
+    if (segundosDescomposicion > 0)
+    {
+        cout << "\nAceleración: " << segundosMonolitico / segundosDescomposicion << "x" << endl;
+    }
+    if (monolitico.solucionEncontrada != descomposicion.solucionEncontrada ||
+        abs(monolitico.gananciaTotal - descomposicion.gananciaTotal) > 1e-4 * (1.0 + abs(monolitico.gananciaTotal)))
+    {
+        mostrarMensajeError("Los dos métodos no coinciden en la ganancia total.");
+    }
+}
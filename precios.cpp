@@ -0,0 +1,442 @@
+/**
+ * MÓDULO DE FLUJO DE PRECIOS
+ * Reoptimiza el plan de producción cada vez que llega un precio nuevo de
+ * mesas y sillas. Las restricciones no cambian: el polígono factible se
+ * calcula una vez y cada precio solo recorre los vértices vecinos del óptimo
+ * anterior. Se informa el plan solo cuando cambia, junto con las latencias
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <charconv>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+static const double TOL_GANANCIA = 1e-9; // Mejora relativa mínima para cambiar de vértice
+
+// ===== HISTOGRAMA DE LATENCIAS =====
+
+HistogramaLatencia::HistogramaLatencia()
+    : cubetas(SUBDIVISIONES * OCTAVAS, 0), cantidad(0), maximo(0), suma(0.0L)
+{
+}
+
+// Las primeras 16 cubetas son exactas; luego cada potencia de dos se divide en 16
+int HistogramaLatencia::cubeta(unsigned long long nanosegundos)
+{
+    if (nanosegundos < SUBDIVISIONES)
+        return static_cast<int>(nanosegundos);
+
+    int bitAlto = 63;
+    while (!(nanosegundos >> bitAlto))
+        bitAlto--;
+    int octava = bitAlto - 3;
+    int subdivision = static_cast<int>((nanosegundos >> (bitAlto - 4)) & (SUBDIVISIONES - 1));
+    return min(octava * SUBDIVISIONES + subdivision, SUBDIVISIONES * OCTAVAS - 1);
+}
+
+unsigned long long HistogramaLatencia::limiteSuperior(int indice)
+{
+    int octava = indice / SUBDIVISIONES;
+    unsigned long long subdivision = indice % SUBDIVISIONES;
+    if (octava == 0)
+        return subdivision;
+    return ((SUBDIVISIONES + subdivision + 1) << (octava - 1)) - 1;
+}
+
+void HistogramaLatencia::registrar(unsigned long long nanosegundos)
+{
+    cubetas[cubeta(nanosegundos)]++;
+    cantidad++;
+    maximo = max(maximo, nanosegundos);
+    suma += nanosegundos;
+}
+
+unsigned long long HistogramaLatencia::percentil(double fraccion) const
+{
+    if (cantidad == 0)
+        return 0;
+
+    unsigned long long objetivo = static_cast<unsigned long long>(ceil(fraccion * cantidad));
+    objetivo = max(1ULL, min(objetivo, cantidad));
+    unsigned long long acumulado = 0;
+    for (size_t i = 0; i < cubetas.size(); i++)
+    {
+        acumulado += cubetas[i];
+        if (acumulado >= objetivo)
+            return min(limiteSuperior(static_cast<int>(i)), maximo);
+    }
+    return maximo;
+}
+
+// ===== REOPTIMIZACIÓN POR VÉRTICES VECINOS =====
+
+// El polígono factible se calcula una vez; los precios solo eligen el vértice
+ReoptimizadorPrecios::ReoptimizadorPrecios(const vector<Restriccion> &restricciones)
+    : vertices(calcularPoligonoFactible(restricciones)), actual(0), conPrecios(false), precioMesa(0.0),
+      precioSilla(0.0)
+{
+}
+
+/**
+ * Con el vértice anterior como punto de partida, avanza hacia el vecino que
+ * mejora la ganancia hasta que ninguno lo hace. En un polígono convexo la
+ * ganancia sobre los vértices es unimodal, así que el óptimo local es global;
+ * ante precios que cambian poco, el recorrido es de cero o un paso.
+ * La primera llamada evalúa todos los vértices.
+ */
+bool ReoptimizadorPrecios::actualizarPrecios(double nuevoPrecioMesa, double nuevoPrecioSilla)
+{
+    if (vertices.empty())
+        return false;
+
+    bool primera = !conPrecios;
+    conPrecios = true;
+    precioMesa = nuevoPrecioMesa;
+    precioSilla = nuevoPrecioSilla;
+    size_t anterior = actual;
+
+    if (primera)
+    {
+        for (size_t v = 1; v < vertices.size(); v++)
+        {
+            if (ganancia(v) > ganancia(actual))
+                actual = v;
+        }
+        return true;
+    }
+
+    size_t n = vertices.size();
+    double mejor = ganancia(actual);
+    for (size_t pasos = 0; pasos < n; pasos++)
+    {
+        double tolerancia = TOL_GANANCIA * max(1.0, abs(mejor));
+        size_t siguiente = (actual + 1) % n;
+        size_t previo = (actual + n - 1) % n;
+        double gananciaSiguiente = ganancia(siguiente);
+        double gananciaPrevio = ganancia(previo);
+
+        if (gananciaSiguiente > mejor + tolerancia && gananciaSiguiente >= gananciaPrevio)
+        {
+            actual = siguiente;
+            mejor = gananciaSiguiente;
+        }
+        else if (gananciaPrevio > mejor + tolerancia)
+        {
+            actual = previo;
+            mejor = gananciaPrevio;
+        }
+        else
+        {
+            break;
+        }
+    }
+    return actual != anterior;
+}
+
+SolucionOptima ReoptimizadorPrecios::getSolucion() const
+{
+    SolucionOptima solucion;
+    if (vertices.empty())
+        return solucion;
+
+    solucion.x1 = vertices[actual].first;
+    solucion.x2 = vertices[actual].second;
+    solucion.gananciaMaxima = ganancia(actual);
+    solucion.solucionEncontrada = true;
+    return solucion;
+}
+
+// ===== LECTURA DEL FLUJO =====
+
+// Conteos de una corrida del flujo
+struct ResumenFlujo
+{
+    unsigned long long precios;    // Líneas con precios válidos
+    unsigned long long cambios;    // Veces que cambió el plan
+    unsigned long long rechazadas; // Líneas con formato o precios inválidos
+
+    // Constructor
+    ResumenFlujo() : precios(0), cambios(0), rechazadas(0) {}
+};
+
+// Lee un número y avanza el cursor; false si no hay un número válido
+static bool leerNumero(const char *&cursor, const char *fin, double &numero)
+{
+    while (cursor < fin && (*cursor == ' ' || *cursor == '\t' || *cursor == ',' || *cursor == ';'))
+        cursor++;
+    from_chars_result leido = from_chars(cursor, fin, numero);
+    if (leido.ec != errc() || !isfinite(numero))
+        return false;
+    cursor = leido.ptr;
+    return true;
+}
+
+/**
+ * Procesa cada línea "precioMesa precioSilla" (separados por espacios, comas o
+ * punto y coma). Las líneas vacías y las que empiezan con '#' se ignoran.
+ * La latencia de cada precio va desde que se tiene la línea hasta que el plan
+ * nuevo, si lo hay, quedó escrito; el destino se vacía cuando la entrada no
+ * tiene más datos esperando, así un flujo interactivo ve cada plan al instante.
+ */
+static ResumenFlujo procesarLineas(istream &entrada, ReoptimizadorPrecios &reoptimizador, EscritorReporte &escritor,
+                                   HistogramaLatencia &latencias)
+{
+    ResumenFlujo resumen;
+    string linea;
+    unsigned long long numeroLinea = 0;
+
+    while (getline(entrada, linea))
+    {
+        auto inicio = chrono::steady_clock::now();
+        numeroLinea++;
+
+        const char *cursor = linea.data();
+        const char *fin = cursor + linea.size();
+        while (cursor < fin && (*cursor == ' ' || *cursor == '\t' || *cursor == '\r'))
+            cursor++;
+        if (cursor == fin || *cursor == '#')
+            continue;
+
+        double nuevoPrecioMesa, nuevoPrecioSilla;
+        if (!leerNumero(cursor, fin, nuevoPrecioMesa) || !leerNumero(cursor, fin, nuevoPrecioSilla) ||
+            nuevoPrecioMesa <= 0.0 || nuevoPrecioSilla <= 0.0)
+        {
+            resumen.rechazadas++;
+            cerr << "Línea " << numeroLinea << " ignorada: se esperan dos precios positivos" << endl;
+            continue;
+        }
+        resumen.precios++;
+
+        if (reoptimizador.actualizarPrecios(nuevoPrecioMesa, nuevoPrecioSilla))
+        {
+            resumen.cambios++;
+            SolucionOptima plan = reoptimizador.getSolucion();
+            escritor.escribir("precio ");
+            escritor.escribirEntero(static_cast<long long>(numeroLinea));
+            escritor.escribir(": ");
+            escritor.escribirNumero(plan.x1);
+            escritor.escribir(" mesas, ");
+            escritor.escribirNumero(plan.x2);
+            escritor.escribir(" sillas, ganancia $");
+            escritor.escribirNumero(plan.gananciaMaxima);
+            escritor.nuevaLinea();
+        }
+        if (entrada.rdbuf()->in_avail() <= 0)
+            escritor.vaciar();
+
+        latencias.registrar(static_cast<unsigned long long>(
+            chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - inicio).count()));
+    }
+    escritor.vaciar();
+    return resumen;
+}
+
+// Percentiles en microsegundos
+static void mostrarLatencias(ostream &salida, const HistogramaLatencia &latencias)
+{
+    auto microsegundos = [](unsigned long long nanosegundos)
+    { return nanosegundos / 1000.0; };
+    salida << "promedio " << latencias.getPromedio() / 1000.0 << " µs, p50 "
+           << microsegundos(latencias.percentil(0.5)) << ", p90 " << microsegundos(latencias.percentil(0.9))
+           << ", p99 " << microsegundos(latencias.percentil(0.99)) << ", p99.9 "
+           << microsegundos(latencias.percentil(0.999)) << ", máx " << microsegundos(latencias.getMaximo()) << " µs"
+           << endl;
+}
+
+/**
+ * Modo de flujo: toma las restricciones de la sesión guardada y reoptimiza con
+ * cada precio leído. Los planes van a la salida estándar; el resumen y las
+ * líneas rechazadas, a la salida de errores.
+ * @param archivoSesion Instantánea con las restricciones
+ * @param archivoPrecios Archivo de precios, o "-" para la entrada estándar
+ */
+void procesarFlujoPrecios(const string &archivoSesion, const string &archivoPrecios)
+{
+    ModeloProduccion modelo;
+    {
+        InstantaneaMapeada instantanea(archivoSesion);
+        modelo = instantanea.obtenerModelo();
+    }
+    if (modelo.restricciones.empty())
+    {
+        throw runtime_error("La sesión no tiene restricciones: " + archivoSesion);
+    }
+
+    ReoptimizadorPrecios reoptimizador(modelo.restricciones);
+    if (!reoptimizador.esFactible())
+    {
+        throw runtime_error("Las restricciones de la sesión no tienen puntos factibles");
+    }
+
+    ifstream archivo;
+    if (archivoPrecios != "-")
+    {
+        archivo.open(archivoPrecios);
+        if (!archivo)
+        {
+            throw runtime_error("No se pudo abrir el archivo: " + archivoPrecios);
+        }
+    }
+    istream &entrada = archivoPrecios == "-" ? cin : archivo;
+
+    HistogramaLatencia latencias;
+    ResumenFlujo resumen;
+    {
+        EscritorReporte escritor(cout);
+        resumen = procesarLineas(entrada, reoptimizador, escritor, latencias);
+    }
+
+    cerr << fixed << setprecision(2);
+    cerr << "Precios procesados: " << resumen.precios << " (" << resumen.cambios << " cambios de plan, "
+         << resumen.rechazadas << " líneas rechazadas, " << reoptimizador.getNumVertices() << " vértices)" << endl;
+    if (latencias.getCantidad() > 0)
+    {
+        cerr << "Latencia por precio: ";
+        mostrarLatencias(cerr, latencias);
+    }
+}
+
+// ===== BENCHMARK =====
+
+// Precios con variaciones pequeñas y proporcionales (paseo aleatorio geométrico)
+static vector<pair<double, double>> generarPrecios(size_t cantidad, double precioMesa, double precioSilla,
+                                                   unsigned semilla)
+{
+    mt19937 generador(semilla);
+    normal_distribution<double> paso(0.0, 0.003);
+    vector<pair<double, double>> precios;
+    precios.reserve(cantidad);
+    for (size_t i = 0; i < cantidad; i++)
+    {
+        precioMesa *= exp(paso(generador));
+        precioSilla *= exp(paso(generador));
+        precios.push_back(make_pair(precioMesa, precioSilla));
+    }
+    return precios;
+}
+
+/**
+ * Mide la latencia por precio de la reoptimización por vértices vecinos y la
+ * compara con resolver por puntos extremos en cada precio; verifica que ambas
+ * den la misma ganancia. Mide también el flujo completo (lectura de texto,
+ * reoptimización y escritura del plan).
+ * @param precios Cantidad de precios de cada prueba
+ */
+void ejecutarBenchmarkPrecios(size_t precios)
+{
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: REOPTIMIZACIÓN CON UN FLUJO DE PRECIOS" << endl;
+    cout << string(60, '=') << endl;
+
+    ModeloProduccion flair;
+    flair.restricciones.push_back(4 * X1 + 3 * X2 <= 240);
+    flair.restricciones.push_back(2 * X1 + X2 <= 100);
+
+    // Capacidad curva aproximada por tangentes: un polígono con muchos vértices
+    ModeloProduccion curvo;
+    const int tangentes = 120;
+    const double pi = acos(-1.0);
+    for (int k = 0; k < tangentes; k++)
+    {
+        double angulo = (k + 0.5) * pi / (2 * tangentes);
+        curvo.restricciones.push_back(Restriccion(cos(angulo), sin(angulo), 100.0));
+    }
+
+    struct Caso
+    {
+        const char *nombre;
+        const ModeloProduccion *modelo;
+        size_t completos; // Precios que también se resuelven desde cero
+    };
+    const Caso casos[] = {{"Flair (2 restricciones)", &flair, precios},
+                          {"Capacidad curva (120 restricciones)", &curvo, 2000}};
+
+    for (const Caso &caso : casos)
+    {
+        vector<pair<double, double>> serie = generarPrecios(precios, 70.0, 50.0, 7);
+        ReoptimizadorPrecios reoptimizador(caso.modelo->restricciones);
+        HistogramaLatencia incremental, completo;
+        ArenaMonotona arena;
+        unsigned long long cambios = 0, diferencias = 0;
+
+        for (size_t i = 0; i < serie.size(); i++)
+        {
+            auto inicio = chrono::steady_clock::now();
+            if (reoptimizador.actualizarPrecios(serie[i].first, serie[i].second))
+                cambios++;
+            incremental.registrar(static_cast<unsigned long long>(
+                chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - inicio).count()));
+
+            if (i < caso.completos)
+            {
+                inicio = chrono::steady_clock::now();
+                arena.reiniciar();
+                SolucionOptima referencia =
+                    resolverPuntosExtremos(caso.modelo->restricciones, serie[i].first, serie[i].second, &arena);
+                completo.registrar(static_cast<unsigned long long>(
+                    chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - inicio).count()));
+
+                double gananciaIncremental = reoptimizador.getSolucion().gananciaMaxima;
+                if (abs(referencia.gananciaMaxima - gananciaIncremental) >
+                    1e-6 * max(1.0, abs(referencia.gananciaMaxima)))
+                    diferencias++;
+            }
+        }
+
+        cout << "\n"
+             << caso.nombre << ": " << reoptimizador.getNumVertices() << " vértices, " << serie.size()
+             << " precios, " << cambios << " cambios de plan" << endl;
+        cout << "  • Puntos extremos en cada precio (" << completo.getCantidad() << "): ";
+        mostrarLatencias(cout, completo);
+        cout << "  • Vértices vecinos: ";
+        mostrarLatencias(cout, incremental);
+        if (diferencias > 0)
+        {
+            mostrarMensajeError("La reoptimización no coincide con el óptimo en " + to_string(diferencias) +
+                                " precios.");
+        }
+    }
+
+    // Flujo completo sobre texto en memoria: lectura, reoptimización y escritura
+    vector<pair<double, double>> serie = generarPrecios(precios, 70.0, 50.0, 11);
+    string texto;
+    texto.reserve(serie.size() * 16);
+    char numero[64];
+    for (const auto &precio : serie)
+    {
+        texto.append(numero, formatearDecimal(numero, sizeof(numero), precio.first, 4));
+        texto += ' ';
+        texto.append(numero, formatearDecimal(numero, sizeof(numero), precio.second, 4));
+        texto += '\n';
+    }
+    istringstream entrada(texto);
+    ostringstream salida;
+    ReoptimizadorPrecios reoptimizador(curvo.restricciones);
+    HistogramaLatencia latencias;
+    ResumenFlujo resumen;
+    auto inicio = chrono::steady_clock::now();
+    {
+        EscritorReporte escritor(salida);
+        resumen = procesarLineas(entrada, reoptimizador, escritor, latencias);
+    }
+    double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    cout << "\nFlujo de texto con capacidad curva: " << resumen.precios << " precios, " << resumen.cambios
+         << " planes escritos, " << static_cast<long long>(resumen.precios / max(segundos, 1e-9))
+         << " precios/s" << endl;
+    cout << "  • Por precio (lectura a escritura): ";
+    mostrarLatencias(cout, latencias);
+    if (resumen.rechazadas > 0)
+    {
+        mostrarMensajeError("Se rechazaron líneas válidas del flujo.");
+    }
+}
@@ -0,0 +1,633 @@
+/**
+ * MÓDULO DE REDES DE DISTRIBUCIÓN
+ * Flujo de costo mínimo con el símplex de redes y su uso para repartir la
+ * producción de las plantas entre las tiendas
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+
+static const long long INF_RED = CAPACIDAD_ILIMITADA;
+
+int RedFlujo::agregarNodo(long long ofertaNodo)
+{
+    oferta.push_back(ofertaNodo);
+    return getNumNodos() - 1;
+}
+
+int RedFlujo::agregarArco(int origenArco, int destinoArco, double costoArco, long long capacidadArco)
+{
+    if (origenArco < 0 || origenArco >= getNumNodos() || destinoArco < 0 || destinoArco >= getNumNodos())
+    {
+        throw out_of_range("El arco hace referencia a un nodo inexistente.");
+    }
+    if (capacidadArco < 0)
+    {
+        throw invalid_argument("La capacidad de un arco no puede ser negativa.");
+    }
+    if (!isfinite(costoArco))
+    {
+        throw invalid_argument("El costo de un arco debe ser finito.");
+    }
+    arcos.push_back(ArcoRed{origenArco, destinoArco, costoArco, capacidadArco});
+    return getNumArcos() - 1;
+}
+
+// Constructor
+SimplexRedes::SimplexRedes()
+    : numNodos(0), numArcos(0), raiz(0), tolerancia(0.0), siguienteArcoBusqueda(0), tamanoBloque(0), pivoteos(0),
+      estado(LP_SIN_RESOLVER)
+{
+}
+
+void SimplexRedes::desengancharHijo(int nodo)
+{
+    int p = padre[nodo];
+    if (anteriorHermano[nodo] != -1)
+        siguienteHermano[anteriorHermano[nodo]] = siguienteHermano[nodo];
+    else
+        primerHijo[p] = siguienteHermano[nodo];
+    if (siguienteHermano[nodo] != -1)
+        anteriorHermano[siguienteHermano[nodo]] = anteriorHermano[nodo];
+    siguienteHermano[nodo] = anteriorHermano[nodo] = -1;
+}
+
+void SimplexRedes::engancharHijo(int nodo, int nuevoPadre)
+{
+    siguienteHermano[nodo] = primerHijo[nuevoPadre];
+    anteriorHermano[nodo] = -1;
+    if (primerHijo[nuevoPadre] != -1)
+        anteriorHermano[primerHijo[nuevoPadre]] = nodo;
+    primerHijo[nuevoPadre] = nodo;
+}
+
+// Profundidad y potencial del subárbol a partir de su nuevo arco al padre
+void SimplexRedes::recalcularSubarbol(int nodo)
+{
+    pila.clear();
+    pila.push_back(nodo);
+    while (!pila.empty())
+    {
+        int v = pila.back();
+        pila.pop_back();
+
+        int arco = arcoPadre[v];
+        profundidad[v] = profundidad[padre[v]] + 1;
+        // Los arcos del árbol tienen costo reducido cero: c + π(origen) - π(destino) = 0
+        potencial[v] = potencial[padre[v]] + (sentido[v] == 1 ? -costo[arco] : costo[arco]);
+
+        for (int hijo = primerHijo[v]; hijo != -1; hijo = siguienteHermano[hijo])
+        {
+            pila.push_back(hijo);
+        }
+    }
+}
+
+// Búsqueda por bloques: devuelve el arco más atractivo del primer bloque que tenga alguno
+int SimplexRedes::buscarArcoEntrante()
+{
+    int mejor = -1;
+    double mejorValor = -tolerancia;
+    int restantes = tamanoBloque;
+
+    for (int k = 0; k < numArcos; k++)
+    {
+        int e = siguienteArcoBusqueda;
+        siguienteArcoBusqueda = (e + 1 == numArcos) ? 0 : e + 1;
+
+        double valor = estadoArco[e] * (costo[e] + potencial[origen[e]] - potencial[destino[e]]);
+        if (valor < mejorValor)
+        {
+            mejorValor = valor;
+            mejor = e;
+        }
+
+        if (--restantes == 0)
+        {
+            if (mejor >= 0)
+                return mejor;
+            restantes = tamanoBloque;
+        }
+    }
+    return mejor;
+}
+
+/**
+ * Pivoteo con la regla del árbol fuertemente factible: entre los arcos que
+ * bloquean el ciclo sale el último en el sentido del flujo, lo que evita
+ * ciclar en pivoteos degenerados
+ * @return false si el ciclo no tiene límite (problema no acotado)
+ */
+bool SimplexRedes::pivotear(int arcoEntrante)
+{
+    int primero, segundo;
+    if (estadoArco[arcoEntrante] == 1)
+    {
+        primero = origen[arcoEntrante];
+        segundo = destino[arcoEntrante];
+    }
+    else
+    {
+        primero = destino[arcoEntrante];
+        segundo = origen[arcoEntrante];
+    }
+
+    // Ancestro común de los extremos del arco entrante
+    int u = primero, v = segundo;
+    while (u != v)
+    {
+        if (profundidad[u] > profundidad[v])
+            u = padre[u];
+        else if (profundidad[v] > profundidad[u])
+            v = padre[v];
+        else
+        {
+            u = padre[u];
+            v = padre[v];
+        }
+    }
+    int union_ = u;
+
+    // Paso máximo y arco saliente
+    long long delta = capacidad[arcoEntrante];
+    int nodoSaliente = -1;
+    int lado = 0;
+    for (u = primero; u != union_; u = padre[u])
+    {
+        int e = arcoPadre[u];
+        long long d = flujo[e];
+        if (sentido[u] == -1)
+            d = capacidad[e] == INF_RED ? INF_RED : capacidad[e] - flujo[e];
+        if (d < delta)
+        {
+            delta = d;
+            nodoSaliente = u;
+            lado = 1;
+        }
+    }
+    for (u = segundo; u != union_; u = padre[u])
+    {
+        int e = arcoPadre[u];
+        long long d = flujo[e];
+        if (sentido[u] == 1)
+            d = capacidad[e] == INF_RED ? INF_RED : capacidad[e] - flujo[e];
+        if (d <= delta)
+        {
+            delta = d;
+            nodoSaliente = u;
+            lado = 2;
+        }
+    }
+
+    if (delta == INF_RED)
+    {
+        return false;
+    }
+
+    // Enviar delta unidades por el ciclo
+    if (delta > 0)
+    {
+        long long valor = estadoArco[arcoEntrante] * delta;
+        flujo[arcoEntrante] += valor;
+        for (u = origen[arcoEntrante]; u != union_; u = padre[u])
+            flujo[arcoPadre[u]] -= sentido[u] * valor;
+        for (u = destino[arcoEntrante]; u != union_; u = padre[u])
+            flujo[arcoPadre[u]] += sentido[u] * valor;
+    }
+    pivoteos++;
+
+    if (lado == 0)
+    {
+        // El propio arco entrante llega a su otra cota: el árbol no cambia
+        estadoArco[arcoEntrante] = static_cast<signed char>(-estadoArco[arcoEntrante]);
+        return true;
+    }
+
+    int arcoSaliente = arcoPadre[nodoSaliente];
+    estadoArco[arcoEntrante] = 0;
+    estadoArco[arcoSaliente] = flujo[arcoSaliente] == 0 ? 1 : -1;
+
+    // El subárbol que cuelga del arco saliente se vuelve a colgar del arco entrante,
+    // invirtiendo el camino entre su extremo y la raíz anterior del subárbol
+    int nodoEntrante = lado == 1 ? primero : segundo;
+    int anterior = lado == 1 ? segundo : primero;
+    int arcoAnterior = arcoEntrante;
+    int actual = nodoEntrante;
+    while (true)
+    {
+        int siguiente = padre[actual];
+        int arcoSiguiente = arcoPadre[actual];
+
+        desengancharHijo(actual);
+        padre[actual] = anterior;
+        arcoPadre[actual] = arcoAnterior;
+        sentido[actual] = origen[arcoAnterior] == actual ? 1 : -1;
+        engancharHijo(actual, anterior);
+
+        if (actual == nodoSaliente)
+            break;
+
+        anterior = actual;
+        arcoAnterior = arcoSiguiente;
+        actual = siguiente;
+    }
+
+    recalcularSubarbol(nodoEntrante);
+    return true;
+}
+
+/**
+ * Resuelve el flujo de costo mínimo
+ * @param red Nodos con su oferta y arcos con costo y capacidad
+ * @return LP_OPTIMO, LP_INFACTIBLE (las capacidades no permiten cubrir la demanda)
+ *         o LP_NO_ACOTADO (ciclo de costo negativo sin límite de capacidad; se
+ *         informa aunque la red tampoco pueda cubrir la demanda)
+ */
+EstadoLP SimplexRedes::resolver(const RedFlujo &red)
+{
+    TRAZA_AMBITO("redes.resolver", "calculo");
+
+    numNodos = red.getNumNodos();
+    numArcos = red.getNumArcos();
+    raiz = numNodos;
+
+    long long balance = 0;
+    for (int v = 0; v < numNodos; v++)
+    {
+        balance += red.getOferta(v);
+    }
+    if (balance != 0)
+    {
+        throw invalid_argument("La oferta total de la red debe ser igual a la demanda total.");
+    }
+
+    int totalArcos = numArcos + numNodos;
+    origen.assign(totalArcos, 0);
+    destino.assign(totalArcos, 0);
+    costo.assign(totalArcos, 0.0);
+    capacidad.assign(totalArcos, INF_RED);
+    flujo.assign(totalArcos, 0);
+    estadoArco.assign(totalArcos, 1);
+
+    double costoMaximo = 0.0;
+    for (int e = 0; e < numArcos; e++)
+    {
+        const ArcoRed &arco = red.getArco(e);
+        origen[e] = arco.origen;
+        destino[e] = arco.destino;
+        costo[e] = arco.costo;
+        capacidad[e] = arco.capacidad;
+        costoMaximo = max(costoMaximo, abs(arco.costo));
+    }
+    tolerancia = 1e-9 * (1.0 + costoMaximo);
+
+    // Árbol inicial: un arco artificial caro entre cada nodo y la raíz
+    double costoArtificial = (costoMaximo + 1.0) * (numNodos + 1);
+    padre.assign(numNodos + 1, -1);
+    arcoPadre.assign(numNodos + 1, -1);
+    sentido.assign(numNodos + 1, 0);
+    primerHijo.assign(numNodos + 1, -1);
+    siguienteHermano.assign(numNodos + 1, -1);
+    anteriorHermano.assign(numNodos + 1, -1);
+    profundidad.assign(numNodos + 1, 1);
+    potencial.assign(numNodos + 1, 0.0);
+    profundidad[raiz] = 0;
+
+    for (int v = 0; v < numNodos; v++)
+    {
+        int e = numArcos + v;
+        long long ofertaNodo = red.getOferta(v);
+        costo[e] = costoArtificial;
+        estadoArco[e] = 0;
+        padre[v] = raiz;
+        arcoPadre[v] = e;
+        engancharHijo(v, raiz);
+
+        if (ofertaNodo >= 0)
+        {
+            origen[e] = v;
+            destino[e] = raiz;
+            flujo[e] = ofertaNodo;
+            sentido[v] = 1;
+            potencial[v] = -costoArtificial;
+        }
+        else
+        {
+            origen[e] = raiz;
+            destino[e] = v;
+            flujo[e] = -ofertaNodo;
+            sentido[v] = -1;
+            potencial[v] = costoArtificial;
+        }
+    }
+
+    // Solo los arcos reales compiten por entrar
+    siguienteArcoBusqueda = 0;
+    tamanoBloque = max(10, static_cast<int>(sqrt(static_cast<double>(max(numArcos, 1)))));
+    pivoteos = 0;
+
+    if (numArcos > 0)
+    {
+        int arcoEntrante;
+        while ((arcoEntrante = buscarArcoEntrante()) >= 0)
+        {
+            if (!pivotear(arcoEntrante))
+            {
+                estado = LP_NO_ACOTADO;
+                return estado;
+            }
+        }
+    }
+
+    // Si algún arco artificial conserva flujo, la demanda no se puede cubrir
+    estado = LP_OPTIMO;
+    for (int v = 0; v < numNodos; v++)
+    {
+        if (flujo[numArcos + v] != 0)
+        {
+            estado = LP_INFACTIBLE;
+            break;
+        }
+    }
+    return estado;
+}
+
+double SimplexRedes::getCostoTotal() const
+{
+    double total = 0.0;
+    for (int e = 0; e < numArcos; e++)
+    {
+        total += costo[e] * static_cast<double>(flujo[e]);
+    }
+    return total;
+}
+
+// Unidades enteras que una planta puede enviar según su plan de producción
+static long long unidadesProducidas(double cantidad)
+{
+    if (!(cantidad > 0))
+        return 0;
+    double redondeo = round(cantidad);
+    return static_cast<long long>(abs(cantidad - redondeo) < 1e-6 ? redondeo : floor(cantidad));
+}
+
+/**
+ * Red de un producto: plantas → tiendas, más un nodo de sobrante (producción
+ * no enviada, costo 0) y uno de faltante (demanda no atendida, con penalización).
+ * Los arcos de las rutas van primero, luego plantas → sobrante y faltante → tiendas.
+ */
+static RedFlujo construirRedProducto(const ModeloDistribucion &modelo, const vector<long long> &produccion, bool mesas)
+{
+    const vector<long long> &demanda = mesas ? modelo.demandaMesas : modelo.demandaSillas;
+    int numTiendas = static_cast<int>(demanda.size());
+
+    long long totalProduccion = 0, totalDemanda = 0;
+    RedFlujo red;
+    for (int p = 0; p < modelo.numPlantas; p++)
+    {
+        red.agregarNodo(produccion[p]);
+        totalProduccion += produccion[p];
+    }
+    for (int t = 0; t < numTiendas; t++)
+    {
+        if (demanda[t] < 0)
+        {
+            throw invalid_argument("La demanda de una tienda no puede ser negativa.");
+        }
+        red.agregarNodo(-demanda[t]);
+        totalDemanda += demanda[t];
+    }
+    int sobrante = red.agregarNodo(-totalProduccion);
+    int faltante = red.agregarNodo(totalDemanda);
+
+    for (const auto &ruta : modelo.rutas)
+    {
+        if (ruta.planta < 0 || ruta.planta >= modelo.numPlantas || ruta.tienda < 0 || ruta.tienda >= numTiendas)
+        {
+            throw out_of_range("Ruta con planta o tienda inexistente.");
+        }
+        red.agregarArco(ruta.planta, modelo.numPlantas + ruta.tienda, mesas ? ruta.costoMesa : ruta.costoSilla,
+                        mesas ? ruta.capacidadMesas : ruta.capacidadSillas);
+    }
+    for (int p = 0; p < modelo.numPlantas; p++)
+    {
+        red.agregarArco(p, sobrante, 0.0);
+    }
+    for (int t = 0; t < numTiendas; t++)
+    {
+        red.agregarArco(faltante, modelo.numPlantas + t, modelo.penalizacionFaltante);
+    }
+    // Lo que no se envía ni se penaliza cierra el balance entre ambos nodos
+    red.agregarArco(faltante, sobrante, 0.0);
+    return red;
+}
+
+/**
+ * Reparte la producción de cada planta entre las tiendas al menor costo
+ * @param modelo Tiendas, demandas y rutas disponibles
+ * @param produccionPorPlanta Solución del modelo de producción de cada planta
+ * @return Envíos por ruta, faltantes y sobrantes de cada producto
+ */
+PlanDistribucion planificarDistribucion(const ModeloDistribucion &modelo, const vector<SolucionOptima> &produccionPorPlanta)
+{
+    TRAZA_AMBITO("redes.distribucion", "calculo");
+
+    if (static_cast<int>(produccionPorPlanta.size()) != modelo.numPlantas)
+    {
+        throw invalid_argument("Se necesita la producción de cada planta.");
+    }
+    if (modelo.demandaMesas.size() != modelo.demandaSillas.size())
+    {
+        throw invalid_argument("Cada tienda debe tener demanda de mesas y de sillas.");
+    }
+
+    PlanDistribucion plan;
+    size_t numRutas = modelo.rutas.size();
+    int numTiendas = static_cast<int>(modelo.demandaMesas.size());
+
+    for (int producto = 0; producto < 2; producto++)
+    {
+        bool mesas = producto == 0;
+        vector<long long> produccion(modelo.numPlantas);
+        for (int p = 0; p < modelo.numPlantas; p++)
+        {
+            const SolucionOptima &solucion = produccionPorPlanta[p];
+            produccion[p] = solucion.solucionEncontrada ? unidadesProducidas(mesas ? solucion.x1 : solucion.x2) : 0;
+        }
+
+        RedFlujo red = construirRedProducto(modelo, produccion, mesas);
+        SimplexRedes simplex;
+        if (simplex.resolver(red) != LP_OPTIMO)
+        {
+            return plan;
+        }
+
+        vector<long long> &envios = mesas ? plan.enviosMesas : plan.enviosSillas;
+        envios.resize(numRutas);
+        for (size_t r = 0; r < numRutas; r++)
+        {
+            envios[r] = simplex.getFlujo(static_cast<int>(r));
+            plan.costoEnvio += envios[r] * (mesas ? modelo.rutas[r].costoMesa : modelo.rutas[r].costoSilla);
+        }
+
+        long long sobrante = 0, faltante = 0;
+        for (int p = 0; p < modelo.numPlantas; p++)
+            sobrante += simplex.getFlujo(static_cast<int>(numRutas) + p);
+        for (int t = 0; t < numTiendas; t++)
+            faltante += simplex.getFlujo(static_cast<int>(numRutas) + modelo.numPlantas + t);
+
+        (mesas ? plan.sobranteMesas : plan.sobranteSillas) = sobrante;
+        (mesas ? plan.faltanteMesas : plan.faltanteSillas) = faltante;
+    }
+
+    plan.solucionEncontrada = true;
+    return plan;
+}
+
+// Resuelve la misma red como modelo lineal general (para comparar)
+static double resolverRedComoLP(const RedFlujo &red)
+{
+    ModeloLineal lineal;
+    vector<vector<pair<int, double>>> filas(red.getNumNodos());
+    for (int e = 0; e < red.getNumArcos(); e++)
+    {
+        const ArcoRed &arco = red.getArco(e);
+        double superior = arco.capacidad == INF_RED ? INFINITO_LP : static_cast<double>(arco.capacidad);
+        int j = lineal.agregarVariable(-arco.costo, 0.0, superior);
+        filas[arco.origen].push_back(make_pair(j, 1.0));
+        filas[arco.destino].push_back(make_pair(j, -1.0));
+    }
+    for (int v = 0; v < red.getNumNodos(); v++)
+    {
+        lineal.agregarFila(filas[v], "=", static_cast<double>(red.getOferta(v)));
+    }
+
+    ResolvedorSimplex resolvedor;
+    resolvedor.cargar(lineal);
+    return resolvedor.resolver() == LP_OPTIMO ? -resolvedor.getValorObjetivo() : NAN;
+}
+
+// Valor pseudoaleatorio reproducible en [0, 1)
+static double aleatorioRed(unsigned long long &estadoGenerador)
+{
+    estadoGenerador = estadoGenerador * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<double>(estadoGenerador >> 11) / 9007199254740992.0;
+}
+
+static ModeloDistribucion generarModeloDistribucion(int plantas, int tiendas, const vector<SolucionOptima> &produccion,
+                                                    unsigned long long semilla)
+{
+    ModeloDistribucion modelo;
+    modelo.numPlantas = plantas;
+
+    vector<pair<double, double>> ubicacionPlanta(plantas), ubicacionTienda(tiendas);
+    for (auto &ubicacion : ubicacionPlanta)
+        ubicacion = make_pair(1000 * aleatorioRed(semilla), 1000 * aleatorioRed(semilla));
+    for (auto &ubicacion : ubicacionTienda)
+        ubicacion = make_pair(1000 * aleatorioRed(semilla), 1000 * aleatorioRed(semilla));
+
+    // Demanda cercana a la producción total, repartida al azar entre las tiendas
+    double totalMesas = 0, totalSillas = 0;
+    for (const auto &solucion : produccion)
+    {
+        totalMesas += solucion.x1;
+        totalSillas += solucion.x2;
+    }
+    for (int t = 0; t < tiendas; t++)
+    {
+        modelo.demandaMesas.push_back(static_cast<long long>(2.0 * aleatorioRed(semilla) * totalMesas / tiendas));
+        modelo.demandaSillas.push_back(static_cast<long long>(2.0 * aleatorioRed(semilla) * totalSillas / tiendas));
+    }
+
+    for (int p = 0; p < plantas; p++)
+    {
+        for (int t = 0; t < tiendas; t++)
+        {
+            double distancia = hypot(ubicacionPlanta[p].first - ubicacionTienda[t].first,
+                                     ubicacionPlanta[p].second - ubicacionTienda[t].second);
+            long long limite = aleatorioRed(semilla) < 0.1 ? 3 : CAPACIDAD_ILIMITADA; // Algunas rutas con cupo
+            modelo.rutas.push_back(RutaEnvio{p, t, 0.05 * distancia, 0.02 * distancia, limite, limite});
+        }
+    }
+    return modelo;
+}
+
+/**
+ * Conecta la producción con la distribución: cada planta resuelve su modelo
+ * de producción (caso Flair con capacidades propias) y luego se reparte lo
+ * producido entre las tiendas
+ * @param plantas Número de plantas
+ * @param tiendas Número de tiendas (hay una ruta por cada par planta-tienda)
+ */
+void ejecutarBenchmarkRedes(int plantas, int tiendas)
+{
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: SÍMPLEX DE REDES (DISTRIBUCIÓN)" << endl;
+    cout << string(60, '=') << endl;
+
+    auto resolverProduccion = [](int numPlantas)
+    {
+        vector<SolucionOptima> produccion;
+        ArenaMonotona arena;
+        for (int p = 0; p < numPlantas; p++)
+        {
+            double escala = 0.5 + (p % 11) * 0.1;
+            vector<Restriccion> restricciones;
+            restricciones.push_back(Restriccion(4.0, 3.0, 240.0 * escala));
+            restricciones.push_back(Restriccion(2.0, 1.0, 100.0 * escala));
+            restricciones.push_back(Restriccion(0.0, 1.0, 60.0 * escala));
+            arena.reiniciar();
+            produccion.push_back(resolverPuntosExtremos(restricciones, 70.0, 50.0, &arena));
+        }
+        return produccion;
+    };
+
+    // Verificación en una instancia pequeña contra el símplex general
+    {
+        vector<SolucionOptima> produccion = resolverProduccion(10);
+        ModeloDistribucion modelo = generarModeloDistribucion(10, 60, produccion, 7);
+        vector<long long> mesas;
+        for (const auto &solucion : produccion)
+            mesas.push_back(unidadesProducidas(solucion.x1));
+        RedFlujo red = construirRedProducto(modelo, mesas, true);
+
+        SimplexRedes simplex;
+        simplex.resolver(red);
+        double costoLP = resolverRedComoLP(red);
+        cout << "Verificación (10 × 60, mesas): redes $" << simplex.getCostoTotal() << ", símplex general $" << costoLP << endl;
+        if (!(abs(simplex.getCostoTotal() - costoLP) <= 1e-6 * (1.0 + abs(costoLP))))
+        {
+            mostrarMensajeError("El símplex de redes no coincide con el símplex general.");
+        }
+    }
+
+    auto inicio = chrono::steady_clock::now();
+    vector<SolucionOptima> produccion = resolverProduccion(plantas);
+    double segundosProduccion = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    ModeloDistribucion modelo = generarModeloDistribucion(plantas, tiendas, produccion, 12345);
+
+    inicio = chrono::steady_clock::now();
+    PlanDistribucion plan = planificarDistribucion(modelo, produccion);
+    double segundosDistribucion = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    cout << "\nPlantas: " << plantas << ", tiendas: " << tiendas << ", rutas: " << modelo.rutas.size()
+         << " por producto" << endl;
+    cout << "  • Producción de las plantas: " << segundosProduccion * 1000 << " ms" << endl;
+    cout << "  • Distribución (mesas y sillas): " << segundosDistribucion * 1000 << " ms" << endl;
+    if (plan.solucionEncontrada)
+    {
+        cout << "  • Costo de envío: $" << plan.costoEnvio << endl;
+        cout << "  • Demanda no atendida: " << plan.faltanteMesas << " mesas, " << plan.faltanteSillas << " sillas" << endl;
+        cout << "  • Producción sin enviar: " << plan.sobranteMesas << " mesas, " << plan.sobranteSillas << " sillas" << endl;
+    }
+    else
+    {
+        mostrarMensajeError("No se encontró un plan de distribución.");
+    }
+}
@@ -0,0 +1,532 @@
+/**
+ * MÓDULO DE REPORTES
+ * Escritura rápida de reportes en texto, CSV y JSON: los números se
+ * formatean con std::to_chars en un buffer reutilizable y la salida se
+ * envía en bloques grandes
+ */
+
+#include "optimizacion.h"
+#include <charconv>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+
+// Espacio suficiente para cualquier double en notación fija con hasta 17 decimales
+static const size_t MAX_CARACTERES_NUMERO = 352;
+static const double TOL_ACTIVA = 1e-6;
+
+/**
+ * Formatea un número con decimales fijos
+ * @param destino Buffer de salida (no se agrega terminador)
+ * @param capacidad Tamaño del buffer
+ * @param numero Valor a formatear
+ * @param decimales Cantidad de decimales; si es negativa se usa la representación
+ *                  más corta que conserva el valor exacto
+ * @return Cantidad de caracteres escritos (0 si no cupo)
+ */
+size_t formatearDecimal(char *destino, size_t capacidad, double numero, int decimales)
+{
+    static const double POTENCIAS_10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+
+    // Forma más corta: buscar los menores decimales d (hasta 6) con los que el valor
+    // se recupera exacto. v / 10^d es el double más cercano a ese decimal, igual que
+    // al leerlo, así que la cadena es la misma que daría to_chars. Fuera de
+    // [1e-3, 1e5) to_chars puede preferir la notación científica ("1e+05").
+    if (decimales < 0 && isfinite(numero) && capacidad >= 32)
+    {
+        double absoluto = abs(numero);
+        if (absoluto == 0.0 || (absoluto >= 1e-3 && absoluto < 1e5))
+        {
+            for (int d = 0; d <= 6; d++)
+            {
+                double escalado = static_cast<double>(static_cast<long long>(absoluto * POTENCIAS_10[d] + 0.5));
+                if (escalado / POTENCIAS_10[d] == absoluto)
+                {
+                    decimales = d;
+                    break;
+                }
+            }
+        }
+        if (decimales < 0)
+        {
+            to_chars_result resultado = to_chars(destino, destino + capacidad, numero);
+            return resultado.ec == errc() ? static_cast<size_t>(resultado.ptr - destino) : 0;
+        }
+    }
+
+    // Camino rápido: escalar a entero y escribir los dígitos. Solo se usa cuando
+    // el redondeo no está cerca de un empate, así que coincide con to_chars.
+    if (decimales <= 9 && isfinite(numero) && abs(numero) < 1e15 && capacidad >= 32)
+    {
+        double escalado = abs(numero) * (decimales > 0 ? POTENCIAS_10[decimales] : 1.0);
+        double parteEntera = static_cast<double>(static_cast<unsigned long long>(escalado));
+        double fraccion = escalado - parteEntera;
+        double margen = max(1e-9, escalado * 1e-15);
+        bool exacto = abs(fraccion - 0.5) > margen;
+
+        if (escalado < 1e15 && exacto)
+        {
+            unsigned long long valor = static_cast<unsigned long long>(parteEntera) + (fraccion > 0.5 ? 1 : 0);
+            char *p = destino;
+            if (signbit(numero))
+            {
+                *p++ = '-';
+            }
+            if (decimales <= 0)
+            {
+                return static_cast<size_t>(to_chars(p, destino + capacidad, valor).ptr - destino);
+            }
+
+            unsigned long long divisor = static_cast<unsigned long long>(POTENCIAS_10[decimales]);
+            p = to_chars(p, destino + capacidad, valor / divisor).ptr;
+            *p++ = '.';
+            unsigned long long resto = valor % divisor;
+            for (int i = decimales - 1; i >= 0; i--)
+            {
+                p[i] = static_cast<char>('0' + resto % 10);
+                resto /= 10;
+            }
+            return static_cast<size_t>(p + decimales - destino);
+        }
+    }
+
+    to_chars_result resultado = to_chars(destino, destino + capacidad, numero, chars_format::fixed, min(decimales, 17));
+    if (resultado.ec != errc())
+    {
+        return 0;
+    }
+    return static_cast<size_t>(resultado.ptr - destino);
+}
+
+// Constructor
+EscritorReporte::EscritorReporte(ostream &destino, size_t capacidad)
+    : destino(destino), buffer(max<size_t>(capacidad, 2 * MAX_CARACTERES_NUMERO)), usado(0), bytesEscritos(0)
+{
+}
+
+// Destructor
+EscritorReporte::~EscritorReporte()
+{
+    vaciar();
+}
+
+void EscritorReporte::vaciar()
+{
+    if (usado > 0)
+    {
+        destino.write(buffer.data(), static_cast<streamsize>(usado));
+        bytesEscritos += usado;
+        usado = 0;
+    }
+}
+
+void EscritorReporte::asegurarEspacio(size_t bytes)
+{
+    if (usado + bytes > buffer.size())
+    {
+        vaciar();
+    }
+}
+
+void EscritorReporte::escribir(const char *texto)
+{
+    size_t longitud = strlen(texto);
+    if (longitud > buffer.size())
+    {
+        // Textos más grandes que el buffer van directo al destino
+        vaciar();
+        destino.write(texto, static_cast<streamsize>(longitud));
+        bytesEscritos += longitud;
+        return;
+    }
+    asegurarEspacio(longitud);
+    memcpy(buffer.data() + usado, texto, longitud);
+    usado += longitud;
+}
+
+void EscritorReporte::escribir(const string &texto)
+{
+    escribir(texto.c_str());
+}
+
+void EscritorReporte::escribirCaracter(char c)
+{
+    asegurarEspacio(1);
+    buffer[usado++] = c;
+}
+
+void EscritorReporte::escribirRepetido(char c, size_t veces)
+{
+    while (veces > 0)
+    {
+        asegurarEspacio(1);
+        size_t cantidad = min(veces, buffer.size() - usado);
+        memset(buffer.data() + usado, c, cantidad);
+        usado += cantidad;
+        veces -= cantidad;
+    }
+}
+
+void EscritorReporte::escribirNumero(double numero, int decimales)
+{
+    asegurarEspacio(MAX_CARACTERES_NUMERO);
+    usado += formatearDecimal(buffer.data() + usado, MAX_CARACTERES_NUMERO, numero, decimales);
+}
+
+void EscritorReporte::escribirEntero(long long numero)
+{
+    asegurarEspacio(24);
+    to_chars_result resultado = to_chars(buffer.data() + usado, buffer.data() + usado + 24, numero);
+    usado = static_cast<size_t>(resultado.ptr - buffer.data());
+}
+
+void EscritorReporte::escribirCadenaJson(const string &texto)
+{
+    escribirCaracter('"');
+    for (char c : texto)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escribirCaracter('\\');
+            escribirCaracter(c);
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char escape[8];
+            snprintf(escape, sizeof(escape), "\\u%04x", static_cast<unsigned char>(c));
+            escribir(escape);
+        }
+        else
+        {
+            escribirCaracter(c);
+        }
+    }
+    escribirCaracter('"');
+}
+
+// JSON no admite infinito ni NaN
+static void escribirNumeroJson(EscritorReporte &escritor, double numero)
+{
+    if (isfinite(numero))
+        escritor.escribirNumero(numero, -1);
+    else
+        escritor.escribir("null");
+}
+
+void escribirExpresionRestriccion(EscritorReporte &escritor, const Restriccion &r)
+{
+    if (r.coeficienteX1 != 0)
+    {
+        escritor.escribirNumero(r.coeficienteX1);
+        escritor.escribir("x₁");
+    }
+
+    if (r.coeficienteX2 != 0)
+    {
+        if (r.coeficienteX1 != 0)
+        {
+            escritor.escribir(r.coeficienteX2 > 0 ? " + " : " - ");
+            escritor.escribirNumero(abs(r.coeficienteX2));
+        }
+        else
+        {
+            escritor.escribirNumero(r.coeficienteX2);
+        }
+        escritor.escribir("x₂");
+    }
+
+    escritor.escribirCaracter(' ');
+    escritor.escribir(r.operador);
+    escritor.escribirCaracter(' ');
+    escritor.escribirNumero(r.valorConstante);
+}
+
+// Holgura: distancia al límite de la restricción (negativa si no se cumple)
+static double calcularHolgura(const Restriccion &r, double actividad)
+{
+    if (r.operador == ">=")
+        return actividad - r.valorConstante;
+    if (r.operador == "=")
+        return -abs(actividad - r.valorConstante);
+    return r.valorConstante - actividad;
+}
+
+/**
+ * Escribe las restricciones con su actividad y holgura en la solución
+ * @param escritor Destino del reporte
+ * @param restricciones Restricciones del modelo
+ * @param solucion Punto donde se evalúan (sin solución solo se listan las restricciones)
+ * @param formato Texto para la consola, CSV o JSON
+ */
+void escribirReporteRestricciones(EscritorReporte &escritor, const vector<Restriccion> &restricciones,
+                                  const SolucionOptima &solucion, FormatoReporte formato)
+{
+    TRAZA_AMBITO("reporte.restricciones", "reporte");
+    bool conSolucion = solucion.solucionEncontrada;
+
+    switch (formato)
+    {
+    case REPORTE_TEXTO:
+        escritor.escribir("REPORTE DE RESTRICCIONES\n");
+        if (conSolucion)
+        {
+            escritor.escribir("Solución: x₁ = ");
+            escritor.escribirNumero(solucion.x1);
+            escritor.escribir(", x₂ = ");
+            escritor.escribirNumero(solucion.x2);
+            escritor.escribir(", Z = $");
+            escritor.escribirNumero(solucion.gananciaMaxima);
+            escritor.nuevaLinea();
+        }
+        else
+        {
+            escritor.escribir("Solución: no calculada\n");
+        }
+        escritor.escribirRepetido('-', 60);
+        escritor.nuevaLinea();
+
+        for (size_t i = 0; i < restricciones.size(); i++)
+        {
+            const Restriccion &r = restricciones[i];
+            escritor.escribir("  ");
+            escritor.escribirEntero(static_cast<long long>(i + 1));
+            escritor.escribir(". ");
+            escribirExpresionRestriccion(escritor, r);
+            if (conSolucion)
+            {
+                double actividad = r.coeficienteX1 * solucion.x1 + r.coeficienteX2 * solucion.x2;
+                double holgura = calcularHolgura(r, actividad);
+                escritor.escribir(" | actividad ");
+                escritor.escribirNumero(actividad);
+                escritor.escribir(" | holgura ");
+                escritor.escribirNumero(holgura);
+                escritor.escribir(abs(holgura) <= TOL_ACTIVA ? " | activa" : " | inactiva");
+            }
+            escritor.nuevaLinea();
+        }
+        break;
+
+    case REPORTE_CSV:
+        escritor.escribir("indice,coeficiente_x1,coeficiente_x2,operador,valor,actividad,holgura,activa\n");
+        for (size_t i = 0; i < restricciones.size(); i++)
+        {
+            const Restriccion &r = restricciones[i];
+            escritor.escribirEntero(static_cast<long long>(i + 1));
+            escritor.escribirCaracter(',');
+            escritor.escribirNumero(r.coeficienteX1, -1);
+            escritor.escribirCaracter(',');
+            escritor.escribirNumero(r.coeficienteX2, -1);
+            escritor.escribirCaracter(',');
+            escritor.escribir(r.operador);
+            escritor.escribirCaracter(',');
+            escritor.escribirNumero(r.valorConstante, -1);
+            if (conSolucion)
+            {
+                double actividad = r.coeficienteX1 * solucion.x1 + r.coeficienteX2 * solucion.x2;
+                double holgura = calcularHolgura(r, actividad);
+                escritor.escribirCaracter(',');
+                escritor.escribirNumero(actividad, -1);
+                escritor.escribirCaracter(',');
+                escritor.escribirNumero(holgura, -1);
+                escritor.escribir(abs(holgura) <= TOL_ACTIVA ? ",1" : ",0");
+            }
+            else
+            {
+                escritor.escribir(",,,");
+            }
+            escritor.nuevaLinea();
+        }
+        break;
+
+    case REPORTE_JSON:
+        escritor.escribir("{\"solucion\":");
+        if (conSolucion)
+        {
+            escritor.escribir("{\"x1\":");
+            escribirNumeroJson(escritor, solucion.x1);
+            escritor.escribir(",\"x2\":");
+            escribirNumeroJson(escritor, solucion.x2);
+            escritor.escribir(",\"ganancia\":");
+            escribirNumeroJson(escritor, solucion.gananciaMaxima);
+            escritor.escribirCaracter('}');
+        }
+        else
+        {
+            escritor.escribir("null");
+        }
+        escritor.escribir(",\"restricciones\":[");
+        for (size_t i = 0; i < restricciones.size(); i++)
+        {
+            const Restriccion &r = restricciones[i];
+            escritor.escribir(i == 0 ? "\n{\"indice\":" : ",\n{\"indice\":");
+            escritor.escribirEntero(static_cast<long long>(i + 1));
+            escritor.escribir(",\"coeficienteX1\":");
+            escribirNumeroJson(escritor, r.coeficienteX1);
+            escritor.escribir(",\"coeficienteX2\":");
+            escribirNumeroJson(escritor, r.coeficienteX2);
+            escritor.escribir(",\"operador\":");
+            escritor.escribirCadenaJson(r.operador);
+            escritor.escribir(",\"valor\":");
+            escribirNumeroJson(escritor, r.valorConstante);
+            if (conSolucion)
+            {
+                double actividad = r.coeficienteX1 * solucion.x1 + r.coeficienteX2 * solucion.x2;
+                double holgura = calcularHolgura(r, actividad);
+                escritor.escribir(",\"actividad\":");
+                escribirNumeroJson(escritor, actividad);
+                escritor.escribir(",\"holgura\":");
+                escribirNumeroJson(escritor, holgura);
+                escritor.escribir(abs(holgura) <= TOL_ACTIVA ? ",\"activa\":true}" : ",\"activa\":false}");
+            }
+            else
+            {
+                escritor.escribirCaracter('}');
+            }
+        }
+        escritor.escribir("\n]}\n");
+        break;
+    }
+}
+
+FormatoReporte interpretarFormatoReporte(const string &nombre)
+{
+    if (nombre == "texto" || nombre == "txt")
+        return REPORTE_TEXTO;
+    if (nombre == "csv")
+        return REPORTE_CSV;
+    if (nombre == "json")
+        return REPORTE_JSON;
+    throw invalid_argument("Formato de reporte desconocido: " + nombre + " (use texto, csv o json)");
+}
+
+/**
+ * Escribe el reporte de restricciones de una sesión guardada
+ * @param archivoSesion Instantánea de la sesión
+ * @param formato "texto", "csv" o "json"
+ * @param archivoSalida Archivo de destino ("-" para la consola)
+ */
+void exportarReporteSesion(const string &archivoSesion, const string &formato, const string &archivoSalida)
+{
+    FormatoReporte tipo = interpretarFormatoReporte(formato);
+    InstantaneaMapeada instantanea(archivoSesion);
+    ModeloProduccion modelo = instantanea.obtenerModelo();
+
+    if (archivoSalida == "-")
+    {
+        EscritorReporte escritor(cout);
+        escribirReporteRestricciones(escritor, modelo.restricciones, instantanea.obtenerSolucion(), tipo);
+        return;
+    }
+
+    ofstream archivo(archivoSalida, ios::binary | ios::trunc);
+    if (!archivo)
+    {
+        throw runtime_error("No se pudo crear el archivo: " + archivoSalida);
+    }
+    {
+        EscritorReporte escritor(archivo);
+        escribirReporteRestricciones(escritor, modelo.restricciones, instantanea.obtenerSolucion(), tipo);
+    }
+    if (!archivo.flush())
+    {
+        throw runtime_error("No se pudo escribir el archivo: " + archivoSalida);
+    }
+    mostrarMensajeExito("Reporte guardado en " + archivoSalida);
+}
+
+// Formato anterior: un ostringstream por número y endl por línea
+static string formatearConFlujo(double numero)
+{
+    ostringstream oss;
+    oss << fixed << setprecision(2) << numero;
+    return oss.str();
+}
+
+/**
+ * Compara la escritura de un reporte grande con el formato anterior,
+ * con el escritor en cada formato y con la copia directa de bytes al disco
+ * @param filas Cantidad de restricciones del reporte
+ */
+void ejecutarBenchmarkReporte(size_t filas)
+{
+    const string archivoPrueba = "reporte_benchmark.tmp";
+    const char *operadores[] = {"<=", ">=", "="};
+
+    vector<Restriccion> restricciones;
+    restricciones.reserve(filas);
+    for (size_t i = 0; i < filas; i++)
+    {
+        restricciones.push_back(Restriccion(1.0 + (i % 7) * 0.25, 0.5 + (i % 5), 100.0 + (i % 1000) * 0.1,
+                                            operadores[i % 3]));
+    }
+    SolucionOptima solucion;
+    solucion.x1 = 30.0;
+    solucion.x2 = 40.0;
+    solucion.gananciaMaxima = 4100.0;
+    solucion.solucionEncontrada = true;
+
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: ESCRITURA DE REPORTES" << endl;
+    cout << string(60, '=') << endl;
+    cout << "Filas: " << filas << endl;
+
+    auto medir = [&](const char *nombre, const function<void(ofstream &)> &escribir)
+    {
+        ofstream archivo(archivoPrueba, ios::binary | ios::trunc);
+        auto inicio = chrono::steady_clock::now();
+        escribir(archivo);
+        archivo.close();
+        double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+        ifstream lectura(archivoPrueba, ios::binary | ios::ate);
+        double megabytes = static_cast<double>(lectura.tellg()) / (1024.0 * 1024.0);
+        cout << "  • " << nombre << ": " << segundos * 1000 << " ms, " << megabytes << " MB, "
+             << (segundos > 0 ? megabytes / segundos : 0.0) << " MB/s" << endl;
+        return megabytes;
+    };
+
+    double megabytesTexto = 0;
+    medir("Texto con ostringstream y endl", [&](ofstream &archivo)
+          {
+        for (size_t i = 0; i < restricciones.size(); i++)
+        {
+            const Restriccion &r = restricciones[i];
+            double actividad = r.coeficienteX1 * solucion.x1 + r.coeficienteX2 * solucion.x2;
+            archivo << "  " << (i + 1) << ". " << formatearConFlujo(r.coeficienteX1) << "x₁ + "
+                    << formatearConFlujo(r.coeficienteX2) << "x₂ " << r.operador << " "
+                    << formatearConFlujo(r.valorConstante) << " | actividad " << formatearConFlujo(actividad)
+                    << " | holgura " << formatearConFlujo(calcularHolgura(r, actividad)) << endl;
+        } });
+
+    const FormatoReporte formatos[] = {REPORTE_TEXTO, REPORTE_CSV, REPORTE_JSON};
+    const char *nombres[] = {"Texto con EscritorReporte", "CSV con EscritorReporte", "JSON con EscritorReporte"};
+    for (int f = 0; f < 3; f++)
+    {
+        double megabytes = medir(nombres[f], [&](ofstream &archivo)
+                                 {
+            EscritorReporte escritor(archivo);
+            escribirReporteRestricciones(escritor, restricciones, solucion, formatos[f]); });
+        if (formatos[f] == REPORTE_TEXTO)
+        {
+            megabytesTexto = megabytes;
+        }
+    }
+
+    // Referencia: escribir la misma cantidad de bytes sin formatear nada
+    vector<char> bloque(1 << 20, 'x');
+    size_t bytes = static_cast<size_t>(megabytesTexto * 1024 * 1024);
+    medir("Copia directa (referencia del disco)", [&](ofstream &archivo)
+          {
+        for (size_t escritos = 0; escritos < bytes; escritos += bloque.size())
+        {
+            archivo.write(bloque.data(), static_cast<streamsize>(min(bloque.size(), bytes - escritos)));
+        } });
+
+    remove(archivoPrueba.c_str());
+}
@@ -0,0 +1,531 @@
+/**
+ * MÓDULO DE OPTIMIZACIÓN ROBUSTA
+ * Genera la contraparte robusta de un modelo lineal cuando los coeficientes
+ * de sus filas son inciertos, con conjuntos de caja (Soyster) o con
+ * presupuesto de incertidumbre (Bertsimas-Sim). La contraparte es otro
+ * ModeloLineal, de tamaño proporcional a los coeficientes inciertos, que se
+ * resuelve con el mismo método símplex
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+static const double TOL_PROTECCION = 1e-6; // Exceso relativo del peor caso sobre la cota que pide un corte
+                                           // (mayor que la tolerancia primal del símplex)
+
+// Suma valor al coeficiente de la variable en la fila (la agrega si no está)
+static void sumarCoeficiente(vector<pair<int, double>> &fila, int variable, double valor)
+{
+    for (auto &coeficiente : fila)
+    {
+        if (coeficiente.first == variable)
+        {
+            coeficiente.second += valor;
+            return;
+        }
+    }
+    fila.push_back(make_pair(variable, valor));
+}
+
+static void validarIncertidumbre(const ModeloLineal &modelo, const vector<IncertidumbreFila> &incertidumbre)
+{
+    vector<char> vista(modelo.getNumFilas(), 0);
+    for (const auto &fila : incertidumbre)
+    {
+        if (fila.fila < 0 || fila.fila >= modelo.getNumFilas())
+        {
+            throw out_of_range("La incertidumbre hace referencia a una fila inexistente.");
+        }
+        if (vista[fila.fila])
+        {
+            throw invalid_argument("La fila " + to_string(fila.fila + 1) + " tiene más de un conjunto de incertidumbre.");
+        }
+        vista[fila.fila] = 1;
+        if (!(fila.presupuesto >= 0.0))
+        {
+            throw invalid_argument("El presupuesto de incertidumbre no puede ser negativo.");
+        }
+        for (const auto &desviacion : fila.desviaciones)
+        {
+            if (desviacion.first < 0 || desviacion.first >= modelo.getNumVariables())
+            {
+                throw out_of_range("La incertidumbre hace referencia a una variable inexistente.");
+            }
+            if (!(desviacion.second >= 0.0) || !isfinite(desviacion.second))
+            {
+                throw invalid_argument("Las desviaciones de los coeficientes deben ser finitas y no negativas.");
+            }
+        }
+        if (modelo.filaInferior[fila.fila] == modelo.filaSuperior[fila.fila] && !fila.desviaciones.empty())
+        {
+            throw invalid_argument("La fila " + to_string(fila.fila + 1) +
+                                   " es una igualdad con coeficientes inciertos: no tiene contraparte robusta.");
+        }
+    }
+}
+
+// Lado de una fila protegido con presupuesto: a·x + signo·(Γ·z + Σ p_j) frente a b
+struct LadoPresupuesto
+{
+    int fila;
+    double signo; // +1 para "<=", -1 para ">="
+    int z;
+    std::vector<std::pair<int, double>> desviaciones; // (variable con |x_j|, â_j)
+};
+
+/**
+ * Parte común de la contraparte: para cada lado finito de una fila incierta,
+ *   caja:        a·x + Σ â_j·|x_j| <= b
+ *   presupuesto: a·x + Γ·z + Σ p_j <= b,  z + p_j >= â_j·|x_j|,  z, p >= 0
+ * (la segunda es el dual del peor caso con a lo sumo Γ desviaciones, exacta
+ * también con Γ fraccionario). Con x_j >= 0, |x_j| es la propia variable;
+ * si no, se agrega y_j >= |x_j|. Una fila con dos lados finitos se separa.
+ * Aquí se arman las filas de caja y las z; las filas de protección de cada
+ * lado con presupuesto se devuelven en lados para agregarlas después.
+ */
+static ModeloLineal armarContraparte(const ModeloLineal &modelo, const vector<IncertidumbreFila> &incertidumbre,
+                                     vector<LadoPresupuesto> &lados)
+{
+    validarIncertidumbre(modelo, incertidumbre);
+
+    ModeloLineal robusto = modelo;
+    vector<int> magnitud(modelo.getNumVariables(), -1);
+    auto variableMagnitud = [&](int j)
+    {
+        if (modelo.cotaInferior[j] >= 0.0)
+            return j;
+        if (magnitud[j] < 0)
+        {
+            magnitud[j] = robusto.agregarVariable(0.0);
+            robusto.agregarFila({make_pair(magnitud[j], 1.0), make_pair(j, -1.0)}, ">=", 0.0);
+            robusto.agregarFila({make_pair(magnitud[j], 1.0), make_pair(j, 1.0)}, ">=", 0.0);
+        }
+        return magnitud[j];
+    };
+
+    lados.clear();
+    for (const auto &incierta : incertidumbre)
+    {
+        vector<pair<int, double>> desviaciones;
+        for (const auto &desviacion : incierta.desviaciones)
+        {
+            if (desviacion.second > 0.0)
+                desviaciones.push_back(make_pair(variableMagnitud(desviacion.first), desviacion.second));
+        }
+        if (desviaciones.empty())
+            continue;
+
+        int i = incierta.fila;
+        double inferior = modelo.filaInferior[i];
+        double superior = modelo.filaSuperior[i];
+        bool caja = incierta.presupuesto >= static_cast<double>(desviaciones.size());
+
+        // Lado "<=" en la fila original; el lado ">=" en una fila nueva si también es finito
+        vector<pair<int, double>> filasLado;
+        if (superior < INFINITO_LP)
+        {
+            robusto.filaInferior[i] = -INFINITO_LP;
+            filasLado.push_back(make_pair(i, 1.0));
+        }
+        if (inferior > -INFINITO_LP)
+        {
+            int fila = superior < INFINITO_LP ? robusto.agregarFila(modelo.filas[i], ">=", inferior) : i;
+            filasLado.push_back(make_pair(fila, -1.0));
+        }
+
+        for (const auto &filaLado : filasLado)
+        {
+            if (caja)
+            {
+                for (const auto &desviacion : desviaciones)
+                    sumarCoeficiente(robusto.filas[filaLado.first], desviacion.first, filaLado.second * desviacion.second);
+                continue;
+            }
+
+            LadoPresupuesto lado;
+            lado.fila = filaLado.first;
+            lado.signo = filaLado.second;
+            lado.z = robusto.agregarVariable(0.0);
+            lado.desviaciones = desviaciones;
+            robusto.filas[lado.fila].push_back(make_pair(lado.z, lado.signo * incierta.presupuesto));
+            lados.push_back(lado);
+        }
+    }
+    return robusto;
+}
+
+ModeloLineal construirContraparteRobusta(const ModeloLineal &modelo, const vector<IncertidumbreFila> &incertidumbre)
+{
+    TRAZA_AMBITO("robusto.contraparte", "calculo");
+    vector<LadoPresupuesto> lados;
+    ModeloLineal robusto = armarContraparte(modelo, incertidumbre, lados);
+    for (const auto &lado : lados)
+    {
+        for (const auto &desviacion : lado.desviaciones)
+        {
+            int p = robusto.agregarVariable(0.0);
+            robusto.filas[lado.fila].push_back(make_pair(p, lado.signo));
+            robusto.agregarFila({make_pair(lado.z, 1.0), make_pair(p, 1.0), make_pair(desviacion.first, -desviacion.second)},
+                                ">=", 0.0);
+        }
+    }
+    return robusto;
+}
+
+/**
+ * Resuelve la contraparte con cortes, sin z ni p_j. Una fila incierta que
+ * necesita cortes pasa a a·x - s = 0, con sus cotas en una variable s. En un
+ * plan x, el peor caso de un lado con presupuesto Γ suma las ⌊Γ⌋ mayores
+ * â_j·|x_j| y la fracción Γ - ⌊Γ⌋ de la siguiente (pesos u_j); si con eso el
+ * lado no se cumple, se agrega el corte
+ *   s + Σ u_j·â_j·σ_j·x_j <= b   (σ_j el signo de x_j)
+ * que cumple todo plan robusto y tiene a lo sumo ⌈Γ⌉ + 1 coeficientes. Cada
+ * ronda agrega a lo sumo un corte por lado al mismo resolvedor y reoptimiza
+ * con el dual; como los pesos y los signos posibles son finitos, al terminar
+ * el plan es óptimo para la contraparte completa. Las filas de la matriz no
+ * se copian en los cortes, así que el costo sigue cerca del nominal aunque Γ
+ * crezca.
+ */
+ResultadoRobusto resolverRobusto(const ModeloLineal &modelo, const vector<IncertidumbreFila> &incertidumbre,
+                                 const OpcionesSimplex &opciones, const TokenCancelacion *token)
+{
+    TRAZA_AMBITO("robusto.resolver", "calculo");
+    validarIncertidumbre(modelo, incertidumbre);
+
+    // Lados finitos de las filas inciertas; la variable s de la fila se crea
+    // con el primer corte, así la primera ronda es el modelo nominal
+    struct LadoCortes
+    {
+        const IncertidumbreFila *incierta;
+        double signo; // +1 para "<=", -1 para ">="
+    };
+    vector<LadoCortes> lados;
+    ResultadoRobusto resultado;
+    for (const auto &incierta : incertidumbre)
+    {
+        size_t desviadas = 0;
+        for (const auto &desviacion : incierta.desviaciones)
+            desviadas += desviacion.second > 0.0 ? 1 : 0;
+        if (desviadas == 0)
+            continue;
+        for (double signo : {1.0, -1.0})
+        {
+            if ((signo > 0.0 ? modelo.filaSuperior[incierta.fila] : -modelo.filaInferior[incierta.fila]) == INFINITO_LP)
+                continue;
+            lados.push_back({&incierta, signo});
+            if (incierta.presupuesto < static_cast<double>(desviadas))
+                resultado.filasPosibles += desviadas;
+        }
+    }
+
+    ResolvedorSimplex simplex;
+    simplex.setOpciones(opciones);
+    simplex.cargar(modelo);
+    vector<int> actividad(modelo.getNumFilas(), -1);
+    vector<pair<double, int>> protecciones;
+    vector<pair<int, double>> corte;
+
+    while (true)
+    {
+        resultado.estado = simplex.resolver(token);
+        resultado.iteraciones += simplex.getIteraciones();
+        resultado.rondas++;
+        if (resultado.estado != LP_OPTIMO)
+            return resultado;
+
+        size_t agregados = 0;
+        for (const auto &lado : lados)
+        {
+            const IncertidumbreFila &incierta = *lado.incierta;
+
+            // Las desviaciones de mayor â_j·|x_j| primero, hasta agotar Γ
+            protecciones.clear();
+            for (size_t d = 0; d < incierta.desviaciones.size(); d++)
+            {
+                const auto &desviacion = incierta.desviaciones[d];
+                if (desviacion.second > 0.0)
+                    protecciones.push_back(
+                        make_pair(desviacion.second * abs(simplex.getValor(desviacion.first)), static_cast<int>(d)));
+            }
+            size_t enteras = static_cast<size_t>(min(incierta.presupuesto, static_cast<double>(protecciones.size())));
+            size_t tomadas = min(protecciones.size(), enteras + 1);
+            partial_sort(protecciones.begin(), protecciones.begin() + tomadas, protecciones.end(),
+                         greater<pair<double, int>>());
+            double fraccion = incierta.presupuesto - enteras;
+            double peor = 0.0;
+            for (size_t t = 0; t < tomadas; t++)
+                peor += (t < enteras ? 1.0 : fraccion) * protecciones[t].first;
+
+            int i = incierta.fila;
+            double cota = lado.signo > 0.0 ? modelo.filaSuperior[i] : modelo.filaInferior[i];
+            double nominal = actividad[i] < 0 ? simplex.getActividadFila(i) : simplex.getValor(actividad[i]);
+            if (lado.signo * (nominal - cota) + peor <= TOL_PROTECCION * max(1.0, abs(cota)))
+                continue;
+
+            if (actividad[i] < 0)
+            {
+                actividad[i] =
+                    simplex.agregarVariable(0.0, modelo.filaInferior[i], modelo.filaSuperior[i], {make_pair(i, -1.0)});
+                simplex.cambiarCotasFila(i, 0.0, 0.0);
+            }
+            corte.assign(1, make_pair(actividad[i], 1.0));
+            for (size_t t = 0; t < tomadas; t++)
+            {
+                const auto &desviacion = incierta.desviaciones[protecciones[t].second];
+                int j = desviacion.first;
+                double peso = t < enteras ? 1.0 : fraccion;
+                double sentido = modelo.cotaInferior[j] >= 0.0 ? 1.0
+                                 : modelo.cotaSuperior[j] <= 0.0 || simplex.getValor(j) < 0.0 ? -1.0
+                                                                                             : 1.0;
+                if (peso > 0.0)
+                    sumarCoeficiente(corte, j, lado.signo * peso * desviacion.second * sentido);
+            }
+            if (lado.signo > 0.0)
+                simplex.agregarFila(corte, -INFINITO_LP, cota);
+            else
+                simplex.agregarFila(corte, cota, INFINITO_LP);
+            agregados++;
+        }
+        resultado.filasProteccion += agregados;
+        if (agregados == 0)
+            break;
+    }
+
+    resultado.valores = simplex.getValores();
+    resultado.valores.resize(modelo.getNumVariables());
+    resultado.objetivo = 0.0;
+    for (int j = 0; j < modelo.getNumVariables(); j++)
+        resultado.objetivo += modelo.objetivo[j] * resultado.valores[j];
+    return resultado;
+}
+
+vector<IncertidumbreFila> incertidumbreRelativa(const ModeloLineal &modelo, double fraccion, double presupuesto)
+{
+    vector<IncertidumbreFila> incertidumbre;
+    for (int i = 0; i < modelo.getNumFilas(); i++)
+    {
+        vector<pair<int, double>> desviaciones;
+        for (const auto &coeficiente : modelo.filas[i])
+        {
+            if (coeficiente.second != 0.0)
+                desviaciones.push_back(make_pair(coeficiente.first, fraccion * abs(coeficiente.second)));
+        }
+        if (!desviaciones.empty() && modelo.filaInferior[i] != modelo.filaSuperior[i])
+            incertidumbre.push_back(IncertidumbreFila(i, desviaciones, presupuesto));
+    }
+    return incertidumbre;
+}
+
+// ===== BENCHMARK =====
+
+// Resultado de simular el plan con coeficientes al azar dentro de sus intervalos
+struct SimulacionIncumplimiento
+{
+    double escenariosConExceso; // Fracción de escenarios con alguna fila incumplida
+    double filasExcedidas;      // Promedio de filas incumplidas por escenario
+};
+
+/**
+ * Sortea cada coeficiente incierto de forma uniforme e independiente en
+ * [a_j - â_j, a_j + â_j] y cuenta las filas que el plan deja de cumplir
+ */
+static SimulacionIncumplimiento simularIncumplimiento(const ModeloLineal &modelo,
+                                                      const vector<IncertidumbreFila> &incertidumbre,
+                                                      const vector<double> &x, size_t escenarios, unsigned semilla)
+{
+    struct FilaSimulada
+    {
+        double actividad, inferior, superior;
+        vector<double> desvios; // â_j·x_j
+    };
+    vector<FilaSimulada> filas;
+    for (const auto &incierta : incertidumbre)
+    {
+        FilaSimulada fila;
+        fila.actividad = 0.0;
+        for (const auto &coeficiente : modelo.filas[incierta.fila])
+            fila.actividad += coeficiente.second * x[coeficiente.first];
+        fila.inferior = modelo.filaInferior[incierta.fila];
+        fila.superior = modelo.filaSuperior[incierta.fila];
+        for (const auto &desviacion : incierta.desviaciones)
+            fila.desvios.push_back(desviacion.second * x[desviacion.first]);
+        filas.push_back(fila);
+    }
+
+    mt19937 generador(semilla);
+    uniform_real_distribution<double> unidad(-1.0, 1.0);
+    size_t conExceso = 0, excedidas = 0;
+    for (size_t e = 0; e < escenarios; e++)
+    {
+        size_t enEscenario = 0;
+        for (const auto &fila : filas)
+        {
+            double actividad = fila.actividad;
+            for (double desvio : fila.desvios)
+                actividad += desvio * unidad(generador);
+            double tolerancia = 1e-7 * max(1.0, abs(actividad));
+            if (actividad > fila.superior + tolerancia || actividad < fila.inferior - tolerancia)
+                enEscenario++;
+        }
+        excedidas += enEscenario;
+        if (enEscenario > 0)
+            conExceso++;
+    }
+    SimulacionIncumplimiento resultado;
+    resultado.escenariosConExceso = static_cast<double>(conExceso) / escenarios;
+    resultado.filasExcedidas = static_cast<double>(excedidas) / escenarios;
+    return resultado;
+}
+
+// Plan de productos con recursos compartidos; cada producto usa pocos recursos
+static ModeloLineal construirPlanRecursos(int productos, int recursos, unsigned semilla)
+{
+    mt19937 generador(semilla);
+    uniform_real_distribution<double> horas(0.5, 4.0);
+    uniform_real_distribution<double> ganancia(20.0, 90.0);
+    uniform_real_distribution<double> demanda(20.0, 100.0);
+    uniform_int_distribution<int> recurso(0, recursos - 1);
+
+    ModeloLineal modelo;
+    vector<vector<pair<int, double>>> filas(recursos);
+    vector<double> necesidad(recursos, 0.0);
+    for (int j = 0; j < productos; j++)
+    {
+        double tope = demanda(generador);
+        int x = modelo.agregarVariable(ganancia(generador), 0.0, tope);
+        for (int u = 0; u < 6; u++)
+        {
+            int r = recurso(generador);
+            double h = horas(generador);
+            sumarCoeficiente(filas[r], x, h);
+            necesidad[r] += h * tope;
+        }
+    }
+    for (int r = 0; r < recursos; r++)
+        modelo.agregarFila(filas[r], "<=", 0.4 * necesidad[r]);
+    return modelo;
+}
+
+/**
+ * Compara el plan nominal con los robustos (presupuestos crecientes y caja):
+ * ganancia, tiempo de resolución y frecuencia de excesos simulados
+ */
+void ejecutarBenchmarkRobusto()
+{
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: OPTIMIZACIÓN ROBUSTA" << endl;
+    cout << string(60, '=') << endl;
+
+    auto resolverPlan = [](const ModeloLineal &modelo, double &segundos, long &iteraciones)
+    {
+        auto inicio = chrono::steady_clock::now();
+        ResolvedorSimplex simplex;
+        simplex.cargar(modelo);
+        EstadoLP estado = simplex.resolver();
+        segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+        iteraciones = simplex.getIteraciones();
+        if (estado != LP_OPTIMO)
+            throw runtime_error("La contraparte robusta no tiene óptimo.");
+        return simplex.getValores();
+    };
+    auto ganancia = [](const ModeloLineal &modelo, const vector<double> &x)
+    {
+        double total = 0.0;
+        for (int j = 0; j < modelo.getNumVariables(); j++)
+            total += modelo.objetivo[j] * x[j];
+        return total;
+    };
+
+    // Flair con horas por mesa y por silla estimadas con ±10%
+    ModeloProduccion flair;
+    flair.precioMesa = 70.0;
+    flair.precioSilla = 50.0;
+    flair.restricciones.push_back(4 * X1 + 3 * X2 <= 240);
+    flair.restricciones.push_back(2 * X1 + X2 <= 100);
+    ModeloLineal lineal = construirModeloLineal(flair);
+
+    cout << "\nFlair con las horas por mueble inciertas en ±10%:" << endl;
+    const double presupuestosFlair[] = {0.0, 1.0, INFINITO_LP};
+    for (double presupuesto : presupuestosFlair)
+    {
+        vector<IncertidumbreFila> incertidumbre = incertidumbreRelativa(lineal, 0.10, presupuesto);
+        ModeloLineal robusto = construirContraparteRobusta(lineal, incertidumbre);
+        double segundos;
+        long iteraciones;
+        vector<double> x = resolverPlan(robusto, segundos, iteraciones);
+        SimulacionIncumplimiento simulacion =
+            simularIncumplimiento(lineal, incertidumbreRelativa(lineal, 0.10), x, 100000, 17);
+
+        cout << "  • " << (presupuesto == 0.0 ? "Nominal" : presupuesto < INFINITO_LP ? "Presupuesto 1" : "Caja")
+             << ": " << x[0] << " mesas, " << x[1] << " sillas, ganancia $" << ganancia(lineal, x)
+             << ", horas excedidas en el " << simulacion.escenariosConExceso * 100 << "% de los escenarios" << endl;
+    }
+
+    // Plan grande con ±15% en cada coeficiente
+    ModeloLineal plan = construirPlanRecursos(1500, 300, 9);
+    vector<IncertidumbreFila> todas = incertidumbreRelativa(plan, 0.15);
+    double segundosNominal;
+    long iteracionesNominal;
+    vector<double> nominal = resolverPlan(plan, segundosNominal, iteracionesNominal);
+    double gananciaNominal = ganancia(plan, nominal);
+    SimulacionIncumplimiento simulacionNominal = simularIncumplimiento(plan, todas, nominal, 2000, 23);
+
+    cout << "\nPlan de 1500 productos y 300 recursos, coeficientes inciertos en ±15%:" << endl;
+    cout << "  • Nominal: " << plan.getNumVariables() << " variables, " << plan.getNumFilas() << " filas, "
+         << segundosNominal * 1000 << " ms (" << iteracionesNominal << " iteraciones), ganancia $" << gananciaNominal
+         << endl;
+    cout << "    excesos en el " << simulacionNominal.escenariosConExceso * 100 << "% de los escenarios, "
+         << simulacionNominal.filasExcedidas << " filas por escenario" << endl;
+
+    const double presupuestos[] = {1.0, 6.0, INFINITO_LP};
+    for (double presupuesto : presupuestos)
+    {
+        auto inicio = chrono::steady_clock::now();
+        ResultadoRobusto robusto = resolverRobusto(plan, incertidumbreRelativa(plan, 0.15, presupuesto));
+        double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+        if (robusto.estado != LP_OPTIMO)
+            throw runtime_error("La contraparte robusta no tiene óptimo.");
+        SimulacionIncumplimiento simulacion = simularIncumplimiento(plan, todas, robusto.valores, 2000, 23);
+
+        cout << "  • " << (presupuesto < INFINITO_LP ? "Presupuesto " + to_string(static_cast<int>(presupuesto)) : string("Caja"))
+             << ": " << segundos * 1000 << " ms (" << segundos / segundosNominal << "x, " << robusto.iteraciones
+             << " iteraciones en " << robusto.rondas << " rondas, " << robusto.filasProteccion << " cortes; la completa tiene "
+             << robusto.filasPosibles << " filas de protección), ganancia $" << robusto.objetivo << " ("
+             << 100.0 * (1.0 - robusto.objetivo / gananciaNominal) << "% menos)" << endl;
+        cout << "    excesos en el " << simulacion.escenariosConExceso * 100 << "% de los escenarios, "
+             << simulacion.filasExcedidas << " filas por escenario" << endl;
+    }
+
+    // La contraparte completa y los cortes deben dar el mismo óptimo
+    ModeloLineal mediano = construirPlanRecursos(300, 60, 4);
+    cout << "\nContraparte completa contra cortes (300 productos y 60 recursos):" << endl;
+    const double presupuestosMediano[] = {1.0, 2.5, 6.0};
+    for (double presupuesto : presupuestosMediano)
+    {
+        vector<IncertidumbreFila> incertidumbre = incertidumbreRelativa(mediano, 0.15, presupuesto);
+        ModeloLineal completa = construirContraparteRobusta(mediano, incertidumbre);
+        double segundosCompleta;
+        long iteracionesCompleta;
+        vector<double> x = resolverPlan(completa, segundosCompleta, iteracionesCompleta);
+        auto inicio = chrono::steady_clock::now();
+        ResultadoRobusto conCortes = resolverRobusto(mediano, incertidumbre);
+        double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+        cout << "  • Presupuesto " << presupuesto << ": completa " << completa.getNumFilas() << " filas, "
+             << segundosCompleta * 1000 << " ms, ganancia $" << ganancia(completa, x) << "; con cortes "
+             << segundos * 1000 << " ms, ganancia $" << conCortes.objetivo << endl;
+        if (conCortes.estado != LP_OPTIMO ||
+            abs(ganancia(completa, x) - conCortes.objetivo) > 1e-6 * max(1.0, abs(conCortes.objetivo)))
+        {
+            mostrarMensajeError("Las dos formas de la contraparte no coinciden.");
+        }
+    }
+}
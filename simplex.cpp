@@ -0,0 +1,1702 @@
+/**
+ * MOTOR DE PROGRAMACIÓN LINEAL GENERAL
+ * Método símplex revisado con cotas en las variables (primal y dual)
+ *
+ * Cada fila i tiene una variable lógica r_i = a_i·x cuyas cotas son las de
+ * la fila, de modo que el sistema es [A  -I]·z = 0 con cotas en todo z.
+ * La base inicial está formada por las variables lógicas (B = -I).
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <random>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define NUCLEOS_SSE2
+#endif
+
+using namespace std;
+
+// Tolerancias numéricas
+static const double TOL_PRIMAL = 1e-7;   // Violación de cotas aceptada
+static const double TOL_DUAL = 1e-7;     // Costo reducido considerado cero
+static const double TOL_PIVOTE = 1e-9;   // Pivote mínimo en la prueba de razón
+static const int MAX_ACTUALIZACIONES = 64; // Pivoteos antes de recalcular B⁻¹
+static const int MAX_CANDIDATAS = 8;       // Entrantes que se guardan de cada segmento de precios
+static const int COLUMNAS_POR_FILA_PARCIAL = 10; // Con menos, los precios recorren todas las columnas
+static const double MAX_PESO_DEVEX = 1e6;  // Con pesos mayores se reinicia el marco de referencia
+static const double DENSIDAD_FILA_DISPERSA = 0.1; // Con menos no nulos en ρ, ρ·A se calcula recorriendo A por filas
+static const int MIN_FILAS_LU_DISPERSA = 64;      // En bases más chicas la B⁻¹ densa es más rápida que la LU
+
+int ModeloLineal::agregarVariable(double costo, double inferior, double superior)
+{
+    if (inferior > superior)
+    {
+        throw invalid_argument("La cota inferior de la variable supera a la superior.");
+    }
+    objetivo.push_back(costo);
+    cotaInferior.push_back(inferior);
+    cotaSuperior.push_back(superior);
+    return getNumVariables() - 1;
+}
+
+int ModeloLineal::agregarFila(vector<pair<int, double>> coeficientes, const string &operador, double valor)
+{
+    for (const auto &coeficiente : coeficientes)
+    {
+        if (coeficiente.first < 0 || coeficiente.first >= getNumVariables())
+        {
+            throw out_of_range("La fila hace referencia a una variable inexistente.");
+        }
+    }
+
+    if (operador == "<=")
+    {
+        filaInferior.push_back(-INFINITO_LP);
+        filaSuperior.push_back(valor);
+    }
+    else if (operador == ">=")
+    {
+        filaInferior.push_back(valor);
+        filaSuperior.push_back(INFINITO_LP);
+    }
+    else if (operador == "=")
+    {
+        filaInferior.push_back(valor);
+        filaSuperior.push_back(valor);
+    }
+    else
+    {
+        throw invalid_argument("Operador de fila inválido: " + operador);
+    }
+
+    filas.push_back(move(coeficientes));
+    return getNumFilas() - 1;
+}
+
+double FuncionPorTramos::evaluar(double x) const
+{
+    if (x < puntos.front() - TOL_PRIMAL || x > puntos.back() + TOL_PRIMAL)
+    {
+        throw out_of_range("El punto está fuera del dominio de la función por tramos.");
+    }
+    int tramo = static_cast<int>(upper_bound(puntos.begin(), puntos.end(), x) - puntos.begin()) - 1;
+    tramo = max(0, min(tramo, getNumTramos() - 1));
+    return valores[tramo] + pendiente(tramo) * (x - puntos[tramo]);
+}
+
+// Como costo, es convexa si las pendientes no decrecen
+bool FuncionPorTramos::esConvexa() const
+{
+    for (int k = 1; k < getNumTramos(); k++)
+    {
+        if (pendiente(k) < pendiente(k - 1) - 1e-12)
+            return false;
+    }
+    return true;
+}
+
+FuncionPorTramos construirCostoEscalonado(const vector<double> &limites, const vector<double> &precios)
+{
+    if (limites.empty() || limites.size() != precios.size())
+    {
+        throw invalid_argument("Cada escalón del costo necesita un límite y un precio.");
+    }
+
+    FuncionPorTramos funcion;
+    funcion.puntos.push_back(0.0);
+    funcion.valores.push_back(0.0);
+    for (size_t k = 0; k < limites.size(); k++)
+    {
+        double total = funcion.valores.back() + precios[k] * (limites[k] - funcion.puntos.back());
+        funcion.puntos.push_back(limites[k]);
+        funcion.valores.push_back(total);
+    }
+    return funcion;
+}
+
+void ModeloLineal::agregarCostoPorTramos(int variable, const FuncionPorTramos &funcion)
+{
+    if (variable < 0 || variable >= getNumVariables())
+    {
+        throw out_of_range("El costo por tramos hace referencia a una variable inexistente.");
+    }
+    if (funcion.puntos.size() < 2 || funcion.puntos.size() != funcion.valores.size())
+    {
+        throw invalid_argument("La función por tramos necesita al menos dos quiebres con su valor.");
+    }
+    for (size_t k = 0; k < funcion.puntos.size(); k++)
+    {
+        if (!isfinite(funcion.puntos[k]) || !isfinite(funcion.valores[k]) ||
+            (k > 0 && funcion.puntos[k] <= funcion.puntos[k - 1]))
+        {
+            throw invalid_argument("Los quiebres de la función por tramos deben ser finitos y crecientes.");
+        }
+    }
+    for (const auto &costo : costosPorTramos)
+    {
+        if (costo.variable == variable)
+            throw invalid_argument("La variable ya tiene un costo por tramos.");
+    }
+
+    costosPorTramos.push_back({variable, funcion});
+}
+
+ModeloLineal construirModeloLineal(const ModeloProduccion &modelo)
+{
+    ModeloLineal lineal;
+    lineal.agregarVariable(modelo.precioMesa);
+    lineal.agregarVariable(modelo.precioSilla);
+
+    for (const auto &r : modelo.restricciones)
+    {
+        vector<pair<int, double>> coeficientes;
+        if (r.coeficienteX1 != 0)
+            coeficientes.push_back(make_pair(0, r.coeficienteX1));
+        if (r.coeficienteX2 != 0)
+            coeficientes.push_back(make_pair(1, r.coeficienteX2));
+        lineal.agregarFila(coeficientes, r.operador, r.valorConstante);
+    }
+
+    return lineal;
+}
+
+// ===== NÚCLEOS DENSOS =====
+// Recorren vectores contiguos de n + m valores sin saltos condicionales; la
+// versión SSE2 procesa dos variables por instrucción y da el mismo resultado
+// que la escalar (el primer índice entre empates).
+
+#ifdef NUCLEOS_SSE2
+// Máscara de selección: a donde mascara es verdadera, b en el resto
+static inline __m128d mezclar(__m128d mascara, __m128d a, __m128d b)
+{
+    return _mm_or_pd(_mm_and_pd(mascara, a), _mm_andnot_pd(mascara, b));
+}
+#endif
+
+// puntajes = atractivo² / peso (0 si el atractivo no pasa la tolerancia);
+// devuelve el índice del mayor puntaje o -1
+static int nucleoPrecios(const double *atractivo, const double *pesos, double *puntajes, int cantidad, bool vectorial)
+{
+    int mejor = -1;
+    double mayor = 0.0;
+    int k = 0;
+#ifdef NUCLEOS_SSE2
+    if (vectorial)
+    {
+        // Dos acumuladores independientes: cuatro variables por vuelta
+        __m128d mayorV[2] = {_mm_setzero_pd(), _mm_setzero_pd()};
+        __m128d mejorV[2] = {_mm_set1_pd(-1.0), _mm_set1_pd(-1.0)};
+        __m128d indiceV[2] = {_mm_set_pd(1.0, 0.0), _mm_set_pd(3.0, 2.0)};
+        const __m128d cuatro = _mm_set1_pd(4.0);
+        const __m128d tolerancia = _mm_set1_pd(TOL_DUAL);
+        for (; k + 4 <= cantidad; k += 4)
+        {
+            for (int mitad = 0; mitad < 2; mitad++)
+            {
+                __m128d a = _mm_loadu_pd(atractivo + k + 2 * mitad);
+                __m128d p = _mm_div_pd(_mm_mul_pd(a, a), _mm_loadu_pd(pesos + k + 2 * mitad));
+                p = _mm_and_pd(p, _mm_cmpgt_pd(a, tolerancia));
+                _mm_storeu_pd(puntajes + k + 2 * mitad, p);
+                __m128d supera = _mm_cmpgt_pd(p, mayorV[mitad]);
+                mayorV[mitad] = mezclar(supera, p, mayorV[mitad]);
+                mejorV[mitad] = mezclar(supera, indiceV[mitad], mejorV[mitad]);
+                indiceV[mitad] = _mm_add_pd(indiceV[mitad], cuatro);
+            }
+        }
+        double mayores[4];
+        double mejores[4];
+        _mm_storeu_pd(mayores, mayorV[0]);
+        _mm_storeu_pd(mayores + 2, mayorV[1]);
+        _mm_storeu_pd(mejores, mejorV[0]);
+        _mm_storeu_pd(mejores + 2, mejorV[1]);
+        for (int carril = 0; carril < 4; carril++)
+        {
+            if (mejores[carril] >= 0.0 &&
+                (mayores[carril] > mayor || (mayores[carril] == mayor && mejores[carril] < mejor)))
+            {
+                mayor = mayores[carril];
+                mejor = static_cast<int>(mejores[carril]);
+            }
+        }
+    }
+#else
+    (void)vectorial;
+#endif
+    for (; k < cantidad; k++)
+    {
+        double p = atractivo[k] > TOL_DUAL ? atractivo[k] * atractivo[k] / pesos[k] : 0.0;
+        puntajes[k] = p;
+        if (p > mayor)
+        {
+            mayor = p;
+            mejor = k;
+        }
+    }
+    return mejor;
+}
+
+// pesos = max(pesos, fila²·factor); devuelve el mayor peso
+static double nucleoPesosDevex(double *pesos, const double *fila, double factor, int cantidad, bool vectorial)
+{
+    double mayor = 0.0;
+    int k = 0;
+#ifdef NUCLEOS_SSE2
+    if (vectorial)
+    {
+        __m128d factorV = _mm_set1_pd(factor);
+        __m128d mayorV = _mm_setzero_pd();
+        for (; k + 2 <= cantidad; k += 2)
+        {
+            __m128d f = _mm_loadu_pd(fila + k);
+            __m128d w = _mm_max_pd(_mm_loadu_pd(pesos + k), _mm_mul_pd(_mm_mul_pd(f, f), factorV));
+            _mm_storeu_pd(pesos + k, w);
+            mayorV = _mm_max_pd(mayorV, w);
+        }
+        double mayores[2];
+        _mm_storeu_pd(mayores, mayorV);
+        mayor = max(mayores[0], mayores[1]);
+    }
+#else
+    (void)vectorial;
+#endif
+    for (; k < cantidad; k++)
+    {
+        pesos[k] = max(pesos[k], fila[k] * fila[k] * factor);
+        mayor = max(mayor, pesos[k]);
+    }
+    return mayor;
+}
+
+// razones = reducido / |fila| para las variables que pueden moverse en el
+// sentido que sirve (fila > 0: subir; fila < 0: bajar), infinito en el resto;
+// devuelve la menor razón
+static double nucleoRazonesDuales(const double *fila, const double *reducidos, const double *sube, const double *baja,
+                                  double *razones, int cantidad, bool vectorial)
+{
+    double menor = INFINITO_LP;
+    int k = 0;
+#ifdef NUCLEOS_SSE2
+    if (vectorial)
+    {
+        const __m128d cero = _mm_setzero_pd();
+        const __m128d infinito = _mm_set1_pd(INFINITO_LP);
+        const __m128d pivoteMinimo = _mm_set1_pd(TOL_PIVOTE);
+        const __m128d sinSigno = _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffLL));
+        __m128d menorV = infinito;
+        for (; k + 2 <= cantidad; k += 2)
+        {
+            __m128d f = _mm_loadu_pd(fila + k);
+            __m128d absoluto = _mm_and_pd(f, sinSigno);
+            __m128d puedeSubir = _mm_and_pd(_mm_cmpgt_pd(f, cero), _mm_cmpgt_pd(_mm_loadu_pd(sube + k), cero));
+            __m128d puedeBajar = _mm_and_pd(_mm_cmplt_pd(f, cero), _mm_cmpgt_pd(_mm_loadu_pd(baja + k), cero));
+            __m128d elegible = _mm_and_pd(_mm_cmpge_pd(absoluto, pivoteMinimo), _mm_or_pd(puedeSubir, puedeBajar));
+            __m128d r = mezclar(elegible, _mm_div_pd(_mm_loadu_pd(reducidos + k), absoluto), infinito);
+            _mm_storeu_pd(razones + k, r);
+            menorV = _mm_min_pd(menorV, r);
+        }
+        double menores[2];
+        _mm_storeu_pd(menores, menorV);
+        menor = min(menores[0], menores[1]);
+    }
+#else
+    (void)vectorial;
+#endif
+    for (; k < cantidad; k++)
+    {
+        double f = fila[k];
+        bool elegible = abs(f) >= TOL_PIVOTE && ((f > 0.0 && sube[k] > 0.0) || (f < 0.0 && baja[k] > 0.0));
+        razones[k] = elegible ? reducidos[k] / abs(f) : INFINITO_LP;
+        menor = min(menor, razones[k]);
+    }
+    return menor;
+}
+
+// Constructor
+ResolvedorSimplex::ResolvedorSimplex()
+    : n(0), m(0), actualizacionesDesdeRefactorizacion(0), estado(LP_SIN_RESOLVER), iteraciones(0), limiteIteraciones(1000000),
+      inicioSegmento(0)
+{
+}
+
+void ResolvedorSimplex::cargar(const ModeloLineal &modelo)
+{
+    n = modelo.getNumVariables();
+    m = modelo.getNumFilas();
+
+    costo.assign(n + m, 0.0);
+    inferior.assign(n + m, 0.0);
+    superior.assign(n + m, 0.0);
+    for (int j = 0; j < n; j++)
+    {
+        costo[j] = modelo.objetivo[j];
+        inferior[j] = modelo.cotaInferior[j];
+        superior[j] = modelo.cotaSuperior[j];
+    }
+    for (int i = 0; i < m; i++)
+    {
+        inferior[n + i] = modelo.filaInferior[i];
+        superior[n + i] = modelo.filaSuperior[i];
+    }
+
+    // Guardar la matriz por filas y por columnas
+    matriz.cargar(m, n, modelo.filas);
+
+    valores.assign(n + m, 0.0);
+
+    // Costos por tramos: la variable arranca en el tramo de su cota inferior
+    indiceTramos.assign(n, -1);
+    tramosVariables.clear();
+    for (const auto &costoTramos : modelo.costosPorTramos)
+    {
+        const FuncionPorTramos &funcion = costoTramos.funcion;
+        int j = costoTramos.variable;
+        if (!funcion.esConvexa())
+        {
+            throw invalid_argument("El costo por tramos de la variable " + to_string(j + 1) +
+                                   " no es convexo; debe resolverse con el modo entero.");
+        }
+
+        TramosVariable tramos;
+        tramos.funcion = funcion;
+        tramos.costoLineal = costo[j];
+        tramos.inferior = max(inferior[j], funcion.puntos.front());
+        tramos.superior = min(superior[j], funcion.puntos.back());
+        tramos.tramo = 0;
+        if (tramos.inferior > tramos.superior)
+        {
+            throw invalid_argument("Las cotas de la variable " + to_string(j + 1) +
+                                   " quedan fuera del dominio de su costo por tramos.");
+        }
+        indiceTramos[j] = static_cast<int>(tramosVariables.size());
+        tramosVariables.push_back(tramos);
+        valores[j] = tramos.inferior;
+        ubicarTramo(j);
+    }
+
+    for (int j = 0; j < n; j++)
+    {
+        colocarEnCota(j);
+    }
+    reiniciarBaseLogica();
+    estado = LP_SIN_RESOLVER;
+}
+
+// Cotas y costo de la variable j en el tramo indicado
+void ResolvedorSimplex::fijarTramo(int j, int tramo)
+{
+    TramosVariable &tramos = tramosVariables[indiceTramos[j]];
+    const FuncionPorTramos &funcion = tramos.funcion;
+    tramos.tramo = tramo;
+    inferior[j] = max(funcion.puntos[tramo], tramos.inferior);
+    superior[j] = min(funcion.puntos[tramo + 1], tramos.superior);
+    costo[j] = tramos.costoLineal - funcion.pendiente(tramo);
+}
+
+// Elige el tramo que contiene el valor actual de la variable j (acotado a sus cotas)
+void ResolvedorSimplex::ubicarTramo(int j)
+{
+    const TramosVariable &tramos = tramosVariables[indiceTramos[j]];
+    const vector<double> &puntos = tramos.funcion.puntos;
+    double x = max(tramos.inferior, min(valores[j], tramos.superior));
+    int tramo = static_cast<int>(upper_bound(puntos.begin(), puntos.end(), x) - puntos.begin()) - 1;
+    int ultimo = tramos.funcion.getNumTramos() - 1;
+    tramo = max(0, min(tramo, ultimo));
+
+    // Un quiebre que coincide con la cota superior deja la variable en el tramo anterior
+    if (tramo > 0 && puntos[tramo] >= tramos.superior)
+        tramo--;
+    fijarTramo(j, tramo);
+}
+
+// Cada variable básica con costo por tramos pasa al tramo de su valor actual
+void ResolvedorSimplex::ubicarTramosBasicos()
+{
+    for (int j = 0; j < n && !tramosVariables.empty(); j++)
+    {
+        if (indiceTramos[j] >= 0 && posicionBase[j] >= 0)
+            ubicarTramo(j);
+    }
+}
+
+// Indica si la variable j, no básica en un extremo de su tramo, puede pasar al tramo vecino
+bool ResolvedorSimplex::puedeCruzar(int j, double direccion) const
+{
+    const TramosVariable &tramos = tramosVariables[indiceTramos[j]];
+    const vector<double> &puntos = tramos.funcion.puntos;
+    int k = tramos.tramo;
+    if (direccion > 0)
+        return valores[j] >= superior[j] && k + 1 < tramos.funcion.getNumTramos() && puntos[k + 1] < tramos.superior;
+    return valores[j] <= inferior[j] && k > 0 && puntos[k] > tramos.inferior;
+}
+
+// Ubica una variable no básica en su cota finita más cercana (o en 0 si es libre)
+void ResolvedorSimplex::colocarEnCota(int k)
+{
+    if (isfinite(inferior[k]) && isfinite(superior[k]))
+    {
+        valores[k] = abs(valores[k] - inferior[k]) <= abs(valores[k] - superior[k]) ? inferior[k] : superior[k];
+    }
+    else if (isfinite(inferior[k]))
+    {
+        valores[k] = inferior[k];
+    }
+    else if (isfinite(superior[k]))
+    {
+        valores[k] = superior[k];
+    }
+    else
+    {
+        valores[k] = 0.0;
+    }
+}
+
+// La LU dispersa solo compensa en bases medianas o grandes
+bool ResolvedorSimplex::usarInversaDensa() const
+{
+    return !opciones.factorizacionDispersa || m < MIN_FILAS_LU_DISPERSA;
+}
+
+// Base formada solo por las variables lógicas: B = -I
+void ResolvedorSimplex::reiniciarBaseLogica()
+{
+    base.assign(m, 0);
+    posicionBase.assign(n + m, -1);
+    for (int i = 0; i < m; i++)
+    {
+        base[i] = n + i;
+        posicionBase[n + i] = i;
+    }
+    factorizacion.setDensa(usarInversaDensa());
+    factorizacion.setHiperdispersa(opciones.hiperdispersa);
+    factorizacion.factorizar(base, n, matriz);
+    for (int j = 0; j < n; j++)
+    {
+        if (posicionBase[j] < 0)
+        {
+            colocarEnCota(j);
+        }
+    }
+    duales.assign(m, 0.0);
+    actualizacionesDesdeRefactorizacion = 0;
+}
+
+// Factoriza la base actual desde cero
+void ResolvedorSimplex::refactorizar()
+{
+    factorizacion.setDensa(usarInversaDensa());
+    factorizacion.setHiperdispersa(opciones.hiperdispersa);
+    if (!factorizacion.factorizar(base, n, matriz))
+    {
+        // Base singular por errores numéricos: volver a la base lógica
+        reiniciarBaseLogica();
+        return;
+    }
+    actualizacionesDesdeRefactorizacion = 0;
+}
+
+// x_B = -B⁻¹·N·x_N
+void ResolvedorSimplex::calcularValoresBasicos()
+{
+    VectorDisperso &suma = columnaBase;
+    suma.reiniciar(m);
+    for (int k = 0; k < n + m; k++)
+    {
+        if (posicionBase[k] >= 0 || valores[k] == 0.0)
+            continue;
+
+        if (k < n)
+        {
+            const int *filas = matriz.getFilasColumna(k);
+            const double *coeficientes = matriz.getValoresColumna(k);
+            for (int p = 0; p < matriz.getLargoColumna(k); p++)
+            {
+                suma.sumar(filas[p], coeficientes[p] * valores[k]);
+            }
+        }
+        else
+        {
+            suma.sumar(k - n, -valores[k]);
+        }
+    }
+
+    factorizacion.ftran(suma);
+    for (int i = 0; i < m; i++)
+    {
+        valores[base[i]] = -suma.valores[i];
+    }
+}
+
+// y = c_B·B⁻¹
+void ResolvedorSimplex::calcularDuales(const vector<double> &costosBase)
+{
+    VectorDisperso &costos = filaBase;
+    costos.reiniciar(m);
+    for (int i = 0; i < m; i++)
+    {
+        if (costosBase[i] != 0.0)
+            costos.sumar(i, costosBase[i]);
+    }
+    factorizacion.btran(costos);
+    duales.assign(costos.valores.begin(), costos.valores.end());
+}
+
+// Producto de un vector fila (tamaño m) por la columna k de [A  -I]
+double ResolvedorSimplex::productoColumna(const vector<double> &fila, int k) const
+{
+    if (k >= n)
+    {
+        return -fila[k - n];
+    }
+    const int *filas = matriz.getFilasColumna(k);
+    const double *coeficientes = matriz.getValoresColumna(k);
+    double total = 0.0;
+    for (int p = 0; p < matriz.getLargoColumna(k); p++)
+    {
+        total += fila[filas[p]] * coeficientes[p];
+    }
+    return total;
+}
+
+// Fila ρ·[A  -I] en las variables no básicas (0 en las básicas). Si ρ tiene
+// pocos no nulos se recorre A por filas (solo las filas de esos no nulos);
+// si no, columna por columna
+void ResolvedorSimplex::productoFila(const VectorDisperso &rho, double *fila) const
+{
+    int total = n + m;
+    if (opciones.hiperdispersa && rho.indices.size() < DENSIDAD_FILA_DISPERSA * m)
+    {
+        fill(fila, fila + total, 0.0);
+        for (int i : rho.indices)
+        {
+            double r = rho.valores[i];
+            const int *columnasFila = matriz.getColumnasFila(i);
+            const double *coeficientes = matriz.getValoresFila(i);
+            for (int p = 0; p < matriz.getLargoFila(i); p++)
+                fila[columnasFila[p]] += r * coeficientes[p];
+            fila[n + i] = -r;
+        }
+        for (int i = 0; i < m; i++)
+            fila[base[i]] = 0.0;
+        return;
+    }
+    for (int k = 0; k < total; k++)
+    {
+        fila[k] = posicionBase[k] >= 0 ? 0.0 : productoColumna(rho.valores, k);
+    }
+}
+
+// ρ = e_posicion·B⁻¹
+void ResolvedorSimplex::filaInversa(int posicion, VectorDisperso &rho) const
+{
+    rho.reiniciar(m);
+    rho.sumar(posicion, 1.0);
+    factorizacion.btran(rho);
+}
+
+// alfa = B⁻¹·a_k (la factorización guarda lo necesario para que k entre)
+void ResolvedorSimplex::columnaTransformada(int k, VectorDisperso &alfa)
+{
+    alfa.reiniciar(m);
+    if (k >= n)
+    {
+        alfa.sumar(k - n, -1.0);
+    }
+    else
+    {
+        const int *filas = matriz.getFilasColumna(k);
+        const double *coeficientes = matriz.getValoresColumna(k);
+        for (int p = 0; p < matriz.getLargoColumna(k); p++)
+            alfa.sumar(filas[p], coeficientes[p]);
+    }
+    factorizacion.ftran(alfa, true);
+}
+
+// Cambia la variable básica de la posición indicada y actualiza la factorización
+// (si la actualización pierde precisión, se refactoriza al empezar la próxima iteración)
+void ResolvedorSimplex::pivotear(int fila, int entrante, const VectorDisperso &alfa)
+{
+    int saliente = base[fila];
+    posicionBase[saliente] = -1;
+    base[fila] = entrante;
+    posicionBase[entrante] = fila;
+    actualizacionesDesdeRefactorizacion++;
+    if (!factorizacion.actualizar(fila, alfa))
+        actualizacionesDesdeRefactorizacion = MAX_ACTUALIZACIONES;
+}
+
+bool ResolvedorSimplex::esPrimalFactible() const
+{
+    for (int i = 0; i < m; i++)
+    {
+        int k = base[i];
+        if (valores[k] < inferior[k] - TOL_PRIMAL || valores[k] > superior[k] + TOL_PRIMAL)
+            return false;
+    }
+    return true;
+}
+
+bool ResolvedorSimplex::esDualFactible()
+{
+    vector<double> costosBase(m);
+    for (int i = 0; i < m; i++)
+    {
+        costosBase[i] = costo[base[i]];
+    }
+    calcularDuales(costosBase);
+
+    for (int k = 0; k < n + m; k++)
+    {
+        if (posicionBase[k] >= 0 || inferior[k] == superior[k])
+            continue;
+        double d = costo[k] - productoColumna(duales, k);
+        bool puedeSubir = valores[k] < superior[k];
+        bool puedeBajar = valores[k] > inferior[k];
+        if ((puedeSubir && d > TOL_DUAL) || (puedeBajar && d < -TOL_DUAL))
+            return false;
+    }
+    return true;
+}
+
+// Prueba de razón del símplex primal: el paso máximo inicial es el cambio de
+// cota de la entrante (en un costo por tramos, el próximo quiebre)
+double ResolvedorSimplex::pruebaRazon(int entrante, double direccion, const VectorDisperso &alfa, bool fase1,
+                                      bool bland, int &filaSaliente, double &cotaSaliente) const
+{
+    filaSaliente = -1;
+    cotaSaliente = 0.0;
+    double paso = superior[entrante] - inferior[entrante];
+    for (int i : alfa.indices)
+    {
+        if (abs(alfa.valores[i]) < TOL_PIVOTE)
+            continue;
+
+        int k = base[i];
+        double cambio = -direccion * alfa.valores[i]; // Variación de x_B[i] por unidad de paso
+        double limite;
+        double cota;
+
+        if (fase1 && valores[k] < inferior[k] - TOL_PRIMAL)
+        {
+            if (cambio <= 0)
+                continue;
+            cota = inferior[k];
+            limite = (inferior[k] - valores[k]) / cambio;
+        }
+        else if (fase1 && valores[k] > superior[k] + TOL_PRIMAL)
+        {
+            if (cambio >= 0)
+                continue;
+            cota = superior[k];
+            limite = (valores[k] - superior[k]) / -cambio;
+        }
+        else if (cambio < 0 && isfinite(inferior[k]))
+        {
+            cota = inferior[k];
+            limite = max(0.0, valores[k] - inferior[k]) / -cambio;
+        }
+        else if (cambio > 0 && isfinite(superior[k]))
+        {
+            cota = superior[k];
+            limite = max(0.0, superior[k] - valores[k]) / cambio;
+        }
+        else
+        {
+            continue;
+        }
+
+        // Empates: el pivote más grande, o el menor índice con la regla de Bland
+        if (limite < paso - 1e-12 ||
+            (filaSaliente >= 0 && limite <= paso + 1e-12 &&
+             (bland ? k < base[filaSaliente] : abs(alfa.valores[i]) > abs(alfa.valores[filaSaliente]))))
+        {
+            paso = limite;
+            filaSaliente = i;
+            cotaSaliente = cota;
+        }
+    }
+    return paso;
+}
+
+// Avanza la entrante en la dirección indicada y ajusta las variables básicas
+void ResolvedorSimplex::moverEntrante(int entrante, double direccion, double paso, const VectorDisperso &alfa)
+{
+    valores[entrante] += direccion * paso;
+    for (int i : alfa.indices)
+    {
+        valores[base[i]] -= direccion * alfa.valores[i] * paso;
+    }
+}
+
+// Mejora del objetivo por unidad de movimiento de la variable k (0 si no
+// puede entrar); direccion queda en +1 (subir) o -1 (bajar)
+double ResolvedorSimplex::atractivoEntrante(int k, bool fase1, double &direccion) const
+{
+    bool conTramos = k < n && !tramosVariables.empty() && indiceTramos[k] >= 0;
+    if (posicionBase[k] >= 0 || (inferior[k] == superior[k] && !conTramos))
+        return 0.0;
+
+    double ya = productoColumna(duales, k);
+    double dSubir = (fase1 ? 0.0 : costo[k]) - ya;
+    double dBajar = dSubir;
+    bool puedeSubir = valores[k] < superior[k];
+    bool puedeBajar = valores[k] > inferior[k];
+
+    // En un quiebre, el movimiento hacia el tramo vecino se evalúa con su pendiente
+    if (conTramos)
+    {
+        const TramosVariable &tramos = tramosVariables[indiceTramos[k]];
+        if (!puedeSubir && puedeCruzar(k, 1.0))
+        {
+            puedeSubir = true;
+            if (!fase1)
+                dSubir = tramos.costoLineal - tramos.funcion.pendiente(tramos.tramo + 1) - ya;
+        }
+        if (!puedeBajar && puedeCruzar(k, -1.0))
+        {
+            puedeBajar = true;
+            if (!fase1)
+                dBajar = tramos.costoLineal - tramos.funcion.pendiente(tramos.tramo - 1) - ya;
+        }
+    }
+
+    double subir = puedeSubir ? dSubir : 0.0;
+    double bajar = puedeBajar ? -dBajar : 0.0;
+    direccion = subir >= bajar ? 1.0 : -1.0;
+    return max(0.0, max(subir, bajar));
+}
+
+// Precios: con Bland, la primera variable que mejora; si no, el mayor
+// atractivo² / peso, en todas las columnas o por segmentos. Los segmentos solo
+// convienen en modelos anchos: con pocas columnas por fila el costo de cada
+// iteración es el de B⁻¹ y los segmentos solo agregan iteraciones. De cada
+// segmento quedan las mejores candidatas, que se vuelven a evaluar (con los
+// duales nuevos) antes de pasar al siguiente. Devuelve -1 si ninguna mejora.
+int ResolvedorSimplex::elegirEntrante(bool fase1, bool bland, double &direccion)
+{
+    int total = n + m;
+    if (bland)
+    {
+        for (int k = 0; k < total; k++)
+        {
+            if (atractivoEntrante(k, fase1, direccion) > TOL_DUAL)
+                return k;
+        }
+        return -1;
+    }
+
+    double *atractivo = espacio.atractivo.data();
+    double *puntajes = espacio.puntajes.data();
+    const double *pesos = pesosDevex.data();
+    if (!opciones.preciosParciales || total < COLUMNAS_POR_FILA_PARCIAL * m)
+    {
+        for (int k = 0; k < total; k++)
+            atractivo[k] = atractivoEntrante(k, fase1, direccion);
+        int entrante = nucleoPrecios(atractivo, pesos, puntajes, total, opciones.vectorial);
+        if (entrante >= 0)
+            atractivoEntrante(entrante, fase1, direccion);
+        return entrante;
+    }
+
+    // Candidatas que quedaron de la búsqueda anterior
+    int entrante = -1;
+    double mayor = 0.0;
+    size_t quedan = 0;
+    for (int k : candidatas)
+    {
+        double a = atractivoEntrante(k, fase1, direccion);
+        if (a <= TOL_DUAL)
+            continue;
+        candidatas[quedan++] = k;
+        if (a * a / pesos[k] > mayor)
+        {
+            mayor = a * a / pesos[k];
+            entrante = k;
+        }
+    }
+    candidatas.resize(quedan);
+    if (entrante >= 0)
+    {
+        candidatas.erase(find(candidatas.begin(), candidatas.end(), entrante));
+        atractivoEntrante(entrante, fase1, direccion);
+        return entrante;
+    }
+
+    // Segmentos desde donde terminó la búsqueda anterior, hasta dar la vuelta
+    int tamanoSegmento = max(64, total / 8);
+    for (int revisadas = 0; revisadas < total;)
+    {
+        int inicio = inicioSegmento < total ? inicioSegmento : 0;
+        int cantidad = min(tamanoSegmento, total - inicio);
+        for (int k = inicio; k < inicio + cantidad; k++)
+            atractivo[k] = atractivoEntrante(k, fase1, direccion);
+        int mejor = nucleoPrecios(atractivo + inicio, pesos + inicio, puntajes + inicio, cantidad, opciones.vectorial);
+        inicioSegmento = inicio + cantidad;
+        revisadas += cantidad;
+        if (mejor < 0)
+            continue;
+
+        entrante = inicio + mejor;
+        for (int k = inicio; k < inicio + cantidad; k++)
+        {
+            if (puntajes[k] > 0.0 && k != entrante)
+                candidatas.push_back(k);
+        }
+        if (candidatas.size() > static_cast<size_t>(MAX_CANDIDATAS))
+        {
+            nth_element(candidatas.begin(), candidatas.begin() + MAX_CANDIDATAS, candidatas.end(),
+                        [&](int a, int b)
+                        { return puntajes[a] > puntajes[b]; });
+            candidatas.resize(MAX_CANDIDATAS);
+        }
+        atractivoEntrante(entrante, fase1, direccion);
+        return entrante;
+    }
+    return -1;
+}
+
+// Devex: con la fila pivote α_r (antes de pivotear), w_j = max(w_j, (α_rj/α_rq)²·w_q)
+// y la saliente queda con max(w_q/α_rq², 1)
+void ResolvedorSimplex::actualizarPesosDevex(int fila, int entrante, double pivote)
+{
+    filaInversa(fila, filaBase);
+    double *filaPivote = espacio.fila.data();
+    productoFila(filaBase, filaPivote);
+
+    double factor = pesosDevex[entrante] / (pivote * pivote);
+    double mayor = nucleoPesosDevex(pesosDevex.data(), filaPivote, factor, n + m, opciones.vectorial);
+    pesosDevex[base[fila]] = max(factor, 1.0);
+    if (mayor > MAX_PESO_DEVEX || factor > MAX_PESO_DEVEX)
+        pesosDevex.assign(n + m, 1.0);
+}
+
+// Prueba de razón del símplex dual para la fila que sale por debajo (o por
+// encima) de su cota. Con saltos de cota, las razones se recorren de menor a
+// mayor: mientras la saliente siga violando su cota después de pasar una
+// variable acotada de una cota a la otra, esa variable salta (queda en saltos)
+// y se sigue con la próxima; entra la primera que no alcanza a saltar. Las
+// razones solo se ordenan si la de menor razón llega a saltar.
+// Devuelve -1 si ninguna variable puede entrar.
+int ResolvedorSimplex::pruebaRazonDual(int fila, bool debajo, vector<int> &saltos)
+{
+    saltos.clear();
+    int total = n + m;
+    filaInversa(fila, filaBase);
+    double *filaPivote = espacio.fila.data();
+    productoFila(filaBase, filaPivote);
+    double *reducidos = espacio.reducidos.data();
+    double *sube = espacio.sube.data();
+    double *baja = espacio.baja.data();
+    double *razones = espacio.razones.data();
+
+    // x_saliente varía en -α_rk por unidad de aumento de x_k: con el signo de
+    // la fila ajustado, subir sirve donde la fila es positiva
+    for (int k = 0; k < total; k++)
+    {
+        if (posicionBase[k] >= 0 || inferior[k] == superior[k])
+        {
+            filaPivote[k] = 0.0;
+            reducidos[k] = 0.0;
+            sube[k] = 0.0;
+            baja[k] = 0.0;
+            continue;
+        }
+        if (debajo)
+            filaPivote[k] = -filaPivote[k];
+        // El costo reducido solo hace falta donde la fila puede pivotear
+        reducidos[k] = abs(filaPivote[k]) >= TOL_PIVOTE ? abs(costo[k] - productoColumna(duales, k)) : 0.0;
+        sube[k] = valores[k] < superior[k] ? 1.0 : 0.0;
+        baja[k] = valores[k] > inferior[k] ? 1.0 : 0.0;
+    }
+    double menor = nucleoRazonesDuales(filaPivote, reducidos, sube, baja, razones, total, opciones.vectorial);
+    if (!isfinite(menor))
+        return -1;
+
+    // La menor razón y, entre empates, el pivote más grande
+    int elegida = -1;
+    for (int k = 0; k < total; k++)
+    {
+        if (razones[k] <= menor + 1e-12 && (elegida < 0 || abs(filaPivote[k]) > abs(filaPivote[elegida])))
+            elegida = k;
+    }
+    if (!opciones.saltosDeCota)
+        return elegida;
+
+    // Con saltos: si la primera no alcanza a saltar entra ella, sin ordenar
+    // nada (detenerse en la menor razón siempre conserva la factibilidad dual)
+    int saliente = base[fila];
+    double violacion = debajo ? inferior[saliente] - valores[saliente] : valores[saliente] - superior[saliente];
+    double rangoElegida = superior[elegida] - inferior[elegida];
+    bool elegidaEnCota = valores[elegida] == inferior[elegida] || valores[elegida] == superior[elegida];
+    if (!isfinite(rangoElegida) || !elegidaEnCota || violacion - abs(filaPivote[elegida]) * rangoElegida <= TOL_PRIMAL)
+        return elegida;
+
+    // Si no, las razones salen de un montículo de menor a mayor, así solo se
+    // ordenan las que se recorren
+    vector<pair<double, int>> &monticulo = espacio.monticulo;
+    monticulo.clear();
+    for (int k = 0; k < total; k++)
+    {
+        if (isfinite(razones[k]))
+            monticulo.push_back(make_pair(-razones[k], -k));
+    }
+    make_heap(monticulo.begin(), monticulo.end());
+    while (!monticulo.empty())
+    {
+        pop_heap(monticulo.begin(), monticulo.end());
+        int k = -monticulo.back().second;
+        monticulo.pop_back();
+
+        double rango = superior[k] - inferior[k];
+        bool enCota = valores[k] == inferior[k] || valores[k] == superior[k];
+        double reduccion = abs(filaPivote[k]) * rango;
+        if (isfinite(rango) && enCota && violacion - reduccion > TOL_PRIMAL)
+        {
+            violacion -= reduccion;
+            saltos.push_back(k);
+            continue;
+        }
+
+        // Entra esta variable o, si empata en razón, la de pivote más grande
+        elegida = k;
+        while (!monticulo.empty() && -monticulo.front().first <= razones[k] + 1e-12)
+        {
+            pop_heap(monticulo.begin(), monticulo.end());
+            int empate = -monticulo.back().second;
+            monticulo.pop_back();
+            if (abs(filaPivote[empate]) > abs(filaPivote[elegida]))
+                elegida = empate;
+        }
+        return elegida;
+    }
+    saltos.clear();
+    return -1;
+}
+
+/**
+ * Símplex primal. En la fase 1 el objetivo es reducir la suma de violaciones
+ * de cotas de las variables básicas; en la fase 2 se maximiza c·x.
+ */
+EstadoLP ResolvedorSimplex::simplexPrimal(bool fase1, const TokenCancelacion *token)
+{
+    vector<double> costosBase(m);
+    VectorDisperso alfa;
+    int pasosDegenerados = 0;
+
+    while (true)
+    {
+        if (iteraciones >= limiteIteraciones)
+            return LP_LIMITE_ITERACIONES;
+        if (token && (iteraciones % 32) == 0)
+            token->verificar();
+
+        if (actualizacionesDesdeRefactorizacion >= MAX_ACTUALIZACIONES)
+        {
+            refactorizar();
+            calcularValoresBasicos();
+
+            // Si la base resultó singular se volvió a la base lógica: recuperar la factibilidad
+            if (!fase1 && !esPrimalFactible())
+            {
+                EstadoLP estadoFase1 = simplexPrimal(true, token);
+                if (estadoFase1 != LP_OPTIMO)
+                    return estadoFase1 == LP_LIMITE_ITERACIONES ? estadoFase1 : LP_INFACTIBLE;
+            }
+        }
+
+        // Costos de las variables básicas
+        bool hayInfactibilidad = false;
+        for (int i = 0; i < m; i++)
+        {
+            int k = base[i];
+            if (fase1)
+            {
+                if (valores[k] < inferior[k] - TOL_PRIMAL)
+                    costosBase[i] = 1.0;
+                else if (valores[k] > superior[k] + TOL_PRIMAL)
+                    costosBase[i] = -1.0;
+                else
+                    costosBase[i] = 0.0;
+                hayInfactibilidad = hayInfactibilidad || costosBase[i] != 0.0;
+            }
+            else
+            {
+                costosBase[i] = costo[k];
+            }
+        }
+
+        if (fase1 && !hayInfactibilidad)
+            return LP_OPTIMO;
+
+        calcularDuales(costosBase);
+
+        // Selección de la variable entrante (Bland si hay muchos pasos degenerados)
+        bool usarBland = pasosDegenerados > 50;
+        double direccion = 0.0;
+        int entrante = elegirEntrante(fase1, usarBland, direccion);
+
+        if (entrante < 0)
+            return fase1 ? LP_INFACTIBLE : LP_OPTIMO;
+
+        bool entranteConTramos = entrante < n && !tramosVariables.empty() && indiceTramos[entrante] >= 0;
+        if (entranteConTramos && puedeCruzar(entrante, direccion))
+        {
+            const TramosVariable &tramos = tramosVariables[indiceTramos[entrante]];
+            fijarTramo(entrante, tramos.tramo + (direccion > 0 ? 1 : -1));
+        }
+
+        columnaTransformada(entrante, alfa);
+
+        int filaSaliente = -1;
+        double cotaSaliente = 0.0;
+        double paso = pruebaRazon(entrante, direccion, alfa, fase1, usarBland, filaSaliente, cotaSaliente);
+        if (!isfinite(paso))
+            return fase1 ? LP_INFACTIBLE : LP_NO_ACOTADO;
+
+        pasosDegenerados = paso < 1e-12 ? pasosDegenerados + 1 : 0;
+        iteraciones++;
+        moverEntrante(entrante, direccion, paso, alfa);
+
+        if (filaSaliente < 0)
+        {
+            // Solo cambia de cota la variable entrante
+            valores[entrante] = direccion > 0 ? superior[entrante] : inferior[entrante];
+
+            // Paso largo: si la entrante llegó a un quiebre y el tramo siguiente sigue
+            // mejorando, se cruza de inmediato con la misma base y los mismos duales
+            while (entranteConTramos && puedeCruzar(entrante, direccion))
+            {
+                const TramosVariable &tramos = tramosVariables[indiceTramos[entrante]];
+                int siguiente = tramos.tramo + (direccion > 0 ? 1 : -1);
+                double d = (fase1 ? 0.0 : tramos.costoLineal - tramos.funcion.pendiente(siguiente)) -
+                           productoColumna(duales, entrante);
+                if (direccion * d <= TOL_DUAL)
+                    break;
+
+                fijarTramo(entrante, siguiente);
+                paso = pruebaRazon(entrante, direccion, alfa, fase1, usarBland, filaSaliente, cotaSaliente);
+                if (!isfinite(paso))
+                    return fase1 ? LP_INFACTIBLE : LP_NO_ACOTADO;
+                moverEntrante(entrante, direccion, paso, alfa);
+                if (filaSaliente >= 0)
+                    break;
+                valores[entrante] = direccion > 0 ? superior[entrante] : inferior[entrante];
+            }
+            if (filaSaliente < 0)
+                continue;
+        }
+
+        int saliente = base[filaSaliente];
+        if (opciones.devex)
+            actualizarPesosDevex(filaSaliente, entrante, alfa.valores[filaSaliente]);
+        pivotear(filaSaliente, entrante, alfa);
+        valores[saliente] = cotaSaliente;
+    }
+}
+
+/**
+ * Símplex dual: parte de una base dual factible (costos reducidos con el signo
+ * correcto) y elimina las violaciones de cotas de las variables básicas. Con
+ * Devex, la fila saliente es la de mayor violación² / peso, con pesos de
+ * referencia por posición de la base desde el comienzo de esta resolución.
+ */
+EstadoLP ResolvedorSimplex::simplexDual(const TokenCancelacion *token)
+{
+    vector<double> costosBase(m);
+    VectorDisperso alfa;
+    vector<int> saltos;
+    vector<double> pesosFila(m, 1.0);
+
+    while (true)
+    {
+        if (iteraciones >= limiteIteraciones)
+            return LP_LIMITE_ITERACIONES;
+        if (token && (iteraciones % 32) == 0)
+            token->verificar();
+
+        if (actualizacionesDesdeRefactorizacion >= MAX_ACTUALIZACIONES)
+        {
+            refactorizar();
+            calcularValoresBasicos();
+        }
+
+        // Fila saliente: la de mayor violación de cotas (relativa al peso con Devex)
+        int fila = -1;
+        double mayorAtractivo = 0.0;
+        for (int i = 0; i < m; i++)
+        {
+            int k = base[i];
+            double violacion = max(inferior[k] - valores[k], valores[k] - superior[k]);
+            if (violacion <= TOL_PRIMAL)
+                continue;
+            double atractivo = opciones.devex ? violacion * violacion / pesosFila[i] : violacion;
+            if (atractivo > mayorAtractivo)
+            {
+                mayorAtractivo = atractivo;
+                fila = i;
+            }
+        }
+
+        if (fila < 0)
+            return LP_OPTIMO;
+
+        int saliente = base[fila];
+        bool debajo = valores[saliente] < inferior[saliente];
+        double cotaObjetivo = debajo ? inferior[saliente] : superior[saliente];
+
+        for (int i = 0; i < m; i++)
+        {
+            costosBase[i] = costo[base[i]];
+        }
+        calcularDuales(costosBase);
+
+        int entrante = pruebaRazonDual(fila, debajo, saltos);
+        if (entrante < 0)
+            return LP_INFACTIBLE;
+
+        // Las variables cruzadas en la prueba de razón pasan a su otra cota; las
+        // básicas se corrigen con una sola FTRAN de Σ a_k·Δ_k (x_B = -B⁻¹·Σ a_k·x_k)
+        if (!saltos.empty())
+        {
+            VectorDisperso &cambio = columnaBase;
+            cambio.reiniciar(m);
+            for (int k : saltos)
+            {
+                double nuevo = valores[k] == inferior[k] ? superior[k] : inferior[k];
+                double delta = nuevo - valores[k];
+                valores[k] = nuevo;
+                if (k < n)
+                {
+                    const int *filas = matriz.getFilasColumna(k);
+                    const double *coeficientes = matriz.getValoresColumna(k);
+                    for (int p = 0; p < matriz.getLargoColumna(k); p++)
+                        cambio.sumar(filas[p], coeficientes[p] * delta);
+                }
+                else
+                {
+                    cambio.sumar(k - n, -delta);
+                }
+            }
+            factorizacion.ftran(cambio);
+            for (int i = 0; i < m; i++)
+            {
+                valores[base[i]] -= cambio.valores[i];
+            }
+            if (max(inferior[saliente] - valores[saliente], valores[saliente] - superior[saliente]) <= TOL_PRIMAL)
+            {
+                iteraciones++;
+                continue;
+            }
+        }
+
+        columnaTransformada(entrante, alfa);
+        double delta = (valores[saliente] - cotaObjetivo) / alfa.valores[fila];
+        iteraciones++;
+
+        valores[entrante] += delta;
+        for (int i : alfa.indices)
+        {
+            valores[base[i]] -= alfa.valores[i] * delta;
+        }
+
+        // Devex dual: la fila de B⁻¹ en la posición i cambia en -(α_i/α_r)·fila r
+        if (opciones.devex)
+        {
+            double pivote = alfa.valores[fila];
+            double pesoSaliente = pesosFila[fila];
+            double mayor = 0.0;
+            for (int i : alfa.indices)
+            {
+                double cociente = alfa.valores[i] / pivote;
+                pesosFila[i] = max(pesosFila[i], cociente * cociente * pesoSaliente);
+                mayor = max(mayor, pesosFila[i]);
+            }
+            pesosFila[fila] = max(pesoSaliente / (pivote * pivote), 1.0);
+            if (mayor > MAX_PESO_DEVEX)
+                pesosFila.assign(m, 1.0);
+        }
+
+        pivotear(fila, entrante, alfa);
+        valores[saliente] = cotaObjetivo;
+    }
+}
+
+EstadoLP ResolvedorSimplex::resolver(const TokenCancelacion *token)
+{
+    TRAZA_AMBITO("simplex.resolver", "calculo");
+
+    iteraciones = 0;
+    pesosDevex.assign(n + m, 1.0);
+    candidatas.clear();
+    for (auto *trabajo : {&espacio.atractivo, &espacio.puntajes, &espacio.fila, &espacio.reducidos, &espacio.sube,
+                         &espacio.baja, &espacio.razones})
+        trabajo->resize(n + m);
+    if (actualizacionesDesdeRefactorizacion > 0 || factorizacion.esDensa() != usarInversaDensa())
+    {
+        refactorizar();
+    }
+    calcularValoresBasicos();
+
+    ubicarTramosBasicos();
+
+    if (!esPrimalFactible())
+    {
+        if (esDualFactible())
+        {
+            estado = simplexDual(token);
+            if (estado == LP_LIMITE_ITERACIONES)
+                return estado;
+            if (estado == LP_INFACTIBLE)
+            {
+                // Confirmar con la fase 1 (el dual puede fallar por tolerancias o
+                // por una variable básica que salió de su tramo)
+                ubicarTramosBasicos();
+                estado = simplexPrimal(true, token);
+                if (estado != LP_OPTIMO)
+                {
+                    estado = estado == LP_LIMITE_ITERACIONES ? estado : LP_INFACTIBLE;
+                    return estado;
+                }
+            }
+        }
+        else
+        {
+            estado = simplexPrimal(true, token);
+            if (estado != LP_OPTIMO)
+            {
+                estado = estado == LP_LIMITE_ITERACIONES ? estado : LP_INFACTIBLE;
+                return estado;
+            }
+        }
+    }
+
+    estado = simplexPrimal(false, token);
+    return estado;
+}
+
+void ResolvedorSimplex::cambiarObjetivo(int j, double nuevoCosto)
+{
+    costo.at(j) = nuevoCosto;
+    if (j < n && indiceTramos[j] >= 0)
+    {
+        TramosVariable &tramos = tramosVariables[indiceTramos[j]];
+        tramos.costoLineal = nuevoCosto;
+        fijarTramo(j, tramos.tramo);
+    }
+}
+
+void ResolvedorSimplex::cambiarCotasVariable(int j, double nuevaInferior, double nuevaSuperior)
+{
+    if (nuevaInferior > nuevaSuperior)
+    {
+        throw invalid_argument("La cota inferior de la variable supera a la superior.");
+    }
+
+    if (j < n && indiceTramos.at(j) >= 0)
+    {
+        // Las cotas nuevas se cortan con el dominio de la función y se busca el tramo del valor
+        TramosVariable &tramos = tramosVariables[indiceTramos[j]];
+        double inferiorTramos = max(nuevaInferior, tramos.funcion.puntos.front());
+        double superiorTramos = min(nuevaSuperior, tramos.funcion.puntos.back());
+        if (inferiorTramos > superiorTramos)
+        {
+            throw invalid_argument("Las cotas de la variable quedan fuera del dominio de su costo por tramos.");
+        }
+        tramos.inferior = inferiorTramos;
+        tramos.superior = superiorTramos;
+        ubicarTramo(j);
+        if (posicionBase[j] < 0 && valores[j] != inferior[j] && valores[j] != superior[j])
+            colocarEnCota(j);
+        return;
+    }
+
+    bool enSuperior = posicionBase.at(j) < 0 && valores[j] == superior[j] && valores[j] != inferior[j];
+    inferior[j] = nuevaInferior;
+    superior[j] = nuevaSuperior;
+
+    if (posicionBase[j] < 0)
+    {
+        if (enSuperior && isfinite(nuevaSuperior))
+            valores[j] = nuevaSuperior;
+        else if (isfinite(nuevaInferior))
+            valores[j] = nuevaInferior;
+        else
+            colocarEnCota(j);
+    }
+}
+
+void ResolvedorSimplex::cambiarCotasFila(int i, double nuevaInferior, double nuevaSuperior)
+{
+    cambiarCotasVariable(n + i, nuevaInferior, nuevaSuperior);
+}
+
+int ResolvedorSimplex::agregarVariable(double nuevoCosto, double nuevaInferior, double nuevaSuperior,
+                                       const vector<pair<int, double>> &columna)
+{
+    if (nuevaInferior > nuevaSuperior)
+    {
+        throw invalid_argument("La cota inferior de la variable supera a la superior.");
+    }
+
+    // La nueva variable estructural ocupa el índice n; las lógicas se desplazan una posición
+    vector<pair<int, double>> columnaLimpia;
+    for (const auto &coeficiente : columna)
+    {
+        if (coeficiente.first < 0 || coeficiente.first >= m)
+            throw out_of_range("La columna hace referencia a una fila inexistente.");
+        if (coeficiente.second != 0.0)
+            columnaLimpia.push_back(coeficiente);
+    }
+
+    matriz.agregarColumna(columnaLimpia);
+    costo.insert(costo.begin() + n, nuevoCosto);
+    inferior.insert(inferior.begin() + n, nuevaInferior);
+    superior.insert(superior.begin() + n, nuevaSuperior);
+    valores.insert(valores.begin() + n, 0.0);
+    posicionBase.insert(posicionBase.begin() + n, -1);
+    indiceTramos.push_back(-1);
+    for (int i = 0; i < m; i++)
+    {
+        if (base[i] >= n)
+            base[i]++;
+    }
+    n++;
+
+    colocarEnCota(n - 1);
+    return n - 1;
+}
+
+int ResolvedorSimplex::agregarFila(const vector<pair<int, double>> &coeficientes, double nuevaInferior, double nuevaSuperior)
+{
+    if (nuevaInferior > nuevaSuperior)
+    {
+        throw invalid_argument("La cota inferior de la fila supera a la superior.");
+    }
+
+    if (actualizacionesDesdeRefactorizacion > 0)
+    {
+        refactorizar();
+    }
+
+    int nuevaFila = m;
+    for (const auto &coeficiente : coeficientes)
+    {
+        if (coeficiente.first < 0 || coeficiente.first >= n)
+            throw out_of_range("La fila hace referencia a una variable inexistente.");
+    }
+    matriz.agregarFila(coeficientes);
+
+    // Nueva variable lógica básica en la nueva posición: B' = [B 0; a_B -1]
+    vector<pair<int, double>> filaEnBase;
+    for (const auto &coeficiente : coeficientes)
+    {
+        int posicion = posicionBase[coeficiente.first];
+        if (posicion >= 0 && coeficiente.second != 0.0)
+            filaEnBase.push_back(make_pair(posicion, coeficiente.second));
+    }
+    factorizacion.agregarFila(filaEnBase);
+
+    costo.push_back(0.0);
+    inferior.push_back(nuevaInferior);
+    superior.push_back(nuevaSuperior);
+    double actividad = 0.0;
+    for (const auto &coeficiente : coeficientes)
+    {
+        actividad += coeficiente.second * valores[coeficiente.first];
+    }
+    valores.push_back(actividad);
+    posicionBase.push_back(m);
+    base.push_back(n + m);
+    duales.push_back(0.0);
+    m++;
+
+    return nuevaFila;
+}
+
+// Quita filas cuya variable lógica es básica: la base restante sigue siendo
+// una base (la columna -e_i era la única con elemento en la fila i) y conserva
+// la solución, ya que el dual de esas filas es cero
+void ResolvedorSimplex::quitarFilas(const vector<int> &filasQuitadas)
+{
+    vector<bool> quitar(m, false);
+    for (int i : filasQuitadas)
+    {
+        if (i < 0 || i >= m)
+            throw out_of_range("La fila a quitar no existe.");
+        if (posicionBase[n + i] < 0)
+            throw invalid_argument("Solo se quitan filas con la variable lógica básica.");
+        quitar[i] = true;
+    }
+
+    vector<int> nuevoIndice(m, -1);
+    int restantes = 0;
+    for (int i = 0; i < m; i++)
+    {
+        if (!quitar[i])
+            nuevoIndice[i] = restantes++;
+    }
+    if (restantes == m)
+        return;
+
+    matriz.quitarFilas(nuevoIndice, restantes);
+
+    vector<int> nuevaBase;
+    for (int variable : base)
+    {
+        if (variable < n)
+            nuevaBase.push_back(variable);
+        else if (!quitar[variable - n])
+            nuevaBase.push_back(n + nuevoIndice[variable - n]);
+    }
+    for (int i = m - 1; i >= 0; i--)
+    {
+        if (!quitar[i])
+            continue;
+        costo.erase(costo.begin() + n + i);
+        inferior.erase(inferior.begin() + n + i);
+        superior.erase(superior.begin() + n + i);
+        valores.erase(valores.begin() + n + i);
+    }
+
+    m = restantes;
+    base.swap(nuevaBase);
+    posicionBase.assign(n + m, -1);
+    for (int i = 0; i < m; i++)
+    {
+        posicionBase[base[i]] = i;
+    }
+    duales.assign(m, 0.0);
+    refactorizar();
+}
+
+// Fila de la posición indicada en B⁻¹·[A  -I]: x_B[posicion] + Σ fila_k·x_k = 0
+// sobre las no básicas
+void ResolvedorSimplex::filaTransformada(int posicion, vector<double> &fila) const
+{
+    VectorDisperso rho;
+    filaInversa(posicion, rho);
+    fila.assign(n + m, 0.0);
+    productoFila(rho, fila.data());
+    fila[base[posicion]] = 1.0;
+}
+
+double ResolvedorSimplex::getValorObjetivo() const
+{
+    double total = 0.0;
+    for (int j = 0; j < n; j++)
+    {
+        total += costo[j] * valores[j];
+    }
+
+    // En el tramo k, f(x) = f(x_k) + pendiente·(x - x_k): falta la parte constante
+    for (const auto &tramos : tramosVariables)
+    {
+        const FuncionPorTramos &funcion = tramos.funcion;
+        total -= funcion.valores[tramos.tramo] - funcion.pendiente(tramos.tramo) * funcion.puntos[tramos.tramo];
+    }
+    return total;
+}
+
+vector<double> ResolvedorSimplex::getValores() const
+{
+    return vector<double>(valores.begin(), valores.begin() + n);
+}
+
+double ResolvedorSimplex::getCostoReducido(int j) const
+{
+    return costo[j] - productoColumna(duales, j);
+}
+
+// ===== BENCHMARK =====
+
+// Planta grande: productos acotados, recursos compartidos (≤) y pedidos mínimos (≥)
+static ModeloLineal construirPlantaGrande(int productos, int recursos, unsigned semilla)
+{
+    mt19937 generador(semilla);
+    uniform_real_distribution<double> uniforme(0.0, 1.0);
+    ModeloLineal modelo;
+    for (int j = 0; j < productos; j++)
+    {
+        modelo.agregarVariable(round(5 + 45 * uniforme(generador)), 0.0, round(1 + 19 * uniforme(generador)));
+    }
+    for (int i = 0; i < recursos; i++)
+    {
+        vector<pair<int, double>> fila;
+        for (int j = 0; j < productos; j++)
+        {
+            if (uniforme(generador) < 0.05)
+                fila.push_back(make_pair(j, round(1 + 9 * uniforme(generador))));
+        }
+        if (fila.empty())
+            continue;
+        if (i % 10 == 9)
+            modelo.agregarFila(fila, ">=", round(5 + 20 * uniforme(generador)));
+        else
+            modelo.agregarFila(fila, "<=", round(100 + 400 * uniforme(generador)));
+    }
+    return modelo;
+}
+
+/**
+ * Compara los núcleos densos SSE2 con su versión escalar y las reglas del
+ * símplex (precios Dantzig o Devex, completos o por segmentos; prueba de razón
+ * dual clásica o con saltos de cota) en una planta grande
+ */
+void ejecutarBenchmarkSimplex()
+{
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: PRECIOS Y PRUEBA DE RAZÓN DEL SÍMPLEX" << endl;
+    cout << string(60, '=') << endl;
+
+    // Núcleos sobre vectores de 4096 variables
+    const int cantidad = 4096;
+    const int repeticiones = 20000;
+    mt19937 generador(7);
+    uniform_real_distribution<double> uniforme(-1.0, 1.0);
+    vector<double> atractivo(cantidad), pesos(cantidad), fila(cantidad), reducidos(cantidad), sube(cantidad),
+        baja(cantidad), salida(cantidad);
+    for (int k = 0; k < cantidad; k++)
+    {
+        atractivo[k] = max(0.0, uniforme(generador));
+        pesos[k] = 1.0 + 3.0 * abs(uniforme(generador));
+        fila[k] = uniforme(generador);
+        reducidos[k] = abs(uniforme(generador));
+        sube[k] = uniforme(generador) > -0.5 ? 1.0 : 0.0;
+        baja[k] = uniforme(generador) > -0.5 ? 1.0 : 0.0;
+    }
+
+    cout << "Núcleos (" << cantidad << " variables, " << repeticiones << " repeticiones):" << endl;
+    auto medirNucleo = [&](const string &nombre, const function<double(bool)> &nucleo)
+    {
+        double resultados[2];
+        double segundos[2];
+        for (int vectorial = 0; vectorial < 2; vectorial++)
+        {
+            auto inicio = chrono::steady_clock::now();
+            double total = 0.0;
+            for (int r = 0; r < repeticiones; r++)
+                total += nucleo(vectorial == 1);
+            segundos[vectorial] = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+            resultados[vectorial] = total;
+        }
+        cout << "  • " << nombre << ": escalar " << segundos[0] * 1000 << " ms, SSE2 " << segundos[1] * 1000
+             << " ms (" << segundos[0] / segundos[1] << "x)" << endl;
+        if (resultados[0] != resultados[1])
+            mostrarMensajeError("La versión SSE2 no da el mismo resultado que la escalar.");
+    };
+    medirNucleo("Precios (atractivo² / peso y el mayor)", [&](bool vectorial)
+                { return static_cast<double>(nucleoPrecios(atractivo.data(), pesos.data(), salida.data(), cantidad, vectorial)); });
+    medirNucleo("Razones duales (y la menor)", [&](bool vectorial)
+                { return nucleoRazonesDuales(fila.data(), reducidos.data(), sube.data(), baja.data(), salida.data(),
+                                             cantidad, vectorial); });
+    medirNucleo("Pesos Devex", [&](bool vectorial)
+                {
+                    salida = pesos;
+                    return nucleoPesosDevex(salida.data(), fila.data(), 0.5, cantidad, vectorial); });
+#ifndef NUCLEOS_SSE2
+    cout << "  (sin SSE2 en esta compilación: las dos versiones son escalares)" << endl;
+#endif
+
+    // Reglas del símplex en una planta cuadrada y en una ancha (muchas más
+    // columnas que filas, donde los precios por segmentos entran en juego)
+    struct Configuracion
+    {
+        string nombre;
+        OpcionesSimplex opciones;
+    };
+    vector<Configuracion> configuraciones(4);
+    configuraciones[0].nombre = "Dantzig, todas las columnas, escalar";
+    configuraciones[0].opciones.devex = false;
+    configuraciones[0].opciones.preciosParciales = false;
+    configuraciones[0].opciones.saltosDeCota = false;
+    configuraciones[0].opciones.vectorial = false;
+    configuraciones[1].nombre = "Devex, todas las columnas";
+    configuraciones[1].opciones.preciosParciales = false;
+    configuraciones[2].nombre = "Devex con segmentos si conviene";
+    configuraciones[3].nombre = configuraciones[2].nombre + ", escalar";
+    configuraciones[3].opciones.vectorial = false;
+
+    for (auto dimensiones : {make_pair(600, 200), make_pair(3000, 100)})
+    {
+        ModeloLineal planta = construirPlantaGrande(dimensiones.first, dimensiones.second, 3);
+        cout << "\nPlanta de " << planta.getNumVariables() << " productos y " << planta.getNumFilas()
+             << " recursos (resolución en frío):" << endl;
+        double referencia = 0.0;
+        for (size_t c = 0; c < configuraciones.size(); c++)
+        {
+            ResolvedorSimplex lp;
+            lp.setOpciones(configuraciones[c].opciones);
+            lp.cargar(planta);
+            auto inicio = chrono::steady_clock::now();
+            EstadoLP estado = lp.resolver();
+            double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+            cout << "  • " << configuraciones[c].nombre << ": " << lp.getIteraciones() << " iteraciones, "
+                 << segundos * 1000 << " ms" << endl;
+            if (c == 0)
+                referencia = lp.getValorObjetivo();
+            if (estado != LP_OPTIMO || abs(lp.getValorObjetivo() - referencia) > 1e-6 * (1.0 + abs(referencia)))
+                mostrarMensajeError("La configuración no llega al mismo óptimo.");
+        }
+    }
+
+    // Símplex dual: cada producto elegido se limita a la mitad de su cota, se
+    // re-optimiza y se libera, como en una bajada de ramificación y acotamiento.
+    // Con productos 0-1 se recorta a la mitad un recurso: la fila saliente cruza
+    // muchas cotas estrechas y ahí los saltos ahorran la mayoría de los pivoteos
+    for (bool ceroUno : {false, true})
+    {
+        ModeloLineal planta = construirPlantaGrande(600, 200, 3);
+        if (ceroUno)
+        {
+            fill(planta.cotaSuperior.begin(), planta.cotaSuperior.end(), 1.0);
+            cout << "\nRe-optimización con el dual, productos 0-1 (200 recursos recortados a la mitad):" << endl;
+        }
+        else
+            cout << "\nRe-optimización con el dual en la planta cuadrada (200 cambios de cota):" << endl;
+        for (bool saltos : {false, true})
+        {
+            OpcionesSimplex opciones;
+            opciones.saltosDeCota = saltos;
+            ResolvedorSimplex lp;
+            lp.setOpciones(opciones);
+            lp.cargar(planta);
+            lp.resolver();
+            mt19937 elecciones(11);
+            long iteraciones = 0;
+            double suma = 0.0;
+            auto inicio = chrono::steady_clock::now();
+            for (int cambio = 0; cambio < 200; cambio++)
+            {
+                if (ceroUno)
+                {
+                    int i = static_cast<int>(elecciones() % planta.getNumFilas());
+                    lp.cambiarCotasFila(i, planta.filaInferior[i], planta.filaSuperior[i] / 2);
+                    lp.resolver();
+                    iteraciones += lp.getIteraciones();
+                    suma += lp.getValorObjetivo();
+                    lp.cambiarCotasFila(i, planta.filaInferior[i], planta.filaSuperior[i]);
+                }
+                else
+                {
+                    int j = static_cast<int>(elecciones() % planta.getNumVariables());
+                    lp.cambiarCotasVariable(j, 0.0, floor(planta.cotaSuperior[j] / 2));
+                    lp.resolver();
+                    iteraciones += lp.getIteraciones();
+                    suma += lp.getValorObjetivo();
+                    lp.cambiarCotasVariable(j, 0.0, planta.cotaSuperior[j]);
+                }
+                lp.resolver();
+                iteraciones += lp.getIteraciones();
+            }
+            double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+            cout << "  • " << (saltos ? "Con saltos de cota" : "Prueba de razón clásica") << ": " << iteraciones
+                 << " iteraciones, " << segundos * 1000 << " ms (suma de óptimos " << suma << ")" << endl;
+        }
+    }
+}
@@ -0,0 +1,105 @@
+/**
+ * MÓDULO DE CÁLCULOS EN SEGUNDO PLANO
+ * Ejecuta la búsqueda de la solución óptima en un hilo propio para que
+ * el menú siga respondiendo; el cálculo se puede cancelar, tiene un
+ * límite de tiempo y publica su progreso (iteraciones, cota e incumbente)
+ */
+
+#include "optimizacion.h"
+#include <limits>
+
+using namespace std;
+
+void TokenCancelacion::establecerLimite(double segundos)
+{
+    limite = chrono::steady_clock::now() + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(segundos));
+    tieneLimite = true;
+}
+
+bool TokenCancelacion::tiempoAgotado() const
+{
+    return tieneLimite && chrono::steady_clock::now() >= limite;
+}
+
+void TokenCancelacion::verificar() const
+{
+    if (fueCancelado())
+    {
+        throw CalculoInterrumpido("El cálculo fue cancelado.", false);
+    }
+    if (tiempoAgotado())
+    {
+        throw CalculoInterrumpido("Se agotó el límite de tiempo del cálculo.", true);
+    }
+}
+
+// Constructor
+ProgresoCalculo::ProgresoCalculo()
+    : iteraciones(0), cotaSuperior(numeric_limits<double>::infinity()), incumbente(0.0), hayIncumbente(false)
+{
+}
+
+// Constructor: copia el modelo y lanza el hilo de cálculo
+TrabajoCalculo::TrabajoCalculo(const ModeloProduccion &modelo, double limiteSegundos)
+    : modelo(modelo), estado(TRABAJO_EN_CURSO), inicio(chrono::steady_clock::now())
+{
+    if (limiteSegundos > 0)
+    {
+        token.establecerLimite(limiteSegundos);
+    }
+    hilo = thread(&TrabajoCalculo::ejecutar, this);
+}
+
+// Destructor: un trabajo descartado se cancela y se espera a su hilo
+TrabajoCalculo::~TrabajoCalculo()
+{
+    token.cancelar();
+    if (hilo.joinable())
+    {
+        hilo.join();
+    }
+}
+
+void TrabajoCalculo::ejecutar()
+{
+    TRAZA_AMBITO("trabajo.calculo", "calculo");
+
+    EstadoTrabajo estadoFinal;
+    try
+    {
+        ArenaMonotona arena;
+        resultado = resolverPuntosExtremos(modelo.restricciones, modelo.precioMesa, modelo.precioSilla,
+                                           &arena, &token, &progreso);
+        estadoFinal = TRABAJO_COMPLETADO;
+    }
+    catch (const CalculoInterrumpido &e)
+    {
+        estadoFinal = e.fuePorTiempo() ? TRABAJO_TIEMPO_AGOTADO : TRABAJO_CANCELADO;
+    }
+    catch (const exception &e)
+    {
+        mensajeError = e.what();
+        estadoFinal = TRABAJO_FALLIDO;
+    }
+
+    lock_guard<mutex> bloqueo(mtx);
+    estado = estadoFinal;
+    cvTerminado.notify_all();
+}
+
+/**
+ * Espera a que el cálculo termine
+ * @param tiempoMaximo Tiempo máximo de espera
+ * @return true si el cálculo terminó dentro del tiempo indicado
+ */
+bool TrabajoCalculo::esperar(chrono::milliseconds tiempoMaximo)
+{
+    unique_lock<mutex> bloqueo(mtx);
+    return cvTerminado.wait_for(bloqueo, tiempoMaximo, [this]
+                                { return estaTerminado(); });
+}
+
+double TrabajoCalculo::getSegundosTranscurridos() const
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+}
@@ -0,0 +1,165 @@
+/**
+ * MÓDULO DE TRAZAS DE EJECUCIÓN
+ * Registra intervalos de tiempo (menú, entrada de datos, cálculo, dibujo)
+ * y los exporta en formato JSON de Chrome trace-event para verlos en
+ * chrome://tracing o en https://ui.perfetto.dev
+ */
+
+#include "optimizacion.h"
+#include <atomic>
+#include <chrono>
+#include <fstream>
+
+using namespace std;
+
+// Evento completo ("ph":"X") de la traza
+struct EventoTraza
+{
+    const char *nombre;
+    const char *categoria;
+    long long inicioNs;
+    long long duracionNs;
+};
+
+// Eventos de un hilo; cada hilo escribe en el suyo sin competir con los demás
+struct BufferTraza
+{
+    mutex mtx;
+    vector<EventoTraza> eventos;
+    unsigned idHilo;
+};
+
+static atomic<bool> trazaHabilitada(false);
+static string archivoTraza;
+static mutex mtxRegistro;
+static vector<shared_ptr<BufferTraza>> buffersRegistrados;
+static atomic<unsigned> siguienteIdHilo(1);
+static const chrono::steady_clock::time_point inicioTraza = chrono::steady_clock::now();
+
+static long long tiempoActualNs()
+{
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - inicioTraza).count();
+}
+
+// Devuelve el buffer del hilo actual, registrándolo la primera vez
+static BufferTraza &bufferDelHilo()
+{
+    thread_local shared_ptr<BufferTraza> buffer;
+    if (!buffer)
+    {
+        buffer = make_shared<BufferTraza>();
+        buffer->idHilo = siguienteIdHilo++;
+        lock_guard<mutex> bloqueo(mtxRegistro);
+        buffersRegistrados.push_back(buffer);
+    }
+    return *buffer;
+}
+
+// Escribe una cadena JSON escapando comillas, barras y caracteres de control
+static void escribirCadenaJson(ofstream &archivo, const char *texto)
+{
+    archivo << '"';
+    for (const char *c = texto; *c; c++)
+    {
+        if (*c == '"' || *c == '\\')
+        {
+            archivo << '\\' << *c;
+        }
+        else if (static_cast<unsigned char>(*c) < 0x20)
+        {
+            archivo << ' ';
+        }
+        else
+        {
+            archivo << *c;
+        }
+    }
+    archivo << '"';
+}
+
+/**
+ * Activa el registro de trazas
+ * @param archivo Ruta del archivo JSON que se escribirá al llamar a guardarTraza()
+ */
+void activarTraza(const string &archivo)
+{
+    archivoTraza = archivo;
+    trazaHabilitada = true;
+
+    // Registrar primero el hilo que activa la traza (el principal)
+    bufferDelHilo();
+}
+
+bool trazaActiva()
+{
+    return trazaHabilitada.load(memory_order_relaxed);
+}
+
+/**
+ * Escribe todos los intervalos registrados en el archivo de traza.
+ * Los tiempos se expresan en microsegundos, como exige el formato.
+ */
+void guardarTraza()
+{
+    if (!trazaActiva())
+    {
+        return;
+    }
+
+    ofstream archivo(archivoTraza);
+    if (!archivo)
+    {
+        mostrarMensajeError("No se pudo escribir el archivo de traza: " + archivoTraza);
+        return;
+    }
+
+    archivo << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    archivo << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"optimizacion\"}}";
+
+    lock_guard<mutex> bloqueoRegistro(mtxRegistro);
+    for (const auto &buffer : buffersRegistrados)
+    {
+        lock_guard<mutex> bloqueo(buffer->mtx);
+
+        string nombreHilo = buffer->idHilo == 1 ? "principal" : "hilo " + to_string(buffer->idHilo);
+        archivo << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->idHilo
+                << ",\"args\":{\"name\":\"" << nombreHilo << "\"}}";
+
+        for (const auto &evento : buffer->eventos)
+        {
+            archivo << ",\n{\"name\":";
+            escribirCadenaJson(archivo, evento.nombre);
+            archivo << ",\"cat\":";
+            escribirCadenaJson(archivo, evento.categoria);
+            archivo << ",\"ph\":\"X\",\"ts\":" << evento.inicioNs / 1000 << '.' << (evento.inicioNs % 1000) / 100
+                    << ",\"dur\":" << evento.duracionNs / 1000 << '.' << (evento.duracionNs % 1000) / 100
+                    << ",\"pid\":1,\"tid\":" << buffer->idHilo << "}";
+        }
+    }
+
+    archivo << "\n]}\n";
+}
+
+// Constructor: toma la marca de inicio si la traza está activa
+IntervaloTraza::IntervaloTraza(const char *nombre, const char *categoria)
+    : nombre(nombre), categoria(categoria), inicioNs(0), activo(trazaActiva())
+{
+    if (activo)
+    {
+        inicioNs = tiempoActualNs();
+    }
+}
+
+// Destructor: registra el intervalo completo en el buffer del hilo
+IntervaloTraza::~IntervaloTraza()
+{
+    if (!activo)
+    {
+        return;
+    }
+
+    long long finNs = tiempoActualNs();
+    BufferTraza &buffer = bufferDelHilo();
+    lock_guard<mutex> bloqueo(buffer.mtx);
+    buffer.eventos.push_back(EventoTraza{nombre, categoria, inicioNs, finNs - inicioNs});
+}
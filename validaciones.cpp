@@ -11,6 +11,7 @@
 #include <string>
 #include <algorithm>
 #include <cctype>
+#include <cmath>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -34,6 +35,8 @@ double solicitarNumeroReal(const string &mensaje)
         cout << mensaje;
         getline(cin, entrada);
 
+        TRAZA_AMBITO("entrada.numeroReal", "entrada");
+
         // Remover espacios en blanco
         entrada.erase(remove_if(entrada.begin(), entrada.end(), ::isspace), entrada.end());
 
@@ -87,6 +90,8 @@ int solicitarNumeroEntero(const string &mensaje)
         cout << mensaje;
         getline(cin, entrada);
 
+        TRAZA_AMBITO("entrada.numeroEntero", "entrada");
+
         // Remover espacios en blanco
         entrada.erase(remove_if(entrada.begin(), entrada.end(), ::isspace), entrada.end());
 
@@ -193,6 +198,8 @@ string solicitarOperador(const string &mensaje)
         cout << mensaje;
         getline(cin, operador);
 
+        TRAZA_AMBITO("entrada.operador", "entrada");
+
         // Remover espacios
         operador.erase(remove_if(operador.begin(), operador.end(), ::isspace), operador.end());
 
@@ -0,0 +1,502 @@
+/**
+ * MÓDULO DE VERIFICACIÓN DEL MODELO
+ * Revisión de todas las restricciones antes de resolver: valores no
+ * finitos (datos importados), filas vacías, operadores inválidos, filas
+ * paralelas contradictorias y propagación de cotas sobre x₁, x₂ >= 0 para
+ * rechazar modelos infactibles sin ejecutar el cálculo
+ */
+
+#include "optimizacion.h"
+#include <iostream>
+#include <sstream>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define NUCLEOS_SSE2
+#endif
+
+using namespace std;
+
+static const double TOL_VERIFICACION = 1e-9;     // Holgura relativa al comparar cotas
+static const double TOL_PENDIENTE = 1e-12;       // Pendientes iguales para agrupar filas paralelas
+static const int MAX_PASADAS_PROPAGACION = 20;   // La propagación puede avanzar geométricamente
+
+static const unsigned char MARCA_NO_FINITO = 1;
+static const unsigned char MARCA_NULOS = 2;
+
+static string textoNumero(double valor)
+{
+    ostringstream texto;
+    texto << valor;
+    return texto.str();
+}
+
+/**
+ * Revisión numérica de todas las filas: marca las que tienen NaN o infinito
+ * (x - x no es 0 para ellos) y las que tienen ambos coeficientes en cero.
+ * La versión SSE2 revisa dos filas por instrucción y solo baja a la escalar
+ * en los pares que tienen alguna marca
+ * @return Cantidad de filas marcadas
+ */
+static size_t marcarFilasNumericas(const vector<Restriccion> &restricciones, vector<unsigned char> &marcas)
+{
+    size_t n = restricciones.size();
+    size_t marcadas = 0;
+    size_t i = 0;
+    marcas.assign(n, 0);
+
+#ifdef NUCLEOS_SSE2
+    const __m128d cero = _mm_setzero_pd();
+    for (; i + 2 <= n; i += 2)
+    {
+        const Restriccion &r0 = restricciones[i];
+        const Restriccion &r1 = restricciones[i + 1];
+        __m128d a1 = _mm_set_pd(r1.coeficienteX1, r0.coeficienteX1);
+        __m128d a2 = _mm_set_pd(r1.coeficienteX2, r0.coeficienteX2);
+        __m128d b = _mm_set_pd(r1.valorConstante, r0.valorConstante);
+        __m128d diferencia = _mm_add_pd(_mm_add_pd(_mm_sub_pd(a1, a1), _mm_sub_pd(a2, a2)), _mm_sub_pd(b, b));
+        int noFinito = _mm_movemask_pd(_mm_cmpunord_pd(diferencia, diferencia));
+        int nulos = _mm_movemask_pd(_mm_and_pd(_mm_cmpeq_pd(a1, cero), _mm_cmpeq_pd(a2, cero)));
+        if ((noFinito | nulos) == 0)
+        {
+            continue;
+        }
+        for (int k = 0; k < 2; k++)
+        {
+            marcas[i + k] = ((noFinito >> k) & 1 ? MARCA_NO_FINITO : 0) | ((nulos >> k) & 1 ? MARCA_NULOS : 0);
+            if (marcas[i + k])
+                marcadas++;
+        }
+    }
+#endif
+
+    for (; i < n; i++)
+    {
+        const Restriccion &r = restricciones[i];
+        if (!isfinite(r.coeficienteX1) || !isfinite(r.coeficienteX2) || !isfinite(r.valorConstante))
+            marcas[i] |= MARCA_NO_FINITO;
+        if (r.coeficienteX1 == 0.0 && r.coeficienteX2 == 0.0)
+            marcas[i] |= MARCA_NULOS;
+        if (marcas[i])
+            marcadas++;
+    }
+    return marcadas;
+}
+
+// Fila válida como intervalo: inferior <= a₁·x₁ + a₂·x₂ <= superior
+struct FilaIntervalo
+{
+    double a[2];
+    double inferior;
+    double superior;
+    int fila;
+};
+
+// Misma fila dividida por su primer coeficiente no nulo (paralelas = misma pendiente)
+struct FilaNormalizada
+{
+    double pendiente; // a₂/a₁, o infinito si a₁ = 0
+    double inferior;
+    double superior;
+    int fila;
+};
+
+static bool superaConHolgura(double mayor, double menor)
+{
+    if (isinf(mayor) || isinf(menor))
+        return mayor > menor;
+    return mayor > menor + TOL_VERIFICACION * max(1.0, max(abs(mayor), abs(menor)));
+}
+
+static const char *nombreVariable(int j)
+{
+    return j == 0 ? "x₁ (mesas)" : "x₂ (sillas)";
+}
+
+/**
+ * Diagnostica el modelo completo y reporta todos los problemas juntos
+ * @param restricciones Restricciones del modelo
+ * @param precioMesa Precio por mesa
+ * @param precioSilla Precio por silla
+ * @param detenerEnPrimero Termina al encontrar el primer problema
+ * @return Problemas encontrados y cotas deducidas para x₁ y x₂
+ */
+DiagnosticoModelo diagnosticarModelo(const vector<Restriccion> &restricciones, double precioMesa, double precioSilla,
+                                     bool detenerEnPrimero)
+{
+    TRAZA_AMBITO("verificacion.modelo", "calculo");
+
+    DiagnosticoModelo diagnostico;
+    auto agregar = [&](TipoProblemaModelo tipo, int fila, int otraFila, const string &descripcion)
+    {
+        diagnostico.problemas.push_back(ProblemaModelo{tipo, fila, otraFila, descripcion});
+        return detenerEnPrimero;
+    };
+
+    const double precios[2] = {precioMesa, precioSilla};
+    for (int j = 0; j < 2; j++)
+    {
+        if (!(isfinite(precios[j]) && precios[j] > 0.0) &&
+            agregar(PROBLEMA_PRECIO, -1, -1,
+                    string("El precio por ") + (j == 0 ? "mesa" : "silla") + " debe ser un número positivo (se leyó " +
+                        textoNumero(precios[j]) + ")."))
+        {
+            return diagnostico;
+        }
+    }
+
+    // Revisión de cada fila: números, coeficientes y operador
+    vector<unsigned char> marcas;
+    marcarFilasNumericas(restricciones, marcas);
+    vector<FilaIntervalo> filas;
+    filas.reserve(restricciones.size());
+    for (size_t i = 0; i < restricciones.size(); i++)
+    {
+        const Restriccion &r = restricciones[i];
+        int fila = static_cast<int>(i);
+        bool valida = true;
+        if (marcas[i] & MARCA_NO_FINITO)
+        {
+            valida = false;
+            if (agregar(PROBLEMA_VALOR_NO_FINITO, fila, -1, "Restricción " + to_string(i + 1) + ": contiene un valor no numérico o infinito."))
+                return diagnostico;
+        }
+        else if (marcas[i] & MARCA_NULOS)
+        {
+            valida = false;
+            if (agregar(PROBLEMA_COEFICIENTES_NULOS, fila, -1, "Restricción " + to_string(i + 1) + ": los coeficientes de x₁ y x₂ son ambos cero."))
+                return diagnostico;
+        }
+
+        bool menor = r.operador == "<=", mayor = r.operador == ">=", igual = r.operador == "=";
+        if (!menor && !mayor && !igual)
+        {
+            valida = false;
+            if (agregar(PROBLEMA_OPERADOR, fila, -1, "Restricción " + to_string(i + 1) + ": el operador \"" + r.operador + "\" no es <=, >= ni =."))
+                return diagnostico;
+        }
+
+        if (valida)
+        {
+            filas.push_back(FilaIntervalo{{r.coeficienteX1, r.coeficienteX2},
+                                          menor ? -INFINITO_LP : r.valorConstante,
+                                          mayor ? INFINITO_LP : r.valorConstante,
+                                          fila});
+        }
+    }
+
+    // Filas paralelas: en cada grupo con la misma pendiente, la mayor cota
+    // inferior no puede superar a la menor cota superior
+    vector<FilaNormalizada> normalizadas;
+    normalizadas.reserve(filas.size());
+    for (const auto &f : filas)
+    {
+        double escala = f.a[0] != 0.0 ? f.a[0] : f.a[1];
+        double inferior = f.inferior / escala, superior = f.superior / escala;
+        if (escala < 0)
+            swap(inferior, superior);
+        normalizadas.push_back(FilaNormalizada{f.a[0] != 0.0 ? f.a[1] / f.a[0] : INFINITO_LP, inferior, superior, f.fila});
+    }
+    sort(normalizadas.begin(), normalizadas.end(),
+         [](const FilaNormalizada &a, const FilaNormalizada &b) { return a.pendiente < b.pendiente; });
+
+    bool contradiccion = false;
+    for (size_t inicio = 0; inicio < normalizadas.size();)
+    {
+        double pendiente = normalizadas[inicio].pendiente;
+        size_t fin = inicio;
+        int filaInferior = -1, filaSuperior = -1;
+        double mayorInferior = -INFINITO_LP, menorSuperior = INFINITO_LP;
+        while (fin < normalizadas.size() &&
+               (normalizadas[fin].pendiente == pendiente ||
+                normalizadas[fin].pendiente - pendiente <= TOL_PENDIENTE * (1.0 + abs(pendiente))))
+        {
+            const FilaNormalizada &f = normalizadas[fin];
+            if (f.inferior > mayorInferior)
+            {
+                mayorInferior = f.inferior;
+                filaInferior = f.fila;
+            }
+            if (f.superior < menorSuperior)
+            {
+                menorSuperior = f.superior;
+                filaSuperior = f.fila;
+            }
+            fin++;
+        }
+        if (filaInferior >= 0 && filaSuperior >= 0 && superaConHolgura(mayorInferior, menorSuperior))
+        {
+            contradiccion = true;
+            int primera = min(filaInferior, filaSuperior), segunda = max(filaInferior, filaSuperior);
+            if (agregar(PROBLEMA_FILAS_CONTRADICTORIAS, primera, segunda,
+                        "Las restricciones " + to_string(primera + 1) + " y " + to_string(segunda + 1) +
+                            " son paralelas y se contradicen: ningún punto cumple ambas."))
+                return diagnostico;
+        }
+        inicio = fin;
+    }
+
+    // Con filas contradictorias el modelo ya es infactible: no hace falta propagar
+    if (contradiccion)
+    {
+        return diagnostico;
+    }
+
+    // Propagación de cotas: cada fila acota una variable con el rango de la otra
+    double inferior[2] = {0.0, 0.0}, superior[2] = {INFINITO_LP, INFINITO_LP};
+    int origenInferior[2] = {-1, -1}, origenSuperior[2] = {-1, -1}; // -1 = x >= 0
+    auto describirCota = [](int origen, int j, double valor, const char *operador)
+    {
+        string cota = string(nombreVariable(j)) + " " + operador + " " + textoNumero(valor);
+        return origen < 0 ? cota + " (no negatividad)" : cota + " (restricción " + to_string(origen + 1) + ")";
+    };
+
+    // Las cotas solo se ajustan si mejoran con holgura (la mayoría de las filas no cambian nada)
+    auto ajustarCota = [&](int j, double limite, bool esSuperior, int fila)
+    {
+        if (esSuperior)
+        {
+            if (!(limite < superior[j]) || !superaConHolgura(superior[j], limite))
+                return false;
+            superior[j] = limite;
+            origenSuperior[j] = fila;
+        }
+        else
+        {
+            if (!(limite > inferior[j]) || !superaConHolgura(limite, inferior[j]))
+                return false;
+            inferior[j] = limite;
+            origenInferior[j] = fila;
+        }
+        return true;
+    };
+
+    bool cambio = true;
+    for (diagnostico.pasadas = 0; cambio && diagnostico.pasadas < MAX_PASADAS_PROPAGACION; diagnostico.pasadas++)
+    {
+        cambio = false;
+        for (const auto &f : filas)
+        {
+            for (int j = 0; j < 2; j++)
+            {
+                double aj = f.a[j], ak = f.a[1 - j];
+                if (aj == 0.0)
+                    continue;
+                int k = 1 - j;
+
+                // Rango de a_k·x_k con las cotas actuales
+                double minimoOtra = ak == 0.0 ? 0.0 : ak > 0 ? ak * inferior[k] : ak * superior[k];
+                double maximoOtra = ak == 0.0 ? 0.0 : ak > 0 ? ak * superior[k] : ak * inferior[k];
+
+                bool ajustada = false;
+                if (f.superior < INFINITO_LP && minimoOtra > -INFINITO_LP)
+                    ajustada |= ajustarCota(j, (f.superior - minimoOtra) / aj, aj > 0, f.fila);
+                if (f.inferior > -INFINITO_LP && maximoOtra < INFINITO_LP)
+                    ajustada |= ajustarCota(j, (f.inferior - maximoOtra) / aj, aj < 0, f.fila);
+                if (!ajustada)
+                    continue;
+                cambio = true;
+
+                if (superaConHolgura(inferior[j], superior[j]))
+                {
+                    int a = origenInferior[j], b = origenSuperior[j];
+                    string filasTexto = a < 0 || b < 0 || a == b
+                                            ? "La restricción " + to_string(max(a, b) + 1) + " no se puede cumplir"
+                                            : "Las restricciones " + to_string(min(a, b) + 1) + " y " +
+                                                  to_string(max(a, b) + 1) + " no se pueden cumplir a la vez";
+                    agregar(PROBLEMA_INFACTIBLE, a < 0 ? b : a, a < 0 || a == b ? -1 : b,
+                            filasTexto + ": exigen " + describirCota(a, j, inferior[j], ">=") + " y " +
+                                describirCota(b, j, superior[j], "<=") + ".");
+                    diagnostico.pasadas++;
+                    return diagnostico;
+                }
+            }
+        }
+    }
+
+    diagnostico.inferiorX1 = inferior[0];
+    diagnostico.superiorX1 = superior[0];
+    diagnostico.inferiorX2 = inferior[1];
+    diagnostico.superiorX2 = superior[1];
+    return diagnostico;
+}
+
+// Muestra cada problema del diagnóstico como un mensaje de error
+void mostrarDiagnosticoModelo(const DiagnosticoModelo &diagnostico)
+{
+    if (diagnostico.esValido())
+    {
+        return;
+    }
+    mostrarMensajeError("El modelo tiene " + to_string(diagnostico.problemas.size()) +
+                        (diagnostico.problemas.size() == 1 ? " problema:" : " problemas:"));
+    for (const auto &problema : diagnostico.problemas)
+    {
+        cout << "  • " << problema.descripcion << endl;
+    }
+}
+
+/**
+ * Lote de variaciones de un modelo con 150 restricciones, una cuarta parte
+ * con datos dañados o infactibles: compara el costo de rechazarlas con la
+ * verificación contra el de resolverlas, y comprueba que cada modelo
+ * rechazado por infactible realmente no tiene puntos factibles
+ * @param modelos Número de variaciones del lote
+ */
+void ejecutarBenchmarkVerificacion(size_t modelos)
+{
+    // Ejemplo pequeño con varios problemas a la vez
+    vector<Restriccion> ejemplo = {4 * X1 + 3 * X2 <= 240, 2 * X1 + X2 <= 100,
+                                   Restriccion(nan(""), 1.0, 50.0), Restriccion(0.0, 0.0, 10.0),
+                                   Restriccion(1.0, 1.0, 20.0, "=<"), 4 * X1 + 2 * X2 >= 260};
+    DiagnosticoModelo diagnosticoEjemplo = diagnosticarModelo(ejemplo, 70.0, -50.0);
+
+    cout << "\n"
+         << string(60, '=') << endl;
+    cout << "  BENCHMARK: VERIFICACIÓN DEL MODELO COMPLETO" << endl;
+    cout << string(60, '=') << endl;
+    cout << "\nModelo de ejemplo (" << ejemplo.size() << " restricciones, precio por silla negativo):" << endl;
+    for (const auto &problema : diagnosticoEjemplo.problemas)
+    {
+        cout << "  • " << problema.descripcion << endl;
+    }
+
+    // Modelo base factible: filas "<=" con coeficientes positivos
+    mt19937 generador(31);
+    uniform_real_distribution<double> coeficiente(0.5, 6.0), capacidad(200.0, 600.0);
+    ModeloProduccion base;
+    base.precioMesa = 70.0;
+    base.precioSilla = 50.0;
+    for (int i = 0; i < 150; i++)
+    {
+        base.restricciones.push_back(Restriccion(coeficiente(generador), coeficiente(generador), capacidad(generador)));
+    }
+
+    // Una de cada cuatro variaciones está dañada de distinta forma
+    vector<VariacionEscenario> variaciones(max<size_t>(modelos, 4));
+    uniform_int_distribution<size_t> filaAleatoria(0, base.restricciones.size() - 1);
+    size_t danadas = 0;
+    for (size_t v = 0; v < variaciones.size(); v++)
+    {
+        VariacionEscenario &variacion = variaciones[v];
+        variacion.capacidades.push_back(AjusteCapacidad(filaAleatoria(generador), capacidad(generador)));
+        if (v % 4 != 3)
+            continue;
+        danadas++;
+        switch ((v / 4) % 3)
+        {
+        case 0: // Dato importado sin valor
+            variacion.capacidades.push_back(AjusteCapacidad(filaAleatoria(generador), nan("")));
+            break;
+        case 1: // Precio inválido
+            variacion.cambiaPrecios = true;
+            variacion.precioMesa = 70.0;
+            variacion.precioSilla = -5.0;
+            break;
+        default: // Capacidad negativa: ninguna producción la cumple
+            variacion.capacidades.push_back(AjusteCapacidad(filaAleatoria(generador), -50.0));
+            break;
+        }
+    }
+
+    // Modelos completos de cada variación, como los arma el lote
+    vector<ModeloProduccion> modelosLote(variaciones.size(), base);
+    for (size_t v = 0; v < variaciones.size(); v++)
+    {
+        for (const auto &ajuste : variaciones[v].capacidades)
+            modelosLote[v].restricciones[ajuste.indiceRestriccion].valorConstante = ajuste.valorConstante;
+        if (variaciones[v].cambiaPrecios)
+        {
+            modelosLote[v].precioMesa = variaciones[v].precioMesa;
+            modelosLote[v].precioSilla = variaciones[v].precioSilla;
+        }
+    }
+
+    auto inicio = chrono::steady_clock::now();
+    vector<char> rechazado(modelosLote.size()), infactible(modelosLote.size());
+    size_t rechazados = 0;
+    for (size_t v = 0; v < modelosLote.size(); v++)
+    {
+        const ModeloProduccion &m = modelosLote[v];
+        DiagnosticoModelo diagnostico = diagnosticarModelo(m.restricciones, m.precioMesa, m.precioSilla, true);
+        rechazado[v] = !diagnostico.esValido();
+        infactible[v] = rechazado[v] && (diagnostico.problemas[0].tipo == PROBLEMA_INFACTIBLE ||
+                                         diagnostico.problemas[0].tipo == PROBLEMA_FILAS_CONTRADICTORIAS);
+        rechazados += rechazado[v];
+    }
+    double segundosVerificacion = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    // Todas las filas, para que la verificación completa recorra el modelo entero
+    inicio = chrono::steady_clock::now();
+    size_t problemas = 0;
+    for (const auto &m : modelosLote)
+        problemas += diagnosticarModelo(m.restricciones, m.precioMesa, m.precioSilla).problemas.size();
+    double segundosCompleta = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    // Resolver los modelos rechazados por infactibles: el cálculo debe confirmarlo
+    size_t infactibles = 0, noConfirmados = 0;
+    inicio = chrono::steady_clock::now();
+    for (size_t v = 0; v < modelosLote.size(); v++)
+    {
+        if (!rechazado[v] || variaciones[v].cambiaPrecios || v % 4 != 3 || (v / 4) % 3 != 2)
+            continue;
+        infactibles++;
+        if (resolverPuntosExtremos(modelosLote[v].restricciones, modelosLote[v].precioMesa, modelosLote[v].precioSilla,
+                                   pmr::new_delete_resource())
+                .solucionEncontrada)
+        {
+            noConfirmados++;
+        }
+    }
+    double segundosInfactibles = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    PlanificadorRobo planificador;
+    inicio = chrono::steady_clock::now();
+    vector<SolucionOptima> resultados = resolverLoteEscenarios(base, variaciones, planificador);
+    double segundosLote = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+    // El lote descarta solo los infactibles; los demás rechazados se resuelven como en serie
+    size_t resueltos = 0, resultadosInconsistentes = 0;
+    for (size_t v = 0; v < resultados.size(); v++)
+    {
+        resueltos += resultados[v].solucionEncontrada;
+        bool esperado = !rechazado[v];
+        if (rechazado[v] && !infactible[v])
+            esperado = resolverPuntosExtremos(modelosLote[v].restricciones, modelosLote[v].precioMesa,
+                                              modelosLote[v].precioSilla, pmr::new_delete_resource())
+                           .solucionEncontrada;
+        if (resultados[v].solucionEncontrada != esperado)
+            resultadosInconsistentes++;
+    }
+
+    cout << "\nLote de " << variaciones.size() << " variaciones de " << base.restricciones.size() << " restricciones ("
+         << danadas << " dañadas):" << endl;
+    cout << "  • Rechazadas por la verificación: " << rechazados << endl;
+    cout << "  • Verificación con corte en el primer problema: "
+         << segundosVerificacion * 1e6 / modelosLote.size() << " µs por modelo" << endl;
+    cout << "  • Verificación completa: " << segundosCompleta * 1e6 / modelosLote.size() << " µs por modelo ("
+         << problemas << " problemas)" << endl;
+    if (infactibles > 0)
+    {
+        cout << "  • Resolver un modelo infactible sin verificar: " << segundosInfactibles * 1e6 / infactibles
+             << " µs hasta descubrir que no hay puntos factibles" << endl;
+    }
+    cout << "  • Lote completo (" << planificador.getNumHilos() << " hilos): " << segundosLote * 1000 << " ms, "
+         << resueltos << " resueltos" << endl;
+
+    if (rechazados != danadas)
+    {
+        mostrarMensajeError("La verificación no rechazó exactamente las variaciones dañadas.");
+    }
+    if (noConfirmados > 0)
+    {
+        mostrarMensajeError("Hay modelos rechazados por infactibles que el cálculo sí resolvió.");
+    }
+    if (resultadosInconsistentes > 0)
+    {
+        mostrarMensajeError("El lote resolvió modelos infactibles o no coincide con el cálculo en serie.");
+    }
+}